@@ -34,10 +34,14 @@ namespace geode
     {
         pybind11::class_< BRepConcatener >( module, "BRepConcatener" )
             .def( pybind11::init< BRep& >() )
-            .def( "concatenate", &BRepConcatener::concatenate );
+            .def( "concatenate",
+                static_cast< ModelCopyMapping ( BRepConcatener::* )(
+                    const BRep& ) >( &BRepConcatener::concatenate ) );
 
         pybind11::class_< SectionConcatener >( module, "SectionConcatener" )
             .def( pybind11::init< Section& >() )
-            .def( "concatenate", &SectionConcatener::concatenate );
+            .def( "concatenate",
+                static_cast< ModelCopyMapping ( SectionConcatener::* )(
+                    const Section& ) >( &SectionConcatener::concatenate ) );
     }
 } // namespace geode
@@ -41,6 +41,7 @@ ExternalProject_Add(opengeode
         -DWHEEL_VERSION:STRING=${WHEEL_VERSION}
         -DOPENGEODE_WITH_TESTS:BOOL=${OPENGEODE_WITH_TESTS}
         -DOPENGEODE_WITH_PYTHON:BOOL=${OPENGEODE_WITH_PYTHON}
+        -DOPENGEODE_WITH_64BIT_INDEX:BOOL=${OPENGEODE_WITH_64BIT_INDEX}
         -DINCLUDE_PYBIND11:BOOL=${INCLUDE_PYBIND11}
         -DUSE_SUPERBUILD:BOOL=OFF
         -DASYNCPLUSPLUS_INSTALL_PREFIX:PATH=${ASYNCPLUSPLUS_INSTALL_PREFIX}
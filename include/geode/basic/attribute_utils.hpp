@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include <absl/types/span.h>
 
 #include <geode/basic/common.hpp>
@@ -209,6 +211,22 @@ namespace geode
     IMPLICIT_ARRAY_ATTRIBUTE_LINEAR_INTERPOLATION( float );
     IMPLICIT_ARRAY_ATTRIBUTE_LINEAR_INTERPOLATION( double );
 
+    /*!
+     * Helper struct to let a VariableAttribute record its modified values,
+     * see VariableAttribute::take_first_modified_value.
+     * Disabled by default, so that other attributes do not pay for it.
+     * This struct may be customized for a given type.
+     * Example:
+     * template <>
+     * struct AttributeModificationTracking< MyType > : std::true_type
+     * {
+     * };
+     */
+    template < typename AttributeType >
+    struct AttributeModificationTracking : std::false_type
+    {
+    };
+
     /*!
      * Helper struct to convert an Attribute value to generic float.
      * This struct may be customized for a given type.
@@ -283,6 +301,9 @@ namespace geode
     IMPLICIT_GENERIC_ATTRIBUTE_CONVERSION( unsigned int );
     IMPLICIT_GENERIC_ATTRIBUTE_CONVERSION( float );
     IMPLICIT_GENERIC_ATTRIBUTE_CONVERSION( double );
+#ifdef OPENGEODE_64BIT_INDEX
+    IMPLICIT_GENERIC_ATTRIBUTE_CONVERSION( index_t );
+#endif
 
 #define IMPLICIT_ARRAY_GENERIC_ATTRIBUTE_CONVERSION( Type )                    \
     template < size_t size >                                                   \
@@ -319,4 +340,7 @@ namespace geode
     IMPLICIT_ARRAY_GENERIC_ATTRIBUTE_CONVERSION( unsigned int );
     IMPLICIT_ARRAY_GENERIC_ATTRIBUTE_CONVERSION( float );
     IMPLICIT_ARRAY_GENERIC_ATTRIBUTE_CONVERSION( double );
+#ifdef OPENGEODE_64BIT_INDEX
+    IMPLICIT_ARRAY_GENERIC_ATTRIBUTE_CONVERSION( index_t );
+#endif
 } // namespace geode
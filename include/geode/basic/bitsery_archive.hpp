@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <filesystem>
+
 #include <absl/container/fixed_array.h>
 #include <absl/container/inlined_vector.h>
 
@@ -36,11 +38,22 @@
 
 namespace geode
 {
+    /*!
+     * Directory of the file being written or read, empty if unknown.
+     * Objects referencing other files use it to store their paths relative
+     * to the archive.
+     */
+    struct ArchiveDirectory
+    {
+        std::filesystem::path directory;
+    };
+
     using PContext =
         bitsery::ext::PolymorphicContext< bitsery::ext::StandardRTTI >;
     using TContext = std::tuple< PContext,
         bitsery::ext::PointerLinkingContext,
-        bitsery::ext::InheritanceContext >;
+        bitsery::ext::InheritanceContext,
+        ArchiveDirectory >;
     using Serializer =
         bitsery::Serializer< bitsery::OutputBufferedStreamAdapter, TContext >;
     using Deserializer =
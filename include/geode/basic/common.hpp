@@ -95,6 +95,39 @@ void geode_unused( const T & /*unused*/ )
 {
 }
 
+#include <type_traits>
+
 #include <geode/basic/assert.hpp>
 #include <geode/basic/opengeode_basic_export.hpp>
-#include <geode/basic/types.hpp>
\ No newline at end of file
+#include <geode/basic/types.hpp>
+
+namespace geode
+{
+    /*!
+     * Convert a container size or an offset to index_t.
+     * Prefer it to static_cast< index_t >: it compiles without useless cast
+     * whatever the index width, and checks in debug that the value fits.
+     */
+    template < typename Integer >
+    [[nodiscard]] index_t checked_index( Integer value )
+    {
+        static_assert( std::is_integral_v< Integer >,
+            "[checked_index] Only integers can be converted to index_t" );
+        if constexpr( std::is_same_v< Integer, index_t > )
+        {
+            return value;
+        }
+        else
+        {
+            if constexpr( std::is_signed_v< Integer > )
+            {
+                OPENGEODE_ASSERT( value >= 0,
+                    "[checked_index] Negative value given as an index" );
+            }
+            const auto index = static_cast< index_t >( value );
+            OPENGEODE_ASSERT( static_cast< Integer >( index ) == value,
+                "[checked_index] Value too large for an index" );
+            return index;
+        }
+    }
+} // namespace geode
\ No newline at end of file
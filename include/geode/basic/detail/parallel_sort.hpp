@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+
+#include <async++.h>
+
+namespace geode
+{
+    namespace detail
+    {
+        /*!
+         * Sort the range in parallel: both halves are recursively sorted
+         * concurrently, then merged.
+         */
+        template < typename Iterator, typename Compare >
+        void parallel_sort(
+            Iterator begin, Iterator end, const Compare& compare )
+        {
+            static constexpr std::ptrdiff_t SEQUENTIAL_SIZE{ 1 << 14 };
+            const auto size = std::distance( begin, end );
+            if( size <= SEQUENTIAL_SIZE )
+            {
+                std::sort( begin, end, compare );
+                return;
+            }
+            const auto middle = begin + size / 2;
+            async::parallel_invoke(
+                [&begin, &middle, &compare] {
+                    parallel_sort( begin, middle, compare );
+                },
+                [&middle, &end, &compare] {
+                    parallel_sort( middle, end, compare );
+                } );
+            std::inplace_merge( begin, middle, end, compare );
+        }
+    } // namespace detail
+} // namespace geode
@@ -68,8 +68,7 @@ namespace geode
                     {
                         offset *= array.nb_cells_in_direction( d2 );
                     }
-                    const auto value =
-                        static_cast< index_t >( std::floor( index / offset ) );
+                    const auto value = index / offset;
                     cell_id[dimension - d - 1] = value;
                     index -= value * offset;
                 }
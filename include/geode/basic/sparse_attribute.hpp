@@ -138,7 +138,7 @@ namespace geode
                             bitsery::ext::StdMap{
                                 attribute.values_.max_size() },
                             []( Archive& a2, index_t& i, T& item ) {
-                                a2.value4b( i );
+                                a2.template value< INDEX_BYTES >( i );
                                 a2( item );
                             } );
                     } } } );
@@ -28,6 +28,8 @@
 #endif
 
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <string_view>
 
@@ -36,10 +38,23 @@ namespace geode
     static constexpr double GLOBAL_EPSILON{ 1E-6 };
     static constexpr double GLOBAL_ANGULAR_EPSILON{ 1E-3 };
 
+#ifdef OPENGEODE_64BIT_INDEX
+    using index_t = std::uint64_t;
+    using signed_index_t = std::int64_t;
+#else
     using index_t = unsigned int;
     using signed_index_t = int;
+#endif
     using local_index_t = unsigned char;
 
+    /*!
+     * Number of bytes used to store an index_t.
+     * Use it instead of hard-coded sizes when serializing indices.
+     * @warning Native files written with OPENGEODE_WITH_64BIT_INDEX enabled
+     * can only be read back by a library built with the same option.
+     */
+    static constexpr std::size_t INDEX_BYTES = sizeof( index_t );
+
     /// Value used for a invalid index
     static constexpr index_t NO_ID = index_t( -1 );
     static constexpr local_index_t NO_LID = local_index_t( -1 );
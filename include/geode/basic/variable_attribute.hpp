@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <string_view>
 
@@ -72,6 +74,7 @@ namespace geode
         void set_value( index_t element, T value )
         {
             values_[element] = std::move( value );
+            value_modified( element );
         }
 
         [[nodiscard]] const T& default_value() const
@@ -83,6 +86,7 @@ namespace geode
         void modify_value( index_t element, Modifier&& modifier )
         {
             modifier( values_[element] );
+            value_modified( element );
         }
 
         [[nodiscard]] index_t size() const
@@ -90,6 +94,40 @@ namespace geode
             return values_.size();
         }
 
+        /*!
+         * Smallest index of the values modified since the last call to
+         * take_first_modified_value, or NO_ID if none was. Elements added by
+         * a resize are not counted as modified until their value is set.
+         * Only available if AttributeModificationTracking is enabled for T.
+         */
+        [[nodiscard]] index_t first_modified_value() const
+        {
+            static_assert( AttributeModificationTracking< T >::value,
+                "[VariableAttribute] Modifications are not tracked for "
+                "this type" );
+            return first_modified_value_.load();
+        }
+
+        /*!
+         * Return first_modified_value and reset it.
+         */
+        [[nodiscard]] index_t take_first_modified_value() const
+        {
+            static_assert( AttributeModificationTracking< T >::value,
+                "[VariableAttribute] Modifications are not tracked for "
+                "this type" );
+            return first_modified_value_.exchange( NO_ID );
+        }
+
+        /*!
+         * Contiguous view on the stored values.
+         * It is invalidated when the attribute is resized.
+         */
+        [[nodiscard]] absl::Span< const T > values() const
+        {
+            return values_;
+        }
+
     public:
         void compute_value( index_t from_element,
             index_t to_element,
@@ -136,12 +174,16 @@ namespace geode
 
         void resize( index_t size, AttributeBase::AttributeKey ) override
         {
-            const auto capacity = static_cast< index_t >( values_.capacity() );
+            const auto capacity = checked_index( values_.capacity() );
             if( size > capacity )
             {
                 const auto next_capacity = capacity * 2;
                 values_.reserve( std::max( size, next_capacity ) );
             }
+            if( size < values_.size() )
+            {
+                value_modified( size );
+            }
             values_.resize( size, default_value_ );
         }
 
@@ -153,6 +195,16 @@ namespace geode
         void delete_elements( const std::vector< bool >& to_delete,
             AttributeBase::AttributeKey ) override
         {
+            if constexpr( AttributeModificationTracking< T >::value )
+            {
+                const auto first_deleted =
+                    std::find( to_delete.begin(), to_delete.end(), true );
+                if( first_deleted != to_delete.end() )
+                {
+                    value_modified( static_cast< index_t >(
+                        first_deleted - to_delete.begin() ) );
+                }
+            }
             delete_vector_elements( to_delete, values_ );
         }
 
@@ -160,6 +212,7 @@ namespace geode
             AttributeBase::AttributeKey ) override
         {
             permute( values_, permutation );
+            value_modified( 0 );
         }
 
         [[nodiscard]] std::shared_ptr< AttributeBase > clone(
@@ -186,6 +239,7 @@ namespace geode
                 {
                     values_[i] = typed_attribute.value( i );
                 }
+                value_modified( 0 );
             }
         }
 
@@ -283,9 +337,25 @@ namespace geode
             }
         }
 
+    private:
+        void value_modified( index_t element )
+        {
+            if constexpr( AttributeModificationTracking< T >::value )
+            {
+                auto first =
+                    first_modified_value_.load( std::memory_order_relaxed );
+                while( element < first
+                       && !first_modified_value_.compare_exchange_weak(
+                           first, element ) )
+                {
+                }
+            }
+        }
+
     private:
         T default_value_;
         std::vector< T > values_{};
+        mutable std::atomic< index_t > first_modified_value_{ NO_ID };
     };
 
     /*!
@@ -375,7 +445,7 @@ namespace geode
 
         void resize( index_t size, AttributeBase::AttributeKey ) override
         {
-            const auto capacity = static_cast< index_t >( values_.capacity() );
+            const auto capacity = checked_index( values_.capacity() );
             if( size > capacity )
             {
                 const auto next_capacity = capacity * 2;
@@ -77,6 +77,19 @@ namespace geode
         [[nodiscard]] std::vector< index_t > containing_boxes(
             const Point< dimension >& query ) const;
 
+        /*!
+         * @brief Gets all the boxes containing a point into a caller-supplied
+         * buffer
+         * @param[in] query the point to test
+         * @param[out] boxes the buffer, cleared before being filled. Its
+         * capacity is kept so that reusing it across queries avoids
+         * allocations.
+         * @note The tree is traversed sequentially, this function is intended
+         * to be called from parallel loops over many queries.
+         */
+        void containing_boxes( const Point< dimension >& query,
+            std::vector< index_t >& boxes ) const;
+
         /*!
          * @brief Gets the closest element to a point
          * @param[in] query the point to test
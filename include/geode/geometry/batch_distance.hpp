@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#pragma once
+
+#include <array>
+
+#include <absl/container/inlined_vector.h>
+#include <absl/types/span.h>
+
+#include <geode/geometry/common.hpp>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( Point );
+    FORWARD_DECLARATION_DIMENSION_CLASS( Triangle );
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Structure-of-arrays storage of points used by batch distance kernels.
+     * Each coordinate axis is stored contiguously so that kernels can be
+     * vectorized by the compiler.
+     */
+    template < index_t dimension >
+    class PointBatch
+    {
+    public:
+        static constexpr index_t INLINED_SIZE{ 8 };
+        using Coordinates = absl::InlinedVector< double, INLINED_SIZE >;
+
+        void clear();
+
+        void reserve( index_t nb );
+
+        index_t add_point( const Point< dimension >& point );
+
+        [[nodiscard]] index_t size() const
+        {
+            return checked_index( coordinates_[0].size() );
+        }
+
+        [[nodiscard]] const double* coordinates( local_index_t axis ) const
+        {
+            return coordinates_[axis].data();
+        }
+
+    private:
+        std::array< Coordinates, dimension > coordinates_;
+    };
+    ALIAS_2D_AND_3D( PointBatch );
+
+    /*!
+     * Structure-of-arrays storage of triangles used by batch distance kernels.
+     * Each vertex coordinate axis is stored contiguously so that kernels can
+     * be vectorized by the compiler.
+     */
+    template < index_t dimension >
+    class TriangleBatch
+    {
+    public:
+        static constexpr index_t INLINED_SIZE{ 8 };
+        using Coordinates = absl::InlinedVector< double, INLINED_SIZE >;
+
+        void clear();
+
+        void reserve( index_t nb );
+
+        index_t add_triangle( const Triangle< dimension >& triangle );
+
+        [[nodiscard]] index_t size() const
+        {
+            return checked_index( coordinates_[0][0].size() );
+        }
+
+        [[nodiscard]] const double* coordinates(
+            local_index_t vertex, local_index_t axis ) const
+        {
+            return coordinates_[vertex][axis].data();
+        }
+
+    private:
+        std::array< std::array< Coordinates, dimension >, 3 > coordinates_;
+    };
+    ALIAS_2D_AND_3D( TriangleBatch );
+
+    /*!
+     * Compute the squared smallest distances between one point and a batch
+     * of triangles.
+     * @param[out] squared_distances One value per triangle of the batch.
+     * @details Results match point_triangle_distance up to rounding errors.
+     */
+    template < index_t dimension >
+    void point_triangles_squared_distances( const Point< dimension >& point,
+        const TriangleBatch< dimension >& triangles,
+        absl::Span< double > squared_distances );
+
+    /*!
+     * Compute the squared smallest distances between a batch of points and
+     * one triangle.
+     * @param[out] squared_distances One value per point of the batch.
+     * @details Results match point_triangle_distance up to rounding errors.
+     */
+    template < index_t dimension >
+    void points_triangle_squared_distances(
+        const PointBatch< dimension >& points,
+        const Triangle< dimension >& triangle,
+        absl::Span< double > squared_distances );
+} // namespace geode
@@ -640,6 +640,29 @@ namespace geode
             }
         }
 
+        void containing_boxes_sequential( index_t node_index,
+            index_t element_begin,
+            index_t element_end,
+            const Point< dimension >& query,
+            std::vector< index_t >& result ) const
+        {
+            if( !node( node_index ).contains( query ) )
+            {
+                return;
+            }
+            if( is_leaf( element_begin, element_end ) )
+            {
+                result.push_back( mapping_morton( element_begin ) );
+                return;
+            }
+            const auto it = get_recursive_iterators(
+                node_index, element_begin, element_end );
+            containing_boxes_sequential( it.child_left, element_begin,
+                it.element_middle, query, result );
+            containing_boxes_sequential( it.child_right, it.element_middle,
+                element_end, query, result );
+        }
+
     private:
         std::vector< BoundingBox< dimension > > tree_;
         std::vector< index_t > mapping_morton_;
@@ -549,6 +549,8 @@ namespace GEO
 
 /******* extracted from predicates.h *******/
 
+#include <absl/types/span.h>
+
 #include <geode/geometry/information.hpp>
 #include <geode/geometry/point.hpp>
 #include <geode/geometry/vector.hpp>
@@ -556,6 +558,10 @@ namespace GEO
 namespace geode
 {
     FORWARD_DECLARATION_DIMENSION_CLASS( Point );
+    FORWARD_DECLARATION_DIMENSION_CLASS( Triangle );
+    ALIAS_2D( Triangle );
+    class Tetrahedron;
+    struct PredicatesStatistics;
 } // namespace geode
 
 namespace GEO
@@ -587,6 +593,31 @@ namespace GEO
             const geode::Point2D& p1,
             const geode::Point2D& p2 );
 
+        /*!
+         * Evaluate orient_2d on all the triangles: a branch-free
+         * floating-point filter is first run on chunks of triangles copied
+         * as structure of arrays, then only the uncertain triangles are
+         * evaluated with exact arithmetic.
+         */
+        void orient_2d_batch( absl::Span< const geode::Triangle2D > triangles,
+            absl::Span< SIGN > signs );
+
+        /*!
+         * Evaluate orient_3d on all the tetrahedra: a branch-free
+         * floating-point filter is first run on chunks of tetrahedra copied
+         * as structure of arrays, then only the uncertain tetrahedra are
+         * evaluated with exact arithmetic.
+         */
+        void orient_3d_batch(
+            absl::Span< const geode::Tetrahedron > tetrahedra,
+            absl::Span< SIGN > signs );
+
+        void enable_statistics( bool enable );
+
+        [[nodiscard]] geode::PredicatesStatistics statistics();
+
+        void reset_statistics();
+
         void initialize();
     } // namespace PCK
 } // namespace GEO
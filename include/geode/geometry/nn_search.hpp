@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <absl/types/span.h>
+
 #include <geode/basic/mapping.hpp>
 #include <geode/basic/pimpl.hpp>
 
@@ -36,6 +38,8 @@ namespace geode
 
     /*!
      * Given a list of points, this class returns neighboring points.
+     * The points are either owned by the NNSearch, or only viewed (see
+     * create_view) to avoid duplicating large point sets.
      */
     template < index_t dimension >
     class NNSearch
@@ -83,11 +87,75 @@ namespace geode
             std::vector< index_t > colocated_input_points;
         };
 
+        /*!
+         * Neighbors of several query points packed in CSR format: the
+         * neighbors of query q are stored in
+         * [offsets[q], offsets[q + 1]) of neighbors and squared_distances.
+         */
+        struct BulkNeighbors
+        {
+            [[nodiscard]] index_t nb_queries() const
+            {
+                return offsets.empty() ? 0
+                                       : checked_index( offsets.size() - 1 );
+            }
+
+            [[nodiscard]] absl::Span< const index_t > query_neighbors(
+                index_t query ) const
+            {
+                return absl::MakeConstSpan( neighbors )
+                    .subspan( offsets[query],
+                        offsets[query + 1] - offsets[query] );
+            }
+
+            /*!
+             * Only available if distances were requested.
+             */
+            [[nodiscard]] absl::Span< const double > query_squared_distances(
+                index_t query ) const
+            {
+                return absl::MakeConstSpan( squared_distances )
+                    .subspan( offsets[query],
+                        offsets[query + 1] - offsets[query] );
+            }
+
+            std::vector< index_t > offsets;
+            std::vector< index_t > neighbors;
+            /*!
+             * Empty if distances were not requested.
+             */
+            std::vector< double > squared_distances;
+        };
+
     public:
         explicit NNSearch( std::vector< Point< dimension > > points );
         NNSearch( NNSearch&& other ) noexcept;
         ~NNSearch();
 
+        /*!
+         * Build the search tree directly on the given points, no copy is done.
+         * The points must outlive the NNSearch and must not be modified.
+         */
+        [[nodiscard]] static NNSearch< dimension > create_view(
+            absl::Span< const Point< dimension > > points );
+
+        /*!
+         * Load a search tree saved with save_index, no copy of the points is
+         * done and the tree is not built again.
+         * The points must be the ones used to build the saved tree, they must
+         * outlive the NNSearch and must not be modified.
+         */
+        [[nodiscard]] static NNSearch< dimension > load_view(
+            absl::Span< const Point< dimension > > points,
+            std::string_view index_filename );
+
+        /*!
+         * Save the search tree, points are not saved.
+         * @param[in] filename File in which the tree is saved, it can be
+         * stored alongside the points file and loaded with load_view.
+         */
+        void save_index( std::string_view filename ) const;
+
         [[nodiscard]] index_t nb_points() const;
 
         [[nodiscard]] const Point< dimension >& point( index_t index ) const;
@@ -132,6 +200,40 @@ namespace geode
         [[nodiscard]] std::vector< index_t > neighbors(
             const Point< dimension >& point, index_t nb_neighbors ) const;
 
+        /*!
+         * Get the closest neighbor of each given point.
+         * Queries are processed in parallel.
+         */
+        [[nodiscard]] std::vector< index_t > closest_neighbors(
+            absl::Span< const Point< dimension > > points ) const;
+
+        /*!
+         * Get a number of close neighbors of each given point.
+         * Queries are processed in parallel.
+         * @param[in] points The requested points
+         * @param[in] nb_neighbors The number of neighbors per point, it can be
+         * smaller if there is less points in the tree
+         * @param[in] compute_distances Fill the squared distances of the
+         * returned neighbors
+         */
+        [[nodiscard]] BulkNeighbors bulk_neighbors(
+            absl::Span< const Point< dimension > > points,
+            index_t nb_neighbors,
+            bool compute_distances = false ) const;
+
+        /*!
+         * Get the neighbors closer than a given distance of each given point.
+         * Queries are processed in parallel.
+         * @param[in] points The centers of the spheres
+         * @param[in] threshold_distance The radius of the spheres
+         * @param[in] compute_distances Fill the squared distances of the
+         * returned neighbors
+         */
+        [[nodiscard]] BulkNeighbors bulk_radius_neighbors(
+            absl::Span< const Point< dimension > > points,
+            double threshold_distance,
+            bool compute_distances = false ) const;
+
         /*!
          * Compute a colocation mapping from the list of points
          * @param[in] epsilon The approximation allowed to test if two points
@@ -144,6 +246,10 @@ namespace geode
         [[nodiscard]] ColocatedInfo colocated_index_mapping(
             const Frame< dimension >& epsilon ) const;
 
+    private:
+        NNSearch( absl::Span< const Point< dimension > > points,
+            std::string_view index_filename );
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
@@ -146,6 +146,15 @@ namespace geode
         }
     };
 
+    /*!
+     * Modifications of point attributes are recorded, so that data computed
+     * from the mesh points can detect direct writes to the points attribute.
+     */
+    template < index_t dimension >
+    struct AttributeModificationTracking< Point< dimension > > : std::true_type
+    {
+    };
+
     template < index_t dimension >
     class OpenGeodePointException : public OpenGeodeException
     {
@@ -23,6 +23,12 @@
 
 #pragma once
 
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <absl/types/span.h>
+
 #include <geode/geometry/common.hpp>
 
 namespace geode
@@ -53,4 +59,54 @@ namespace geode
      */
     [[nodiscard]] Sign opengeode_geometry_api triangle_area_sign(
         const Triangle3D& triangle, local_index_t axis );
+
+    /*!
+     * Return the signs of several tetrahedron volumes.
+     * The fast floating-point filter is evaluated on the whole batch before
+     * falling back to exact arithmetic on the uncertain tetrahedra only.
+     */
+    [[nodiscard]] std::vector< Sign > opengeode_geometry_api
+        tetrahedra_volume_signs( absl::Span< const Tetrahedron > tetrahedra );
+
+    /*!
+     * Return the signs of several 2D triangle areas.
+     * The fast floating-point filter is evaluated on the whole batch before
+     * falling back to exact arithmetic on the uncertain triangles only.
+     */
+    [[nodiscard]] std::vector< Sign > opengeode_geometry_api
+        triangles_area_signs( absl::Span< const Triangle2D > triangles );
+
+    struct opengeode_geometry_api PredicateCounters
+    {
+        /*!
+         * Ratio of evaluations requiring exact arithmetic
+         */
+        [[nodiscard]] double exact_ratio() const;
+
+        std::uint64_t nb_evaluations{ 0 };
+        std::uint64_t nb_exact_evaluations{ 0 };
+    };
+
+    /*!
+     * Evaluation counters of the orientation predicates used by all the
+     * robust geometric functions (signs, positions, intersection detection).
+     */
+    struct opengeode_geometry_api PredicatesStatistics
+    {
+        [[nodiscard]] std::string string() const;
+
+        PredicateCounters orient_2d;
+        PredicateCounters orient_3d;
+    };
+
+    /*!
+     * Enable or disable the predicates counters (disabled by default).
+     * Counters are shared by all threads.
+     */
+    void opengeode_geometry_api enable_predicates_statistics( bool enable );
+
+    [[nodiscard]] PredicatesStatistics opengeode_geometry_api
+        predicates_statistics();
+
+    void opengeode_geometry_api reset_predicates_statistics();
 } // namespace geode
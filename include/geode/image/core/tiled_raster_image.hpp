@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <string>
+#include <string_view>
+
+#include <absl/strings/str_cat.h>
+#include <absl/types/span.h>
+
+#include <geode/basic/pimpl.hpp>
+
+#include <geode/image/common.hpp>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( RasterImage );
+    class RGBColor;
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Read-only RasterImage stored by tiles in a file, with an optional mip
+     * pyramid.
+     * Level 0 is the full resolution image, each following level halves the
+     * number of cells in every direction (rounded up) until a single cell
+     * remains, a cell color being the average of the colors of its children.
+     * Tiles are read from the file on demand and kept in a bounded least
+     * recently used cache, so only the tiles covering the accessed cells are
+     * loaded in memory.
+     * Methods are thread-safe: the cache is split into shards locked
+     * independently and tiles are read from the file outside of any lock,
+     * so concurrent accesses to different tiles do not wait for each other.
+     * @see save_tiled_raster_image
+     */
+    template < index_t dimension >
+    class TiledRasterImage
+    {
+        OPENGEODE_DISABLE_COPY( TiledRasterImage );
+
+    public:
+        using CellIndices = std::array< index_t, dimension >;
+
+        static constexpr index_t DEFAULT_TILE_SIZE{ dimension == 3 ? 32u
+                                                                   : 256u };
+        static constexpr index_t DEFAULT_MAX_NB_CACHED_TILES{ 64 };
+
+        /*!
+         * Open a file written by save_tiled_raster_image.
+         * No tile is read until a color is requested.
+         * @param[in] max_nb_cached_tiles Maximum number of tiles kept in
+         * memory. Tiles are evicted per cache shard, so the least recently
+         * used tile overall is not always the evicted one.
+         */
+        explicit TiledRasterImage( std::string_view filename,
+            index_t max_nb_cached_tiles = DEFAULT_MAX_NB_CACHED_TILES );
+        TiledRasterImage( TiledRasterImage&& other ) noexcept;
+        ~TiledRasterImage();
+
+        [[nodiscard]] static std::string native_extension_static()
+        {
+            static const auto extension =
+                absl::StrCat( "og_timg", dimension, "d" );
+            return extension;
+        }
+
+        [[nodiscard]] index_t nb_levels() const;
+
+        [[nodiscard]] index_t tile_size() const;
+
+        [[nodiscard]] index_t nb_cells_in_direction(
+            index_t level, index_t direction ) const;
+
+        [[nodiscard]] RGBColor color(
+            index_t level, const CellIndices& cell_indices ) const;
+
+        /*!
+         * Colors of several cells of the same level.
+         * Faster than successive calls to color(), especially when
+         * consecutive cells are in the same tile.
+         * @param[out] colors Output of the same size as cells.
+         */
+        void colors( index_t level,
+            absl::Span< const CellIndices > cells,
+            absl::Span< RGBColor > colors ) const;
+
+        /*!
+         * Number of tiles currently loaded in memory.
+         */
+        [[nodiscard]] index_t nb_cached_tiles() const;
+
+    private:
+        IMPLEMENTATION_MEMBER( impl_ );
+    };
+    ALIAS_2D_AND_3D( TiledRasterImage );
+
+    /*!
+     * Save a RasterImage as a tiled image readable by TiledRasterImage.
+     * Each tile stores tile_size cells in every direction, border tiles are
+     * padded. Mip levels are computed in parallel.
+     * @param[in] build_mipmaps If false, only the full resolution level is
+     * stored.
+     */
+    template < index_t dimension >
+    void save_tiled_raster_image( const RasterImage< dimension >& image,
+        std::string_view filename,
+        index_t tile_size = TiledRasterImage< dimension >::DEFAULT_TILE_SIZE,
+        bool build_mipmaps = true );
+} // namespace geode
@@ -68,6 +68,13 @@ namespace geode
          */
         void set_point( index_t vertex, Point< dimension > point );
 
+        /*!
+         * Invalidate the cached bounding box of the points.
+         * Modifications of the active CRS points are detected, this is only
+         * needed for other point edits.
+         */
+        void reset_points_bounding_box();
+
     private:
         CoordinateReferenceSystemManagers< dimension >& crs_managers_;
     };
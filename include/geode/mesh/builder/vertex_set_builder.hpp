@@ -94,6 +94,26 @@ namespace geode
         std::vector< index_t > permute_vertices(
             absl::Span< const index_t > permutation );
 
+        /*!
+         * Notify that the vertex coordinates have been modified.
+         * Already done by the builder methods, should only be called after
+         * modifying data directly through the attribute managers.
+         */
+        void update_geometry_revision();
+
+        /*!
+         * Notify that the mesh connectivity has been modified.
+         * Already done by the builder methods.
+         */
+        void update_connectivity_revision();
+
+        /*!
+         * Notify that attribute values have been modified.
+         * Should be called after modifying attribute values through the
+         * attribute managers.
+         */
+        void update_attribute_revision();
+
     public:
         void copy( const VertexSet& vertex_set, VertexSetKey key );
 
@@ -105,6 +125,8 @@ namespace geode
         virtual void do_create_vertex() = 0;
 
     private:
+        void update_revisions();
+
         virtual void do_create_vertices( index_t nb ) = 0;
 
         virtual void do_delete_vertices( const std::vector< bool >& to_delete,
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <optional>
+
+#include <absl/container/inlined_vector.h>
+#include <absl/types/span.h>
+
+#include <geode/basic/pimpl.hpp>
+
+#include <geode/mesh/common.hpp>
+#include <geode/mesh/core/grid.hpp>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( LightRegularGrid );
+    FORWARD_DECLARATION_DIMENSION_CLASS( Point );
+    FORWARD_DECLARATION_DIMENSION_CLASS( Vector );
+    class AttributeManager;
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Adaptive grid (quadtree in 2D, octree in 3D) built over a regular
+     * finest grid.
+     * Level 0 is the coarsest level and is fully allocated. A cell of level
+     * l covers 2^(finest_level - l) finest cells in each direction, cells
+     * on the grid borders are clipped. Cells are only allocated where they
+     * are refined, so storage follows the areas of interest instead of the
+     * full finest resolution.
+     * Every level has its own cell AttributeManager, containing both the
+     * leaf cells and the refined cells of this level. When a cell is
+     * refined, its transferable attribute values are copied to its children.
+     */
+    template < index_t dimension >
+    class AdaptiveGrid
+    {
+        OPENGEODE_DISABLE_COPY( AdaptiveGrid );
+
+    public:
+        static constexpr auto dim = dimension;
+        using CellIndices = typename Grid< dimension >::CellIndices;
+        using VertexIndices = typename Grid< dimension >::VertexIndices;
+
+        struct Cell
+        {
+            [[nodiscard]] bool operator==( const Cell& other ) const
+            {
+                return level == other.level && indices == other.indices;
+            }
+
+            [[nodiscard]] bool operator!=( const Cell& other ) const
+            {
+                return !( *this == other );
+            }
+
+            local_index_t level;
+            CellIndices indices;
+        };
+        using Cells = absl::InlinedVector< Cell, 1 << dimension >;
+
+        AdaptiveGrid( Point< dimension > origin,
+            std::array< index_t, dimension > finest_cells_number,
+            std::array< double, dimension > finest_cells_length,
+            local_index_t nb_levels );
+        AdaptiveGrid(
+            const Grid< dimension >& finest_grid, local_index_t nb_levels );
+        AdaptiveGrid( AdaptiveGrid&& other ) noexcept;
+        AdaptiveGrid& operator=( AdaptiveGrid&& other ) noexcept;
+        ~AdaptiveGrid();
+
+        /*!
+         * Regular grid of the finest level, used for all the geometric
+         * computations.
+         */
+        [[nodiscard]] const LightRegularGrid< dimension >& finest_grid() const;
+
+        [[nodiscard]] local_index_t nb_levels() const;
+
+        [[nodiscard]] local_index_t finest_level() const;
+
+        [[nodiscard]] index_t nb_cells_in_direction(
+            local_index_t level, index_t direction ) const;
+
+        [[nodiscard]] double cell_length_in_direction(
+            local_index_t level, index_t direction ) const;
+
+        /*!
+         * Number of allocated cells (leaves and refined cells) on the level.
+         */
+        [[nodiscard]] index_t nb_cells( local_index_t level ) const;
+
+        [[nodiscard]] index_t nb_leaf_cells() const;
+
+        /*!
+         * Return the cell of the given level at the given position in the
+         * level AttributeManager.
+         */
+        [[nodiscard]] Cell cell( local_index_t level, index_t cell_id ) const;
+
+        /*!
+         * Return the position of the cell in its level AttributeManager, or
+         * nothing if the cell is not allocated.
+         */
+        [[nodiscard]] std::optional< index_t > cell_id(
+            const Cell& cell ) const;
+
+        [[nodiscard]] bool is_leaf( const Cell& cell ) const;
+
+        [[nodiscard]] std::optional< Cell > parent( const Cell& cell ) const;
+
+        [[nodiscard]] Cells children( const Cell& cell ) const;
+
+        /*!
+         * Return the leaf cell covering the given finest grid cell.
+         */
+        [[nodiscard]] Cell leaf_cell( const CellIndices& finest_cell ) const;
+
+        /*!
+         * Return the finest grid cell at the center of the given cell.
+         */
+        [[nodiscard]] CellIndices central_finest_cell( const Cell& cell ) const;
+
+        /*!
+         * Split the given leaf cell into its children on the next level.
+         * @exception OpenGeodeException if the cell is not an allocated leaf
+         * or is on the finest level.
+         */
+        void refine( const Cell& cell );
+
+        /*!
+         * Refine the grid so that each given finest grid cell becomes a leaf
+         * of the finest level. This is typically used with the output of the
+         * rasterization functions computed on finest_grid().
+         */
+        void refine_finest_cells(
+            absl::Span< const CellIndices > finest_cells );
+
+        /*!
+         * Return true if the query point is inside the grid, up to a
+         * GLOBAL_EPSILON away from the grid bounding box.
+         */
+        [[nodiscard]] bool contains( const Point< dimension >& query ) const;
+
+        /*!
+         * Return the leaf cell(s) containing the query point.
+         * @detail When the query point is geometrically near to a cell limit,
+         * several cells are returned.
+         */
+        [[nodiscard]] Cells cells( const Point< dimension >& query ) const;
+
+        [[nodiscard]] Point< dimension > cell_barycenter(
+            const Cell& cell ) const;
+
+        /*!
+         * Returns the finest grid vertex closest to the query point among the
+         * corners of the leaf cell containing it.
+         */
+        [[nodiscard]] VertexIndices closest_vertex(
+            const Point< dimension >& query ) const;
+
+        [[nodiscard]] AttributeManager& cell_attribute_manager(
+            local_index_t level ) const;
+
+    private:
+        IMPLEMENTATION_MEMBER( impl_ );
+    };
+    ALIAS_2D_AND_3D( AdaptiveGrid );
+} // namespace geode
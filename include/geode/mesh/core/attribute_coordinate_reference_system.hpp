@@ -63,6 +63,13 @@ namespace geode
 
         void set_point( index_t point_id, Point< dimension > point ) override;
 
+        [[nodiscard]] absl::Span< const Point< dimension > > points_storage()
+            const override;
+
+        [[nodiscard]] index_t first_modified_point() const override;
+
+        [[nodiscard]] index_t take_first_modified_point() const override;
+
         [[nodiscard]] std::string_view attribute_name() const;
 
         [[nodiscard]] index_t nb_points() const;
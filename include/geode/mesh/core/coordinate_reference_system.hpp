@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <absl/types/span.h>
+
 #include <geode/basic/bitsery_archive.hpp>
 #include <geode/basic/named_type.hpp>
 
@@ -57,6 +59,36 @@ namespace geode
         virtual void set_point(
             index_t point_id, Point< dimension > point ) = 0;
 
+        /*!
+         * Contiguous storage of the points if the CRS has one, empty
+         * otherwise. It is invalidated when points are added or removed.
+         */
+        [[nodiscard]] virtual absl::Span< const Point< dimension > >
+            points_storage() const
+        {
+            return {};
+        }
+
+        /*!
+         * Smallest index of the points modified since the last call to
+         * take_first_modified_point, or NO_ID if none was. Data computed from
+         * the points use it to know which part is outdated.
+         * The default implementation cannot track modifications and reports
+         * all the points as modified.
+         */
+        [[nodiscard]] virtual index_t first_modified_point() const
+        {
+            return 0;
+        }
+
+        /*!
+         * Return first_modified_point and reset it.
+         */
+        [[nodiscard]] virtual index_t take_first_modified_point() const
+        {
+            return 0;
+        }
+
         template < typename Type, typename Serializer >
         static void register_coordinate_reference_system_type(
             PContext& context, std::string_view name )
@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include <geode/basic/passkey.hpp>
 #include <geode/basic/pimpl.hpp>
 
@@ -35,6 +37,7 @@ namespace bitsery
 
 namespace geode
 {
+    FORWARD_DECLARATION_DIMENSION_CLASS( BoundingBox );
     FORWARD_DECLARATION_DIMENSION_CLASS( CoordinateReferenceSystemManager );
     FORWARD_DECLARATION_DIMENSION_CLASS(
         CoordinateReferenceSystemManagersBuilder );
@@ -68,6 +71,23 @@ namespace geode
 
         [[nodiscard]] const Point< dimension >& point( index_t vertex ) const;
 
+        /*!
+         * Bounding box of the first nb_points points of the active CRS.
+         * The box is cached: it is extended with the points added since the
+         * previous call, and fully computed again in parallel only when one of
+         * its points was moved or removed.
+         */
+        [[nodiscard]] BoundingBox< dimension > points_bounding_box(
+            index_t nb_points ) const;
+
+        /*!
+         * Revision of the points, updated when points of the active CRS are
+         * modified (see CoordinateReferenceSystem::first_modified_point), by
+         * modifications of the coordinate reference systems and by
+         * reset_points_bounding_box. See MeshRevisions.
+         */
+        [[nodiscard]] std::uint64_t points_revision() const;
+
     public:
         [[nodiscard]] CoordinateReferenceSystemManager1D&
             coordinate_reference_system_manager1D( CRSManagersKey );
@@ -84,6 +104,8 @@ namespace geode
         void set_point(
             index_t vertex, Point< dimension > point, CRSManagersKey );
 
+        void reset_points_bounding_box( CRSManagersKey );
+
     protected:
         CoordinateReferenceSystemManagers();
         CoordinateReferenceSystemManagers(
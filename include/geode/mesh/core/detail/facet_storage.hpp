@@ -23,13 +23,20 @@
 
 #pragma once
 
+#include <cstdint>
+#include <type_traits>
+
 #include <absl/container/flat_hash_map.h>
 
+#include <async++.h>
+
 #include <bitsery/ext/std_map.h>
 
 #include <geode/basic/attribute_manager.hpp>
+#include <geode/basic/bitsery_archive.hpp>
 #include <geode/basic/common.hpp>
 #include <geode/basic/detail/mapping_after_deletion.hpp>
+#include <geode/basic/detail/parallel_sort.hpp>
 #include <geode/basic/range.hpp>
 #include <geode/basic/variable_attribute.hpp>
 
@@ -60,8 +67,8 @@ namespace geode
             FacetStorage()
                 : counter_( facet_attribute_manager_
                           .template find_or_create_attribute< VariableAttribute,
-                              index_t >(
-                              "counter", 1u, { false, false, false } ) ),
+                              index_t >( "counter", index_t{ 1 },
+                              { false, false, false } ) ),
                   vertices_( facet_attribute_manager_
                           .template find_or_create_attribute< VariableAttribute,
                               VertexContainer >( attribute_name(),
@@ -78,6 +85,20 @@ namespace geode
             [[nodiscard]] std::optional< index_t > find_facet(
                 TypedVertexCycle vertices ) const
             {
+                if( compact_ )
+                {
+                    const auto itr = absl::c_lower_bound( sorted_facets_,
+                        vertices.vertices(),
+                        [this]( index_t facet, const VertexContainer& key ) {
+                            return vertices_->value( facet ) < key;
+                        } );
+                    if( itr != sorted_facets_.end()
+                        && vertices_->value( *itr ) == vertices.vertices() )
+                    {
+                        return *itr;
+                    }
+                    return std::nullopt;
+                }
                 const auto itr = facet_indices_.find( vertices );
                 if( itr != facet_indices_.end() )
                 {
@@ -86,8 +107,142 @@ namespace geode
                 return std::nullopt;
             }
 
+            /*!
+             * Add the facets of all the elements at once in an empty storage.
+             * Facets are canonicalized and sorted in parallel, and they get
+             * the indices given by successive add_facet calls on the element
+             * facets in order.
+             * The storage is left compact (see compact_storage): the sorted
+             * facets are a by-product of the build, whereas the hash map can
+             * only be filled serially and is built on the first modification.
+             * @param[in] element_facets Function returning the list of facet
+             * vertices of an element.
+             */
+            template < typename ElementFacets >
+            void add_facets(
+                index_t nb_elements, const ElementFacets& element_facets )
+            {
+                OPENGEODE_ASSERT( facet_attribute_manager_.nb_elements() == 0,
+                    "[FacetStorage::add_facets] Storage should be empty" );
+                std::vector< index_t > offsets( nb_elements + 1, 0 );
+                async::parallel_for( async::irange( index_t{ 0 }, nb_elements ),
+                    [&offsets, &element_facets]( index_t element ) {
+                        offsets[element + 1] =
+                            checked_index( element_facets( element ).size() );
+                    } );
+                for( const auto element : Range{ nb_elements } )
+                {
+                    offsets[element + 1] += offsets[element];
+                }
+                const auto nb_occurrences = offsets.back();
+                std::vector< VertexContainer > keys( nb_occurrences );
+                async::parallel_for( async::irange( index_t{ 0 }, nb_elements ),
+                    [&offsets, &keys, &element_facets]( index_t element ) {
+                        auto occurrence = offsets[element];
+                        for( auto&& facet : element_facets( element ) )
+                        {
+                            keys[occurrence++] =
+                                TypedVertexCycle{ std::move( facet ) }
+                                    .vertices();
+                        }
+                    } );
+                std::vector< index_t > order( nb_occurrences );
+                absl::c_iota( order, 0 );
+                parallel_sort( order.begin(), order.end(),
+                    [&keys]( index_t lhs, index_t rhs ) {
+                        if( keys[lhs] != keys[rhs] )
+                        {
+                            return keys[lhs] < keys[rhs];
+                        }
+                        return lhs < rhs;
+                    } );
+                // Occurrences sharing the same key are contiguous in order,
+                // the first one being the earliest occurrence
+                std::vector< index_t > leaders( nb_occurrences );
+                std::vector< std::uint8_t > is_leader( nb_occurrences, 0 );
+                for( const auto i : Range{ nb_occurrences } )
+                {
+                    if( i == 0 || keys[order[i]] != keys[order[i - 1]] )
+                    {
+                        is_leader[order[i]] = 1;
+                        leaders[order[i]] = order[i];
+                    }
+                    else
+                    {
+                        leaders[order[i]] = leaders[order[i - 1]];
+                    }
+                }
+                std::vector< index_t > occurrence_facets( nb_occurrences );
+                index_t nb_facets{ 0 };
+                for( const auto occurrence : Range{ nb_occurrences } )
+                {
+                    if( is_leader[occurrence] != 0 )
+                    {
+                        occurrence_facets[occurrence] = nb_facets++;
+                    }
+                }
+                facet_attribute_manager_.resize( nb_facets );
+                std::vector< index_t > counters( nb_facets, 0 );
+                for( const auto occurrence : Range{ nb_occurrences } )
+                {
+                    counters[occurrence_facets[leaders[occurrence]]]++;
+                }
+                async::parallel_for(
+                    async::irange( index_t{ 0 }, nb_occurrences ),
+                    [this, &keys, &is_leader, &occurrence_facets, &counters](
+                        index_t occurrence ) {
+                        if( is_leader[occurrence] == 0 )
+                        {
+                            return;
+                        }
+                        const auto facet = occurrence_facets[occurrence];
+                        counter_->set_value( facet, counters[facet] );
+                        vertices_->set_value( facet, keys[occurrence] );
+                    } );
+                sorted_facets_.clear();
+                sorted_facets_.reserve( nb_facets );
+                for( const auto occurrence : order )
+                {
+                    if( is_leader[occurrence] != 0 )
+                    {
+                        sorted_facets_.push_back(
+                            occurrence_facets[occurrence] );
+                    }
+                }
+                compact_ = true;
+            }
+
+            /*!
+             * Replace the hash map used to find facets from their vertices
+             * by a list of facets sorted by vertices. Facets are then found
+             * by binary search, using much less memory. The hash map is
+             * rebuilt when the storage is modified.
+             */
+            void compact_storage()
+            {
+                if( compact_ )
+                {
+                    return;
+                }
+                sorted_facets_.resize( facet_attribute_manager_.nb_elements() );
+                absl::c_iota( sorted_facets_, 0 );
+                parallel_sort( sorted_facets_.begin(), sorted_facets_.end(),
+                    [this]( index_t lhs, index_t rhs ) {
+                        return vertices_->value( lhs )
+                               < vertices_->value( rhs );
+                    } );
+                facet_indices_ = {};
+                compact_ = true;
+            }
+
+            [[nodiscard]] bool is_storage_compact() const
+            {
+                return compact_;
+            }
+
             index_t add_facet( TypedVertexCycle vertices )
             {
+                expand_storage();
                 const auto id = facet_indices_.size();
                 const auto output =
                     facet_indices_.try_emplace( std::move( vertices ), id );
@@ -106,17 +261,17 @@ namespace geode
 
             void remove_facet( TypedVertexCycle vertices )
             {
-                const auto it = facet_indices_.find( vertices );
-                if( it == facet_indices_.end() )
+                const auto facet = find_facet( std::move( vertices ) );
+                if( !facet )
                 {
                     return;
                 }
-                const auto id = it->second;
+                const auto id = facet.value();
                 OPENGEODE_ASSERT( id != NO_ID,
                     "[FacetStorage::remove_facet] Cannot "
                     "find facet from given vertices" );
                 const auto old_count = counter_->value( id );
-                const auto new_count = std::max( 1u, old_count ) - 1;
+                const auto new_count = std::max( index_t{ 1 }, old_count ) - 1;
                 counter_->set_value( id, new_count );
             }
 
@@ -135,6 +290,7 @@ namespace geode
             std::vector< index_t > delete_facets(
                 const std::vector< bool >& to_delete )
             {
+                expand_storage();
                 const auto old2new =
                     detail::mapping_after_deletion( to_delete );
                 std::vector< TypedVertexCycle > key_to_erase;
@@ -170,6 +326,7 @@ namespace geode
             std::vector< index_t > update_facet_vertices(
                 absl::Span< const index_t > old2new )
             {
+                expand_storage();
                 const auto old_facet_indices = facet_indices_;
                 facet_indices_.clear();
                 facet_indices_.reserve( old_facet_indices.size() );
@@ -237,16 +394,78 @@ namespace geode
             {
                 facet_attribute_manager_.copy( from.facet_attribute_manager() );
                 facet_indices_ = from.facet_indices_;
+                sorted_facets_ = from.sorted_facets_;
+                compact_ = from.compact_;
                 counter_ =
                     facet_attribute_manager_
                         .find_or_create_attribute< VariableAttribute, index_t >(
-                            "counter", 1u, { false, false, false } );
+                            "counter", index_t{ 1 }, { false, false, false } );
                 vertices_ = facet_attribute_manager_.find_or_create_attribute<
                     VariableAttribute, VertexContainer >( attribute_name(),
                     VertexContainer{}, { false, false, false } );
             }
 
         private:
+            void expand_storage()
+            {
+                if( !compact_ )
+                {
+                    return;
+                }
+                facet_indices_ = hashed_facet_indices();
+                sorted_facets_ = {};
+                compact_ = false;
+            }
+
+            [[nodiscard]] absl::flat_hash_map< TypedVertexCycle, index_t >
+                hashed_facet_indices() const
+            {
+                absl::flat_hash_map< TypedVertexCycle, index_t > facet_indices;
+                facet_indices.reserve( sorted_facets_.size() );
+                for( const auto facet : sorted_facets_ )
+                {
+                    facet_indices.emplace(
+                        TypedVertexCycle{ vertices_->value( facet ) }, facet );
+                }
+                return facet_indices;
+            }
+
+            /*!
+             * A compact storage is saved as a hash map without being
+             * expanded. A loaded storage is never compact.
+             */
+            template < typename Archive >
+            static void serialize_facet_indices(
+                Archive& archive, FacetStorage< VertexContainer >& storage )
+            {
+                if constexpr( std::is_same_v< Archive, Deserializer > )
+                {
+                    storage.sorted_facets_ = {};
+                    storage.compact_ = false;
+                }
+                else if( storage.compact_ )
+                {
+                    auto facet_indices = storage.hashed_facet_indices();
+                    serialize_facet_indices_map( archive, facet_indices );
+                    return;
+                }
+                serialize_facet_indices_map( archive, storage.facet_indices_ );
+            }
+
+            template < typename Archive >
+            static void serialize_facet_indices_map( Archive& archive,
+                absl::flat_hash_map< TypedVertexCycle, index_t >&
+                    facet_indices )
+            {
+                archive.ext( facet_indices,
+                    bitsery::ext::StdMap{ facet_indices.max_size() },
+                    []( Archive& a, TypedVertexCycle& cycle,
+                        index_t& attribute ) {
+                        a.object( cycle );
+                        a.template value< INDEX_BYTES >( attribute );
+                    } );
+            }
+
             template < typename Archive >
             void serialize( Archive& archive )
             {
@@ -255,14 +474,7 @@ namespace geode
                         { []( Archive& a,
                               FacetStorage< VertexContainer >& storage ) {
                              a.object( storage.facet_attribute_manager_ );
-                             a.ext( storage.facet_indices_,
-                                 bitsery::ext::StdMap{
-                                     storage.facet_indices_.max_size() },
-                                 []( Archive& a2, TypedVertexCycle& cycle,
-                                     index_t& attribute ) {
-                                     a2.object( cycle );
-                                     a2.value4b( attribute );
-                                 } );
+                             serialize_facet_indices( a, storage );
                              a.ext( storage.counter_,
                                  bitsery::ext::StdSmartPtr{} );
                              a.ext( storage.vertices_,
@@ -283,14 +495,7 @@ namespace geode
                             []( Archive& a,
                                 FacetStorage< VertexContainer >& storage ) {
                                 a.object( storage.facet_attribute_manager_ );
-                                a.ext( storage.facet_indices_,
-                                    bitsery::ext::StdMap{
-                                        storage.facet_indices_.max_size() },
-                                    []( Archive& a2, TypedVertexCycle& cycle,
-                                        index_t& attribute ) {
-                                        a2.object( cycle );
-                                        a2.value4b( attribute );
-                                    } );
+                                serialize_facet_indices( a, storage );
                                 a.ext( storage.counter_,
                                     bitsery::ext::StdSmartPtr{} );
                                 a.ext( storage.vertices_,
@@ -301,6 +506,11 @@ namespace geode
         private:
             mutable AttributeManager facet_attribute_manager_;
             absl::flat_hash_map< TypedVertexCycle, index_t > facet_indices_;
+            /*!
+             * Facets sorted by vertices, only used in compact storage.
+             */
+            std::vector< index_t > sorted_facets_;
+            bool compact_{ false };
             std::shared_ptr< VariableAttribute< index_t > > counter_;
             std::shared_ptr< VariableAttribute< VertexContainer > > vertices_;
         };
@@ -82,6 +82,12 @@ namespace geode
          */
         [[nodiscard]] BoundingBox< dimension > bounding_box() const;
 
+        /*!
+         * Revisions of the mesh, the geometry one including the vertex
+         * coordinate modifications.
+         */
+        [[nodiscard]] MeshRevisions revisions() const override;
+
     protected:
         EdgedCurve();
         EdgedCurve( EdgedCurve&& other ) noexcept;
@@ -79,8 +79,7 @@ namespace geode
                     {
                         offset *= grid.nb_vertices_in_direction( d2 );
                     }
-                    const auto value =
-                        static_cast< index_t >( std::floor( index / offset ) );
+                    const auto value = index / offset;
                     vertex_id[dimension - d - 1] = value;
                     index -= value * offset;
                 }
@@ -68,6 +68,22 @@ namespace geode
                 return points_->size();
             }
 
+            [[nodiscard]] absl::Span< const Point< dimension > >
+                points_storage() const
+            {
+                return points_->values();
+            }
+
+            [[nodiscard]] index_t first_modified_point() const
+            {
+                return points_->first_modified_value();
+            }
+
+            [[nodiscard]] index_t take_first_modified_point() const
+            {
+                return points_->take_first_modified_value();
+            }
+
             [[nodiscard]] std::string_view attribute_name() const
             {
                 return points_->name();
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#include <geode/mesh/common.hpp>
+#include <geode/mesh/core/mesh_revisions.hpp>
+
+namespace geode
+{
+    namespace internal
+    {
+        /*!
+         * Revision updated lazily: modifications only raise a flag, which
+         * may be done concurrently, and a new stamp is taken on the next
+         * read.
+         */
+        class RevisionCounter
+        {
+        public:
+            RevisionCounter() : revision_{ MeshRevisions::new_revision() } {}
+
+            void modified()
+            {
+                if( !modified_.load( std::memory_order_relaxed ) )
+                {
+                    modified_.store( true );
+                }
+            }
+
+            [[nodiscard]] std::uint64_t revision() const
+            {
+                if( modified_.load() )
+                {
+                    const std::lock_guard< std::mutex > lock{ mutex_ };
+                    if( modified_.load() )
+                    {
+                        revision_ = MeshRevisions::new_revision();
+                        modified_ = false;
+                    }
+                }
+                return revision_.load();
+            }
+
+        private:
+            mutable std::mutex mutex_;
+            mutable std::atomic< bool > modified_{ false };
+            mutable std::atomic< std::uint64_t > revision_;
+        };
+    } // namespace internal
+} // namespace geode
@@ -25,13 +25,23 @@
 
 #include <geode/mesh/core/texture2d.hpp>
 
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
+#include <async++.h>
+
 #include <geode/basic/attribute_manager.hpp>
+#include <geode/basic/bitsery_archive.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 #include <geode/basic/variable_attribute.hpp>
 
 #include <geode/geometry/point.hpp>
 
 #include <geode/image/core/raster_image.hpp>
+#include <geode/image/core/rgb_color.hpp>
+#include <geode/image/core/tiled_raster_image.hpp>
 
 namespace geode
 {
@@ -45,16 +55,62 @@ namespace geode
                 absl::InlinedVector< Point< dimension >, dimension + 1 >;
 
             const Point< dimension > DEFAULT_COORD;
+            static constexpr index_t LOADING_CHUNK_SIZE{ 4096 };
 
         public:
             [[nodiscard]] const RasterImage< dimension >& image() const
             {
+                if constexpr( dimension > 1 )
+                {
+                    if( is_image_tiled() )
+                    {
+                        return loaded_tiled_image();
+                    }
+                }
                 return image_;
             }
 
             void set_image( RasterImage< dimension >&& image )
             {
                 image_ = std::move( image );
+                set_tiled_image_file( "" );
+            }
+
+            void set_tiled_image( std::string_view filename )
+            {
+                image_ = RasterImage< dimension >{};
+                set_tiled_image_file(
+                    std::filesystem::absolute( to_string( filename ) )
+                        .lexically_normal()
+                        .string() );
+            }
+
+            [[nodiscard]] bool is_image_tiled() const
+            {
+                return !tiled_image_file_.empty();
+            }
+
+            [[nodiscard]] const TiledRasterImage< dimension >&
+                tiled_image() const
+            {
+                OPENGEODE_EXCEPTION( is_image_tiled(),
+                    "[Texture::tiled_image] The texture image is not tiled" );
+                {
+                    std::lock_guard< std::mutex > lock{ tiled_image_mutex_ };
+                    if( tiled_image_ )
+                    {
+                        return *tiled_image_;
+                    }
+                }
+                auto tiled_image =
+                    std::make_shared< TiledRasterImage< dimension > >(
+                        tiled_image_file_ );
+                std::lock_guard< std::mutex > lock{ tiled_image_mutex_ };
+                if( !tiled_image_ )
+                {
+                    tiled_image_ = std::move( tiled_image );
+                }
+                return *tiled_image_;
             }
 
         protected:
@@ -99,18 +155,151 @@ namespace geode
             template < typename Archive >
             void serialize( Archive& archive )
             {
-                archive.ext( *this, Growable< Archive, TextureImpl >{
-                                        { []( Archive& a, TextureImpl& impl ) {
-                                            a.object( impl.image_ );
-                                            a.ext( impl.coordinates_,
-                                                bitsery::ext::StdSmartPtr{} );
-                                        } } } );
+                archive.ext( *this,
+                    Growable< Archive, TextureImpl >{
+                        { []( Archive& a, TextureImpl& impl ) {
+                             a.object( impl.image_ );
+                             a.ext( impl.coordinates_,
+                                 bitsery::ext::StdSmartPtr{} );
+                         },
+                            []( Archive& a, TextureImpl& impl ) {
+                                a.object( impl.image_ );
+                                a.ext( impl.coordinates_,
+                                    bitsery::ext::StdSmartPtr{} );
+                                impl.serialize_tiled_image_file( a );
+                            } } } );
+            }
+
+            /*!
+             * The tiled image file is stored relative to the archive
+             * directory, so that both files can be moved together. Its
+             * absolute path is also stored, it is used when the relative one
+             * cannot be resolved (e.g. for archives extracted elsewhere).
+             */
+            template < typename Archive >
+            void serialize_tiled_image_file( Archive& archive )
+            {
+                const auto& directory =
+                    archive.template context< ArchiveDirectory >().directory;
+                std::string relative_file;
+                std::string absolute_file;
+                if constexpr( std::is_same_v< Archive, Serializer > )
+                {
+                    if( is_image_tiled() )
+                    {
+                        const std::filesystem::path file{ tiled_image_file_ };
+                        absolute_file = file.generic_string();
+                        relative_file = absolute_file;
+                        if( !directory.empty() )
+                        {
+                            const auto relative = file.lexically_relative(
+                                std::filesystem::absolute( directory ) );
+                            if( !relative.empty() )
+                            {
+                                relative_file = relative.generic_string();
+                            }
+                        }
+                    }
+                }
+                archive.text1b( relative_file, relative_file.max_size() );
+                archive.text1b( absolute_file, absolute_file.max_size() );
+                if constexpr( std::is_same_v< Archive, Deserializer > )
+                {
+                    if( relative_file.empty() )
+                    {
+                        tiled_image_file_.clear();
+                        return;
+                    }
+                    auto file = directory / relative_file;
+                    if( !std::filesystem::exists( file ) )
+                    {
+                        file = absolute_file;
+                    }
+                    tiled_image_file_ =
+                        std::filesystem::absolute( file )
+                            .lexically_normal()
+                            .string();
+                }
+            }
+
+            void set_tiled_image_file( std::string_view filename )
+            {
+                std::lock_guard< std::mutex > lock{ tiled_image_mutex_ };
+                tiled_image_file_ = to_string( filename );
+                tiled_image_.reset();
+                loaded_tiled_image_.reset();
+            }
+
+            /*!
+             * Full resolution level of the tiled image, read on first call.
+             * The image is read without holding the lock, concurrent first
+             * calls may read it several times but only one is kept.
+             */
+            const RasterImage< dimension >& loaded_tiled_image() const
+            {
+                const auto& tiled = tiled_image();
+                {
+                    std::lock_guard< std::mutex > lock{ tiled_image_mutex_ };
+                    if( loaded_tiled_image_ )
+                    {
+                        return *loaded_tiled_image_;
+                    }
+                }
+                auto image = read_tiled_image( tiled );
+                std::lock_guard< std::mutex > lock{ tiled_image_mutex_ };
+                if( !loaded_tiled_image_ )
+                {
+                    loaded_tiled_image_ = std::move( image );
+                }
+                return *loaded_tiled_image_;
+            }
+
+            static std::unique_ptr< RasterImage< dimension > >
+                read_tiled_image( const TiledRasterImage< dimension >& tiled )
+            {
+                std::array< index_t, dimension > cells_number;
+                for( const auto d : LRange{ dimension } )
+                {
+                    cells_number[d] = tiled.nb_cells_in_direction( 0, d );
+                }
+                auto image = std::make_unique< RasterImage< dimension > >(
+                    cells_number );
+                const auto nb_chunks =
+                    ( image->nb_cells() + LOADING_CHUNK_SIZE - 1 )
+                    / LOADING_CHUNK_SIZE;
+                async::parallel_for( async::irange( index_t{ 0 }, nb_chunks ),
+                    [&tiled, &image]( index_t chunk ) {
+                        const auto begin = chunk * LOADING_CHUNK_SIZE;
+                        const auto end = std::min(
+                            begin + LOADING_CHUNK_SIZE, image->nb_cells() );
+                        std::vector< typename TiledRasterImage<
+                            dimension >::CellIndices >
+                            cells;
+                        cells.reserve( end - begin );
+                        for( const auto cell : Range{ begin, end } )
+                        {
+                            cells.emplace_back( image->cell_indices( cell ) );
+                        }
+                        std::vector< RGBColor > colors( cells.size() );
+                        tiled.colors( 0, cells, absl::MakeSpan( colors ) );
+                        for( const auto cell : Range{ begin, end } )
+                        {
+                            image->set_color( cell, colors[cell - begin] );
+                        }
+                    } );
+                return image;
             }
 
         private:
             RasterImage< dimension > image_;
             std::shared_ptr< VariableAttribute< ElementTextureCoordinates > >
                 coordinates_;
+            std::string tiled_image_file_;
+            mutable std::mutex tiled_image_mutex_;
+            mutable std::shared_ptr< TiledRasterImage< dimension > >
+                tiled_image_;
+            mutable std::unique_ptr< RasterImage< dimension > >
+                loaded_tiled_image_;
         };
     } // namespace internal
-} // namespace geode
\ No newline at end of file
+} // namespace geode
\ No newline at end of file
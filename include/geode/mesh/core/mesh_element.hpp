@@ -67,7 +67,8 @@ namespace geode
                 *this, Growable< Archive, MeshElement >{
                            { []( Archive& a, MeshElement& mesh_element ) {
                                a.object( mesh_element.mesh_id );
-                               a.value4b( mesh_element.element_id );
+                               a.template value< INDEX_BYTES >(
+                                   mesh_element.element_id );
                            } } } );
         }
 
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <geode/mesh/common.hpp>
+
+namespace geode
+{
+    /*!
+     * Revisions of a mesh, one for each kind of modification.
+     * A revision is a stamp taken from a global counter when the mesh is
+     * modified: it only increases for a given mesh and is never shared by two
+     * modifications, even on different meshes.
+     * Data derived from a mesh (AABB trees, NNSearch, edges, mensurations...)
+     * can store these revisions when they are computed and compare them
+     * later to know in O(1) whether they are still valid.
+     */
+    struct opengeode_mesh_api MeshRevisions
+    {
+        /*!
+         * Return a new stamp, greater than all the previous ones.
+         */
+        [[nodiscard]] static std::uint64_t new_revision();
+
+        /*!
+         * Aggregate the revisions of another mesh, keeping the latest ones.
+         */
+        void add( const MeshRevisions& other );
+
+        [[nodiscard]] bool operator==( const MeshRevisions& other ) const;
+
+        [[nodiscard]] bool operator!=( const MeshRevisions& other ) const;
+
+        /*!
+         * Updated when the vertex coordinates are modified.
+         */
+        std::uint64_t geometry{ 0 };
+        /*!
+         * Updated when elements are created, deleted, permuted or when their
+         * vertices or adjacencies are modified.
+         */
+        std::uint64_t connectivity{ 0 };
+        /*!
+         * Updated when the element attributes are resized, permuted or
+         * copied, or when a builder is notified of attribute modifications.
+         */
+        std::uint64_t attribute{ 0 };
+        /*!
+         * Number of meshes aggregated in these revisions.
+         */
+        index_t nb_meshes{ 1 };
+    };
+} // namespace geode
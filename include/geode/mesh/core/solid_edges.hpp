@@ -55,6 +55,13 @@ namespace geode
         static constexpr auto dim = dimension;
 
         SolidEdges();
+        /*!
+         * Build the edges of all the polyhedra in parallel.
+         * Until the first modification, edges are found from their vertices
+         * by binary search in a sorted array instead of a hash map, which
+         * uses much less memory. The hash map is built on the first
+         * modification.
+         */
         explicit SolidEdges( const SolidMesh< dimension >& solid );
         ~SolidEdges();
 
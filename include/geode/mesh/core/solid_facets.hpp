@@ -49,6 +49,13 @@ namespace geode
         static constexpr auto dim = dimension;
 
         SolidFacets();
+        /*!
+         * Build the facets of all the polyhedra in parallel.
+         * Until the first modification, facets are found from their vertices
+         * by binary search in a sorted array instead of a hash map, which
+         * uses much less memory. The hash map is built on the first
+         * modification.
+         */
         explicit SolidFacets( const SolidMesh< dimension >& solid );
         ~SolidFacets();
 
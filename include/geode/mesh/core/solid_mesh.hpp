@@ -585,6 +585,12 @@ namespace geode
          */
         [[nodiscard]] BoundingBox< dimension > bounding_box() const;
 
+        /*!
+         * Revisions of the mesh, the geometry one including the vertex
+         * coordinate modifications.
+         */
+        [[nodiscard]] MeshRevisions revisions() const override;
+
         /*!
          * Return one polyhedron with one of the vertices matching given vertex.
          * @param[in] vertex_id Index of the vertex.
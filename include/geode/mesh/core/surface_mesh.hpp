@@ -435,6 +435,12 @@ namespace geode
          */
         [[nodiscard]] BoundingBox< dimension > bounding_box() const;
 
+        /*!
+         * Revisions of the mesh, the geometry one including the vertex
+         * coordinate modifications.
+         */
+        [[nodiscard]] MeshRevisions revisions() const override;
+
         /*!
          * Return one polygon with one of the vertices matching given vertex.
          * @param[in] vertex_id Index of the vertex.
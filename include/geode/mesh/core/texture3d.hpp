@@ -33,8 +33,10 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( Point );
     FORWARD_DECLARATION_DIMENSION_CLASS( RasterImage );
     FORWARD_DECLARATION_DIMENSION_CLASS( Texture );
+    FORWARD_DECLARATION_DIMENSION_CLASS( TiledRasterImage );
     ALIAS_3D( Point );
     ALIAS_3D( RasterImage );
+    ALIAS_3D( TiledRasterImage );
     class AttributeManager;
 } // namespace geode
 
@@ -55,6 +57,23 @@ namespace geode
 
         void set_image( RasterImage3D&& image );
 
+        /*!
+         * Use an image saved by save_tiled_raster_image instead of an image
+         * held in memory. Only the file name is saved with the mesh, relative
+         * to the mesh file, so loading the mesh does not read the image: tiles
+         * are read on demand through tiled_image(), and image() reads the full
+         * resolution level on its first call.
+         */
+        void set_tiled_image( std::string_view filename );
+
+        [[nodiscard]] bool is_image_tiled() const;
+
+        /*!
+         * Tiled image, opened on first access.
+         * @exception OpenGeodeException if the texture image is not tiled.
+         */
+        [[nodiscard]] const TiledRasterImage3D& tiled_image() const;
+
         [[nodiscard]] const Point3D& texture_coordinates(
             const PolyhedronVertex& vertex ) const;
 
@@ -71,4 +90,4 @@ namespace geode
         IMPLEMENTATION_MEMBER( impl_ );
     };
     ALIAS_3D( Texture );
-} // namespace geode
\ No newline at end of file
+} // namespace geode
\ No newline at end of file
@@ -24,10 +24,12 @@
 #pragma once
 
 #include <geode/basic/identifier.hpp>
+#include <geode/basic/passkey.hpp>
 #include <geode/basic/pimpl.hpp>
 
 #include <geode/mesh/common.hpp>
 #include <geode/mesh/core/mesh_id.hpp>
+#include <geode/mesh/core/mesh_revisions.hpp>
 
 namespace geode
 {
@@ -43,6 +45,7 @@ namespace geode
     class opengeode_mesh_api VertexSet : public Identifier
     {
         OPENGEODE_DISABLE_COPY( VertexSet );
+        PASSKEY( VertexSetBuilder, VertexSetBuilderKey );
         friend class bitsery::Access;
 
     public:
@@ -80,6 +83,19 @@ namespace geode
 
         [[nodiscard]] virtual MeshType type_name() const = 0;
 
+        /*!
+         * Revisions of the mesh, updated by the builders each time the mesh
+         * is modified.
+         */
+        [[nodiscard]] virtual MeshRevisions revisions() const;
+
+    public:
+        void update_geometry_revision( VertexSetBuilderKey );
+
+        void update_connectivity_revision( VertexSetBuilderKey );
+
+        void update_attribute_revision( VertexSetBuilderKey );
+
     protected:
         VertexSet();
         VertexSet( VertexSet&& other ) noexcept;
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <async++.h>
+
+#include <geode/basic/attribute.hpp>
+#include <geode/basic/attribute_manager.hpp>
+#include <geode/basic/variable_attribute.hpp>
+
+#include <geode/mesh/common.hpp>
+#include <geode/mesh/core/adaptive_grid.hpp>
+
+namespace geode
+{
+    /*!
+     * Compute a cell attribute on every level of the adaptive grid, one
+     * allocated cell at a time. No value is stored on the finest grid, so
+     * memory follows the number of allocated cells.
+     * Cells are processed in parallel, the sampler must be thread-safe.
+     * @param[in] sampler Function called as sampler( cell ) for each
+     * allocated AdaptiveGrid::Cell, returning its value.
+     * @param[in] attribute_name Name of the attribute to create or update on
+     * every level.
+     * @param[in] default_value Default value of the created attributes.
+     */
+    template < typename T, index_t dimension, typename CellSampler >
+    void sample_cell_attribute( const AdaptiveGrid< dimension >& grid,
+        const CellSampler& sampler,
+        std::string_view attribute_name,
+        T default_value )
+    {
+        for( const auto level : LRange{ grid.nb_levels() } )
+        {
+            auto attribute =
+                grid.cell_attribute_manager( level )
+                    .template find_or_create_attribute< VariableAttribute, T >(
+                        attribute_name, default_value );
+            async::parallel_for(
+                async::irange( index_t{ 0 }, grid.nb_cells( level ) ),
+                [&grid, &sampler, &attribute, level]( index_t cell_id ) {
+                    attribute->set_value(
+                        cell_id, sampler( grid.cell( level, cell_id ) ) );
+                } );
+        }
+    }
+
+    /*!
+     * Store a cell attribute of the finest grid (e.g. the result of
+     * euclidean_distance_transform on AdaptiveGrid::finest_grid()) on every
+     * level of the adaptive grid. Each allocated cell takes the value of its
+     * central finest cell.
+     * This requires a value for every finest cell, prefer
+     * sample_cell_attribute when the values can be computed per cell.
+     * @param[in] finest_attribute Cell attribute of the finest grid.
+     * @param[in] attribute_name Name of the attribute to create or update on
+     * every level.
+     * @param[in] default_value Default value of the created attributes.
+     */
+    template < typename T, index_t dimension >
+    void sample_finest_cell_attribute( const AdaptiveGrid< dimension >& grid,
+        const ReadOnlyAttribute< T >& finest_attribute,
+        std::string_view attribute_name,
+        T default_value );
+} // namespace geode
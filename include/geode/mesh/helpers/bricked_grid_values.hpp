@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include <geode/basic/attribute.hpp>
+#include <geode/basic/range.hpp>
+#include <geode/basic/variable_attribute.hpp>
+
+#include <geode/mesh/common.hpp>
+#include <geode/mesh/core/grid.hpp>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( Grid );
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Cache-blocked (bricked) ordering of the elements of a grid.
+     * Elements are grouped into cubic bricks of brick_size^dimension
+     * elements, each brick being stored contiguously with the first direction
+     * varying fastest. Bricks are themselves ordered with the first direction
+     * varying fastest. Compared to the linear ordering used by
+     * Grid::cell_index and Grid::vertex_index, neighbors along every direction
+     * are close in memory, which benefits stencils and directional sweeps.
+     * The brick size must be a power of two, bricks on the grid borders are
+     * padded.
+     */
+    template < index_t dimension >
+    class GridBrickLayout
+    {
+    public:
+        using ElementIndices = std::array< index_t, dimension >;
+
+        static constexpr index_t DEFAULT_BRICK_SIZE{ 8 };
+
+        GridBrickLayout(
+            ElementIndices nb_elements_in_direction, index_t brick_size )
+            : nb_elements_( std::move( nb_elements_in_direction ) ),
+              brick_size_( brick_size )
+        {
+            OPENGEODE_EXCEPTION(
+                brick_size_ != 0 && ( brick_size_ & ( brick_size_ - 1 ) ) == 0,
+                "[GridBrickLayout] Brick size should be a power of two" );
+            while( ( index_t{ 1 } << brick_size_log2_ ) < brick_size_ )
+            {
+                brick_size_log2_++;
+            }
+            brick_mask_ = brick_size_ - 1;
+            brick_volume_ = 1;
+            nb_bricks_ = 1;
+            for( const auto d : LRange{ dimension } )
+            {
+                nb_bricks_in_direction_[d] =
+                    ( nb_elements_[d] + brick_mask_ ) >> brick_size_log2_;
+                brick_volume_ *= brick_size_;
+                nb_bricks_ *= nb_bricks_in_direction_[d];
+            }
+        }
+
+        [[nodiscard]] index_t brick_size() const
+        {
+            return brick_size_;
+        }
+
+        [[nodiscard]] index_t brick_volume() const
+        {
+            return brick_volume_;
+        }
+
+        [[nodiscard]] index_t nb_bricks() const
+        {
+            return nb_bricks_;
+        }
+
+        [[nodiscard]] index_t nb_bricks_in_direction( index_t direction ) const
+        {
+            return nb_bricks_in_direction_[direction];
+        }
+
+        [[nodiscard]] index_t nb_elements_in_direction(
+            index_t direction ) const
+        {
+            return nb_elements_[direction];
+        }
+
+        /*!
+         * Number of values to store, including brick padding.
+         */
+        [[nodiscard]] index_t nb_storage_values() const
+        {
+            return nb_bricks_ * brick_volume_;
+        }
+
+        /*!
+         * Index of the element in the bricked storage.
+         */
+        [[nodiscard]] index_t storage_index(
+            const ElementIndices& indices ) const
+        {
+            index_t brick{ 0 };
+            index_t local{ 0 };
+            index_t brick_offset{ 1 };
+            for( const auto d : LRange{ dimension } )
+            {
+                OPENGEODE_ASSERT( indices[d] < nb_elements_[d],
+                    "[GridBrickLayout::storage_index] Invalid index" );
+                brick += ( indices[d] >> brick_size_log2_ ) * brick_offset;
+                local += ( indices[d] & brick_mask_ )
+                         << ( d * brick_size_log2_ );
+                brick_offset *= nb_bricks_in_direction_[d];
+            }
+            return brick * brick_volume_ + local;
+        }
+
+        /*!
+         * Index of the element in the linear ordering used by
+         * Grid::cell_index and Grid::vertex_index.
+         */
+        [[nodiscard]] index_t linear_index(
+            const ElementIndices& indices ) const
+        {
+            index_t index{ 0 };
+            index_t offset{ 1 };
+            for( const auto d : LRange{ dimension } )
+            {
+                index += indices[d] * offset;
+                offset *= nb_elements_[d];
+            }
+            return index;
+        }
+
+        [[nodiscard]] ElementIndices brick_indices( index_t brick ) const
+        {
+            OPENGEODE_ASSERT( brick < nb_bricks_,
+                "[GridBrickLayout::brick_indices] Invalid brick" );
+            ElementIndices result;
+            for( const auto d : LRange{ dimension } )
+            {
+                result[d] = brick % nb_bricks_in_direction_[d];
+                brick /= nb_bricks_in_direction_[d];
+            }
+            return result;
+        }
+
+        /*!
+         * Iterate over the grid elements of a brick, ignoring padding.
+         * @param[in] action Function called as action( indices, storage_index )
+         * for each element of the brick, in storage order.
+         */
+        template < typename Action >
+        void for_each_element_in_brick( index_t brick, Action&& action ) const
+        {
+            const auto origin = brick_indices( brick );
+            ElementIndices begin;
+            ElementIndices end;
+            for( const auto d : LRange{ dimension } )
+            {
+                begin[d] = origin[d] << brick_size_log2_;
+                end[d] = std::min( begin[d] + brick_size_, nb_elements_[d] );
+            }
+            const auto brick_start = brick * brick_volume_;
+            auto indices = begin;
+            while( true )
+            {
+                index_t local{ 0 };
+                for( const auto d : LRange{ dimension } )
+                {
+                    local += ( indices[d] - begin[d] )
+                             << ( d * brick_size_log2_ );
+                }
+                action( static_cast< const ElementIndices& >( indices ),
+                    brick_start + local );
+                local_index_t d{ 0 };
+                for( ; d < dimension; d++ )
+                {
+                    if( ++indices[d] < end[d] )
+                    {
+                        break;
+                    }
+                    indices[d] = begin[d];
+                }
+                if( d == dimension )
+                {
+                    return;
+                }
+            }
+        }
+
+    private:
+        ElementIndices nb_elements_;
+        ElementIndices nb_bricks_in_direction_;
+        index_t brick_size_;
+        index_t brick_size_log2_{ 0 };
+        index_t brick_mask_{ 0 };
+        index_t brick_volume_{ 1 };
+        index_t nb_bricks_{ 1 };
+    };
+    ALIAS_2D_AND_3D( GridBrickLayout );
+
+    template < index_t dimension >
+    [[nodiscard]] GridBrickLayout< dimension > grid_cell_brick_layout(
+        const Grid< dimension >& grid,
+        index_t brick_size = GridBrickLayout< dimension >::DEFAULT_BRICK_SIZE )
+    {
+        typename GridBrickLayout< dimension >::ElementIndices nb_cells;
+        for( const auto d : LRange{ dimension } )
+        {
+            nb_cells[d] = grid.nb_cells_in_direction( d );
+        }
+        return { nb_cells, brick_size };
+    }
+
+    template < index_t dimension >
+    [[nodiscard]] GridBrickLayout< dimension > grid_vertex_brick_layout(
+        const Grid< dimension >& grid,
+        index_t brick_size = GridBrickLayout< dimension >::DEFAULT_BRICK_SIZE )
+    {
+        typename GridBrickLayout< dimension >::ElementIndices nb_vertices;
+        for( const auto d : LRange{ dimension } )
+        {
+            nb_vertices[d] = grid.nb_vertices_in_direction( d );
+        }
+        return { nb_vertices, brick_size };
+    }
+
+    /*!
+     * Grid cell or vertex values stored following a GridBrickLayout.
+     * This is a working storage: values are imported from and exported to
+     * regular grid attributes, which keep the linear ordering.
+     */
+    template < typename T, index_t dimension >
+    class BrickedGridValues
+    {
+    public:
+        using ElementIndices =
+            typename GridBrickLayout< dimension >::ElementIndices;
+
+        BrickedGridValues(
+            GridBrickLayout< dimension > layout, T default_value )
+            : layout_( std::move( layout ) ),
+              values_( layout_.nb_storage_values(), default_value )
+        {
+        }
+
+        [[nodiscard]] const GridBrickLayout< dimension >& layout() const
+        {
+            return layout_;
+        }
+
+        [[nodiscard]] const T& value( const ElementIndices& indices ) const
+        {
+            return values_[layout_.storage_index( indices )];
+        }
+
+        void set_value( const ElementIndices& indices, T value )
+        {
+            values_[layout_.storage_index( indices )] = std::move( value );
+        }
+
+        template < typename Modifier >
+        void modify_value( const ElementIndices& indices, Modifier&& modifier )
+        {
+            modifier( values_[layout_.storage_index( indices )] );
+        }
+
+        [[nodiscard]] const T& storage_value( index_t storage_index ) const
+        {
+            return values_[storage_index];
+        }
+
+        void set_storage_value( index_t storage_index, T value )
+        {
+            values_[storage_index] = std::move( value );
+        }
+
+        /*!
+         * Copy values from an attribute using the linear grid ordering.
+         * Bricks are processed in parallel.
+         */
+        void import_values( const ReadOnlyAttribute< T >& attribute );
+
+        /*!
+         * Copy values into an attribute using the linear grid ordering.
+         * Bricks are processed in parallel.
+         */
+        void export_values( VariableAttribute< T >& attribute ) const;
+
+    private:
+        GridBrickLayout< dimension > layout_;
+        std::vector< T > values_;
+    };
+} // namespace geode
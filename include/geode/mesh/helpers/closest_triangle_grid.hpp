@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#pragma once
+
+#include <tuple>
+#include <vector>
+
+#include <absl/types/span.h>
+
+#include <geode/basic/pimpl.hpp>
+
+#include <geode/mesh/common.hpp>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( LightRegularGrid );
+    FORWARD_DECLARATION_DIMENSION_CLASS( Point );
+    FORWARD_DECLARATION_DIMENSION_CLASS( TriangulatedSurface );
+    ALIAS_3D( LightRegularGrid );
+    ALIAS_3D( Point );
+    ALIAS_3D( TriangulatedSurface );
+} // namespace geode
+
+namespace geode
+{
+    struct ClosestTriangleGridParameters
+    {
+        /*!
+         * Maximum number of grid cells, it bounds the build time and the
+         * memory used by the offsets.
+         */
+        index_t max_nb_cells{ 1 << 18 };
+
+        /*!
+         * Maximum number of candidate triangles stored in a cell. Queries in
+         * cells exceeding it fall back on the surface AABB tree.
+         */
+        index_t max_nb_candidates{ 32 };
+    };
+
+    /*!
+     * Acceleration structure answering closest triangle queries against a
+     * static surface.
+     * A LightRegularGrid3D covers the surface bounding box, and each cell
+     * stores the triangles that may be the closest to any point of the cell:
+     * the ones closer to the cell center than the center closest distance
+     * plus the cell diagonal. A query then only evaluates the candidates of
+     * its cell instead of descending the AABB tree. Queries outside the grid
+     * or in cells with too many candidates use the AABB tree.
+     * The surface must outlive this object and must not be modified.
+     */
+    class opengeode_mesh_api ClosestTriangleGrid
+    {
+        OPENGEODE_DISABLE_COPY( ClosestTriangleGrid );
+
+    public:
+        /*!
+         * Build the candidate lists, cells are processed in parallel.
+         */
+        explicit ClosestTriangleGrid( const TriangulatedSurface3D& surface,
+            const ClosestTriangleGridParameters& parameters = {} );
+        ClosestTriangleGrid( ClosestTriangleGrid&& other ) noexcept;
+        ~ClosestTriangleGrid();
+
+        [[nodiscard]] const LightRegularGrid3D& grid() const;
+
+        /*!
+         * Number of cells answered by their candidates, the others use the
+         * AABB tree.
+         */
+        [[nodiscard]] index_t nb_accelerated_cells() const;
+
+        /*!
+         * Return the closest triangle to the query and its distance.
+         * If several triangles are equally close, any of them may be
+         * returned.
+         */
+        [[nodiscard]] std::tuple< index_t, double > closest_triangle(
+            const Point3D& query ) const;
+
+        /*!
+         * Compute closest_triangle of each query in parallel.
+         */
+        [[nodiscard]] std::vector< std::tuple< index_t, double > >
+            closest_triangles( absl::Span< const Point3D > queries ) const;
+
+    private:
+        IMPLEMENTATION_MEMBER( impl_ );
+    };
+} // namespace geode
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <geode/basic/pimpl.hpp>
+
+#include <geode/mesh/common.hpp>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( Point );
+    FORWARD_DECLARATION_DIMENSION_CLASS( TriangulatedSurface );
+    FORWARD_DECLARATION_DIMENSION_CLASS( TetrahedralSolid );
+    ALIAS_3D( TetrahedralSolid );
+    struct PolygonVertex;
+    struct PolygonEdge;
+    struct PolyhedronVertex;
+    struct PolyhedronFacet;
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Read-only compressed copy of a TriangulatedSurface.
+     * Triangles are stored by blocks of BLOCK_SIZE: in each block, vertex
+     * indices are delta-coded from the smallest vertex of the block and
+     * adjacencies are stored as a delta to the triangle index together with
+     * the local edge index in the adjacent triangle, all bit-packed with the
+     * smallest width fitting the block. Decoding an element is a constant time
+     * operation. Compression is the most effective when neighboring triangles
+     * have close indices and close vertex indices, see
+     * sort_triangulated_surface_spatially.
+     * Points are stored uncompressed, attributes are not stored.
+     */
+    template < index_t dimension >
+    class CompressedTriangulatedSurface
+    {
+        OPENGEODE_DISABLE_COPY( CompressedTriangulatedSurface );
+
+    public:
+        static constexpr index_t BLOCK_SIZE{ 64 };
+
+        explicit CompressedTriangulatedSurface(
+            const TriangulatedSurface< dimension >& surface );
+        CompressedTriangulatedSurface(
+            CompressedTriangulatedSurface&& other ) noexcept;
+        ~CompressedTriangulatedSurface();
+
+        [[nodiscard]] index_t nb_vertices() const;
+
+        [[nodiscard]] index_t nb_polygons() const;
+
+        [[nodiscard]] const Point< dimension >& point(
+            index_t vertex_id ) const;
+
+        [[nodiscard]] index_t polygon_vertex(
+            const PolygonVertex& polygon_vertex ) const;
+
+        [[nodiscard]] std::array< index_t, 3 > polygon_vertices(
+            index_t polygon_id ) const;
+
+        [[nodiscard]] std::optional< index_t > polygon_adjacent(
+            const PolygonEdge& polygon_edge ) const;
+
+        [[nodiscard]] std::optional< PolygonEdge > polygon_adjacent_edge(
+            const PolygonEdge& polygon_edge ) const;
+
+        /*!
+         * Number of bytes used to store the triangle vertices and adjacencies.
+         */
+        [[nodiscard]] index_t connectivity_nb_bytes() const;
+
+        /*!
+         * Create a regular TriangulatedSurface with the same points,
+         * triangles and adjacencies.
+         */
+        [[nodiscard]] std::unique_ptr< TriangulatedSurface< dimension > >
+            decompress() const;
+
+    private:
+        IMPLEMENTATION_MEMBER( impl_ );
+    };
+    ALIAS_2D_AND_3D( CompressedTriangulatedSurface );
+
+    /*!
+     * Read-only compressed copy of a TetrahedralSolid.
+     * Same storage as CompressedTriangulatedSurface, applied to tetrahedra
+     * and their facet adjacencies.
+     * @see sort_tetrahedral_solid_spatially
+     */
+    template < index_t dimension >
+    class CompressedTetrahedralSolid
+    {
+        OPENGEODE_DISABLE_COPY( CompressedTetrahedralSolid );
+
+    public:
+        static constexpr index_t BLOCK_SIZE{ 64 };
+
+        explicit CompressedTetrahedralSolid(
+            const TetrahedralSolid< dimension >& solid );
+        CompressedTetrahedralSolid(
+            CompressedTetrahedralSolid&& other ) noexcept;
+        ~CompressedTetrahedralSolid();
+
+        [[nodiscard]] index_t nb_vertices() const;
+
+        [[nodiscard]] index_t nb_polyhedra() const;
+
+        [[nodiscard]] const Point< dimension >& point(
+            index_t vertex_id ) const;
+
+        [[nodiscard]] index_t polyhedron_vertex(
+            const PolyhedronVertex& polyhedron_vertex ) const;
+
+        [[nodiscard]] std::array< index_t, 4 > polyhedron_vertices(
+            index_t polyhedron_id ) const;
+
+        [[nodiscard]] std::optional< index_t > polyhedron_adjacent(
+            const PolyhedronFacet& polyhedron_facet ) const;
+
+        [[nodiscard]] std::optional< PolyhedronFacet >
+            polyhedron_adjacent_facet(
+                const PolyhedronFacet& polyhedron_facet ) const;
+
+        /*!
+         * Number of bytes used to store the tetrahedron vertices and
+         * adjacencies.
+         */
+        [[nodiscard]] index_t connectivity_nb_bytes() const;
+
+        /*!
+         * Create a regular TetrahedralSolid with the same points, tetrahedra
+         * and adjacencies.
+         */
+        [[nodiscard]] std::unique_ptr< TetrahedralSolid< dimension > >
+            decompress() const;
+
+    private:
+        IMPLEMENTATION_MEMBER( impl_ );
+    };
+    ALIAS_3D( CompressedTetrahedralSolid );
+
+    struct SpatialSortMappings
+    {
+        std::vector< index_t > vertices;
+        std::vector< index_t > elements;
+    };
+
+    /*!
+     * Permute the vertices and the triangles of the surface following the
+     * Morton order of the points and of the triangle barycenters.
+     * @return the mappings between old vertex and triangle indices to new ones
+     */
+    template < index_t dimension >
+    SpatialSortMappings sort_triangulated_surface_spatially(
+        TriangulatedSurface< dimension >& surface );
+
+    /*!
+     * Permute the vertices and the tetrahedra of the solid following the
+     * Morton order of the points and of the tetrahedron barycenters.
+     * @return the mappings between old vertex and tetrahedron indices to new
+     * ones
+     */
+    SpatialSortMappings opengeode_mesh_api sort_tetrahedral_solid_spatially(
+        TetrahedralSolid3D& solid );
+} // namespace geode
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <absl/strings/str_cat.h>
+#include <absl/types/span.h>
+
+#include <geode/mesh/common.hpp>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( SolidMesh );
+    FORWARD_DECLARATION_DIMENSION_CLASS( SurfaceMesh );
+    ALIAS_3D( SolidMesh );
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Element quality metrics.
+     * - size: polygon area or polyhedron volume (lower is worse).
+     * - aspect_ratio: tetrahedron_aspect_ratio (higher is worse).
+     * - volume_to_edge_ratio: tetrahedron_volume_to_edge_ratio (lower is
+     * worse).
+     * - collapse_aspect_ratio: tetrahedron_collapse_aspect_ratio (higher is
+     * worse).
+     * Tetrahedron metrics are only defined on solids, non-tetrahedral
+     * polyhedra are skipped.
+     */
+    enum struct QUALITY_METRIC
+    {
+        size,
+        aspect_ratio,
+        volume_to_edge_ratio,
+        collapse_aspect_ratio
+    };
+
+    [[nodiscard]] bool opengeode_mesh_api is_lower_quality_worse(
+        QUALITY_METRIC metric );
+
+    struct opengeode_mesh_api QualityReportParameters
+    {
+        index_t nb_histogram_bins{ 10 };
+        /*!
+         * Requested percentiles, in [0, 1]
+         */
+        std::vector< double > percentiles{ 0.01, 0.5, 0.99 };
+        index_t nb_worst_elements{ 10 };
+        /*!
+         * If not empty, the metric values are stored in an element attribute
+         * of this name. Skipped elements get NaN.
+         */
+        std::string attribute_name;
+    };
+
+    /*!
+     * Statistics of a quality metric over a set of elements.
+     * Degenerate elements, whose value is infinite or the
+     * std::numeric_limits< double >::max() returned by the metrics for flat
+     * tetrahedra, are only counted in nb_degenerate_elements: they are
+     * excluded from the other statistics but they are still candidates for
+     * the worst elements.
+     * Histogram bins evenly split [min, max].
+     * Worst elements are sorted from the worst.
+     */
+    template < typename Element >
+    struct QualityReport
+    {
+        [[nodiscard]] std::string string() const
+        {
+            auto message = absl::StrCat( nb_elements, " elements, min ", min,
+                ", max ", max, ", mean ", mean );
+            if( nb_degenerate_elements != 0 )
+            {
+                absl::StrAppend(
+                    &message, ", ", nb_degenerate_elements, " degenerate" );
+            }
+            for( const auto& [percentile, value] : percentiles )
+            {
+                absl::StrAppend(
+                    &message, ", p", percentile * 100, " ", value );
+            }
+            return message;
+        }
+
+        index_t nb_elements{ 0 };
+        index_t nb_degenerate_elements{ 0 };
+        double min{ 0 };
+        double max{ 0 };
+        double mean{ 0 };
+        std::vector< std::pair< double, double > > percentiles;
+        std::vector< index_t > histogram;
+        std::vector< std::pair< Element, double > > worst_elements;
+    };
+    using MeshQualityReport = QualityReport< index_t >;
+
+    /*!
+     * Compute the statistics of per-element values in parallel.
+     * NaN values are ignored, degenerate values are counted apart.
+     * @param[in] lower_is_worse Order used to select the worst elements.
+     */
+    [[nodiscard]] MeshQualityReport opengeode_mesh_api quality_report(
+        absl::Span< const double > values,
+        bool lower_is_worse,
+        const QualityReportParameters& parameters );
+
+    /*!
+     * Compute the metric of every polyhedron in parallel.
+     * @return One value per polyhedron, NaN if the metric does not apply.
+     */
+    [[nodiscard]] std::vector< double > opengeode_mesh_api
+        solid_quality_values( const SolidMesh3D& mesh, QUALITY_METRIC metric );
+
+    /*!
+     * Compute the metric of every polygon in parallel.
+     * @return One value per polygon, NaN if the metric does not apply.
+     */
+    template < index_t dimension >
+    [[nodiscard]] std::vector< double > surface_quality_values(
+        const SurfaceMesh< dimension >& mesh, QUALITY_METRIC metric );
+
+    [[nodiscard]] MeshQualityReport opengeode_mesh_api solid_quality_report(
+        const SolidMesh3D& mesh,
+        QUALITY_METRIC metric,
+        const QualityReportParameters& parameters = {} );
+
+    template < index_t dimension >
+    [[nodiscard]] MeshQualityReport surface_quality_report(
+        const SurfaceMesh< dimension >& mesh,
+        QUALITY_METRIC metric,
+        const QualityReportParameters& parameters = {} );
+} // namespace geode
@@ -23,9 +23,12 @@
 
 #pragma once
 
-#include <geode/mesh/common.hpp>
-
 #include <geode/geometry/nn_search.hpp>
+#include <geode/geometry/point.hpp>
+
+#include <geode/mesh/common.hpp>
+#include <geode/mesh/core/coordinate_reference_system.hpp>
+#include <geode/mesh/core/coordinate_reference_system_manager.hpp>
 
 namespace geode
 {
@@ -41,4 +44,55 @@ namespace geode
         }
         return NNSearch< dimension >{ std::move( points ) };
     }
+
+    /*!
+     * Return the mesh points as a contiguous span when the active coordinate
+     * reference system stores them this way, an empty span otherwise.
+     */
+    template < template < index_t > class Mesh, index_t dimension >
+    [[nodiscard]] absl::Span< const Point< dimension > > mesh_points_storage(
+        const Mesh< dimension >& mesh )
+    {
+        const auto storage = mesh.main_coordinate_reference_system_manager()
+                                 .active_coordinate_reference_system()
+                                 .points_storage();
+        if( storage.size() < mesh.nb_vertices() )
+        {
+            return {};
+        }
+        return storage.subspan( 0, mesh.nb_vertices() );
+    }
+
+    /*!
+     * Create a NNSearch reading the mesh points in place, without copying
+     * them, when the active coordinate reference system stores them
+     * contiguously. Otherwise, points are copied as in create_nn_search.
+     * The mesh must outlive the NNSearch and its points must not be modified.
+     */
+    template < template < index_t > class Mesh, index_t dimension >
+    [[nodiscard]] NNSearch< dimension > create_nn_search_view(
+        const Mesh< dimension >& mesh )
+    {
+        const auto storage = mesh_points_storage( mesh );
+        if( storage.empty() && mesh.nb_vertices() != 0 )
+        {
+            return create_nn_search( mesh );
+        }
+        return NNSearch< dimension >::create_view( storage );
+    }
+
+    /*!
+     * Load a NNSearch saved with NNSearch::save_index, reading the mesh points
+     * in place. The mesh points must be the ones used to build the saved
+     * index and stored contiguously.
+     */
+    template < template < index_t > class Mesh, index_t dimension >
+    [[nodiscard]] NNSearch< dimension > load_nn_search_view(
+        const Mesh< dimension >& mesh, std::string_view index_filename )
+    {
+        const auto storage = mesh_points_storage( mesh );
+        OPENGEODE_EXCEPTION( !storage.empty() || mesh.nb_vertices() == 0,
+            "[load_nn_search_view] Mesh points are not stored contiguously" );
+        return NNSearch< dimension >::load_view( storage, index_filename );
+    }
 } // namespace geode
\ No newline at end of file
@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <geode/basic/variable_attribute.hpp>
+
 #include <geode/mesh/common.hpp>
 #include <geode/mesh/core/grid.hpp>
 
@@ -30,9 +32,11 @@ namespace geode
 {
     FORWARD_DECLARATION_DIMENSION_CLASS( Grid );
     FORWARD_DECLARATION_DIMENSION_CLASS( Segment );
+    FORWARD_DECLARATION_DIMENSION_CLASS( TetrahedralSolid );
     FORWARD_DECLARATION_DIMENSION_CLASS( Triangle );
     FORWARD_DECLARATION_DIMENSION_CLASS( TriangulatedSurface );
     ALIAS_3D( Grid );
+    ALIAS_3D( TetrahedralSolid );
     ALIAS_3D( TriangulatedSurface );
     class Tetrahedron;
 } // namespace geode
@@ -54,6 +58,30 @@ namespace geode
         conservative_rasterize_triangle( const Grid< dimension >& grid,
             const Triangle< dimension >& triangle );
 
+    /*!
+     * Conservative rasterization of all the triangles of a surface.
+     * Triangles are rasterized in parallel into a shared cell mask.
+     * @return The painted cells, sorted by increasing cell index.
+     */
+    template < index_t dimension >
+    [[nodiscard]] std::vector< typename Grid< dimension >::CellIndices >
+        conservative_rasterize_surface( const Grid< dimension >& grid,
+            const TriangulatedSurface< dimension >& surface );
+
+    /*!
+     * Conservative rasterization of all the triangles of a surface, stored
+     * in a grid cell attribute. Each painted cell stores the smallest index
+     * of the triangles painting it, other cells store NO_ID.
+     * Triangles are rasterized in parallel.
+     * @param[in] attribute_name Name of the cell attribute to create or
+     * update.
+     */
+    template < index_t dimension >
+    [[nodiscard]] std::shared_ptr< VariableAttribute< index_t > >
+        conservative_rasterize_surface_owners( const Grid< dimension >& grid,
+            const TriangulatedSurface< dimension >& surface,
+            std::string_view attribute_name );
+
     [[nodiscard]] std::vector< typename Grid3D::CellIndices >
         opengeode_mesh_api rasterize_tetrahedron(
             const Grid3D& grid, const Tetrahedron& tetrahedron );
@@ -61,4 +89,14 @@ namespace geode
     [[nodiscard]] std::vector< Grid3D::CellIndices >
         opengeode_mesh_api rasterize_closed_surface(
             const Grid3D& grid, const TriangulatedSurface3D& closed_surface );
+
+    /*!
+     * Rasterization of all the tetrahedra of a solid, as given by
+     * rasterize_tetrahedron. Tetrahedra are rasterized in parallel into a
+     * shared cell mask.
+     * @return The painted cells, sorted by increasing cell index.
+     */
+    [[nodiscard]] std::vector< Grid3D::CellIndices >
+        opengeode_mesh_api rasterize_solid(
+            const Grid3D& grid, const TetrahedralSolid3D& solid );
 } // namespace geode
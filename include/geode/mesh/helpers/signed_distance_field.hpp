@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <geode/basic/variable_attribute.hpp>
+
+#include <geode/mesh/common.hpp>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( Grid );
+    FORWARD_DECLARATION_DIMENSION_CLASS( TriangulatedSurface );
+    ALIAS_3D( Grid );
+    ALIAS_3D( TriangulatedSurface );
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Compute the signed distance field of a closed surface at the grid cell
+     * centers. Distances are negative inside the surface and positive
+     * outside.
+     * Distances are exact in a narrow band around the surface, computed using
+     * the surface AABB. They are then propagated outward by jump flooding of
+     * the closest triangles, each cell storing the exact distance to one of
+     * the triangles propagated from its neighbors. The sign is given by
+     * rasterize_closed_surface, except for the cells crossed by the surface
+     * where it is given by the normal of their closest triangle. Every step
+     * is done in parallel.
+     *
+     * @param[in] grid Grid on which the distance field is computed. The
+     * surface should be included in the grid.
+     * @param[in] closed_surface Closed surface with outward triangle normals.
+     * @param[in] distance_map_name Name of the cell attribute storing the
+     * field.
+     * @param[in] narrow_band_width Number of cells around the cells crossed
+     * by the surface in which distances are computed exactly.
+     * @exception OpenGeodeException if the attribute named \param
+     * distance_map_name cannot be accessed.
+     * @return the created attribute
+     */
+    [[nodiscard]] std::shared_ptr< VariableAttribute< double > >
+        opengeode_mesh_api signed_distance_field( const Grid3D& grid,
+            const TriangulatedSurface3D& closed_surface,
+            std::string_view distance_map_name,
+            index_t narrow_band_width = 2 );
+} // namespace geode
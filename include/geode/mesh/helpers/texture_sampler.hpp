@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include <absl/types/span.h>
+
+#include <geode/basic/pimpl.hpp>
+
+#include <geode/mesh/common.hpp>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( Point );
+    FORWARD_DECLARATION_DIMENSION_CLASS( RasterImage );
+    FORWARD_DECLARATION_DIMENSION_CLASS( TiledRasterImage );
+    FORWARD_DECLARATION_DIMENSION_CLASS( Texture );
+    ALIAS_2D_AND_3D( Texture );
+    struct PolygonVertex;
+    struct PolyhedronVertex;
+    class RGBColor;
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Filter used to compute a color from the image cells around a texture
+     * coordinate.
+     * - nearest: color of the cell containing the coordinate.
+     * - linear: bilinear (2D) or trilinear (3D) interpolation of the colors
+     * of the cells whose centers surround the coordinate.
+     */
+    enum struct TEXTURE_FILTER
+    {
+        nearest,
+        linear
+    };
+
+    /*!
+     * Storage of the color channels in a TextureSampler.
+     * - interleaved: red, green and blue of a cell are contiguous.
+     * - planar: each channel is stored in its own contiguous array.
+     */
+    enum struct TEXTURE_CHANNEL_LAYOUT
+    {
+        interleaved,
+        planar
+    };
+
+    /*!
+     * Sampling engine of a RasterImage at texture coordinates.
+     * Texture coordinates are normalized: [0, 1] in each direction covers the
+     * whole image, the center of the cell i in a direction with n cells being
+     * at (i + 0.5) / n. Coordinates outside [0, 1] are clamped to the image
+     * borders.
+     * The image colors are copied at construction following the requested
+     * channel layout, the sampler is independent of the image afterwards.
+     */
+    template < index_t dimension >
+    class TextureSampler
+    {
+        OPENGEODE_DISABLE_COPY( TextureSampler );
+
+    public:
+        explicit TextureSampler( const RasterImage< dimension >& image,
+            TEXTURE_CHANNEL_LAYOUT layout = TEXTURE_CHANNEL_LAYOUT::planar );
+        TextureSampler( TextureSampler&& other ) noexcept;
+        ~TextureSampler();
+
+        [[nodiscard]] TEXTURE_CHANNEL_LAYOUT channel_layout() const;
+
+        [[nodiscard]] RGBColor sample( const Point< dimension >& coordinates,
+            TEXTURE_FILTER filter ) const;
+
+        /*!
+         * Sample the image at all the given coordinates, in parallel.
+         */
+        [[nodiscard]] std::vector< RGBColor > sample(
+            absl::Span< const Point< dimension > > coordinates,
+            TEXTURE_FILTER filter ) const;
+
+    private:
+        IMPLEMENTATION_MEMBER( impl_ );
+    };
+    ALIAS_2D_AND_3D( TextureSampler );
+
+    /*!
+     * Sampling engine of one level of a TiledRasterImage, with the same
+     * conventions as TextureSampler.
+     * Only the tiles containing the sampled cells are read from the image
+     * file.
+     */
+    template < index_t dimension >
+    class TiledTextureSampler
+    {
+        OPENGEODE_DISABLE_COPY( TiledTextureSampler );
+
+    public:
+        /*!
+         * @param[in] level Mip level to sample, 0 for full resolution.
+         */
+        explicit TiledTextureSampler(
+            const TiledRasterImage< dimension >& image, index_t level = 0 );
+        TiledTextureSampler( TiledTextureSampler&& other ) noexcept;
+        ~TiledTextureSampler();
+
+        [[nodiscard]] RGBColor sample( const Point< dimension >& coordinates,
+            TEXTURE_FILTER filter ) const;
+
+        /*!
+         * Sample the image at all the given coordinates, in parallel.
+         */
+        [[nodiscard]] std::vector< RGBColor > sample(
+            absl::Span< const Point< dimension > > coordinates,
+            TEXTURE_FILTER filter ) const;
+
+    private:
+        IMPLEMENTATION_MEMBER( impl_ );
+    };
+    ALIAS_2D_AND_3D( TiledTextureSampler );
+
+    /*!
+     * Position inside a triangle given by its barycentric coordinates.
+     */
+    struct opengeode_mesh_api TexturePolygonPosition
+    {
+        index_t polygon_id;
+        std::array< double, 3 > barycentric_coordinates;
+    };
+
+    /*!
+     * Position inside a tetrahedron given by its barycentric coordinates.
+     */
+    struct opengeode_mesh_api TexturePolyhedronPosition
+    {
+        index_t polyhedron_id;
+        std::array< double, 4 > barycentric_coordinates;
+    };
+
+    /*!
+     * Sample the texture image at the texture coordinates of the given
+     * polygon vertices, in parallel.
+     */
+    [[nodiscard]] std::vector< RGBColor > opengeode_mesh_api sample_texture(
+        const Texture2D& texture,
+        const TextureSampler2D& sampler,
+        absl::Span< const PolygonVertex > vertices,
+        TEXTURE_FILTER filter );
+
+    /*!
+     * Sample the texture image at positions inside triangles, in parallel.
+     * The texture coordinates of a position are interpolated from those of
+     * the triangle vertices.
+     */
+    [[nodiscard]] std::vector< RGBColor > opengeode_mesh_api sample_texture(
+        const Texture2D& texture,
+        const TextureSampler2D& sampler,
+        absl::Span< const TexturePolygonPosition > positions,
+        TEXTURE_FILTER filter );
+
+    /*!
+     * Sample the texture image at the texture coordinates of the given
+     * polyhedron vertices, in parallel.
+     */
+    [[nodiscard]] std::vector< RGBColor > opengeode_mesh_api sample_texture(
+        const Texture3D& texture,
+        const TextureSampler3D& sampler,
+        absl::Span< const PolyhedronVertex > vertices,
+        TEXTURE_FILTER filter );
+
+    /*!
+     * Sample the texture image at positions inside tetrahedra, in parallel.
+     * The texture coordinates of a position are interpolated from those of
+     * the tetrahedron vertices.
+     */
+    [[nodiscard]] std::vector< RGBColor > opengeode_mesh_api sample_texture(
+        const Texture3D& texture,
+        const TextureSampler3D& sampler,
+        absl::Span< const TexturePolyhedronPosition > positions,
+        TEXTURE_FILTER filter );
+} // namespace geode
@@ -25,6 +25,8 @@
 
 #include <fstream>
 
+#include <geode/basic/filename.hpp>
+
 #include <geode/geometry/bitsery_archive.hpp>
 
 #include <geode/image/core/bitsery_archive.hpp>
@@ -41,6 +43,8 @@
         TContext context{};                                                    \
         BitseryExtensions::register_deserialize_pcontext(                      \
             std::get< 0 >( context ) );                                        \
+        std::get< ArchiveDirectory >( context ).directory =                    \
+            filepath_without_filename( this->filename() );                     \
         Deserializer archive{ context, file };                                 \
         auto mesh = Mesh::create( impl );                                      \
         archive.object( dynamic_cast< OpenGeode##Mesh& >( *mesh ) );           \
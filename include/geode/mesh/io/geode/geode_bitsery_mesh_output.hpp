@@ -25,6 +25,8 @@
 
 #include <fstream>
 
+#include <geode/basic/filename.hpp>
+
 #include <geode/geometry/bitsery_archive.hpp>
 
 #include <geode/image/core/bitsery_archive.hpp>
@@ -39,6 +41,8 @@
         TContext context{};                                                    \
         BitseryExtensions::register_serialize_pcontext(                        \
             std::get< 0 >( context ) );                                        \
+        std::get< ArchiveDirectory >( context ).directory =                    \
+            filepath_without_filename( this->filename() );                     \
         Serializer archive{ context, file };                                   \
         archive.object( dynamic_cast< const OpenGeode##Mesh& >( mesh ) );      \
         archive.adapter().flush();                                             \
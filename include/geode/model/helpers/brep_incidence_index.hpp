@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <geode/basic/pimpl.hpp>
+
+#include <geode/model/common.hpp>
+#include <geode/model/helpers/component_mesh_polygons.hpp>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( Block );
+    FORWARD_DECLARATION_DIMENSION_CLASS( Surface );
+    FORWARD_DECLARATION_DIMENSION_CLASS( Line );
+    ALIAS_3D( Block );
+    ALIAS_3D( Surface );
+    ALIAS_3D( Line );
+    class BRep;
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Precomputed incidences between the meshes of adjacent BRep components:
+     * for each polygon of a Surface, the facets (and their vertices) of the
+     * Blocks it bounds or is internal to, and for each edge of a Line, the
+     * polygon edges (and their vertices) of the Surfaces it bounds or is
+     * internal to.
+     * The results are the same as block_vertices_from_surface_polygon and
+     * surface_vertices_from_line_edge, but are computed once for the whole
+     * BRep, in parallel, and queried in constant time.
+     * Only these non-oriented queries are indexed: the oriented variants
+     * (oriented_block_vertices_from_surface_polygon and
+     * oriented_surface_vertices_from_line_edge) are not.
+     * The index is not updated when the BRep is modified: use is_up_to_date()
+     * to know if the component mesh connectivities have changed since the
+     * index was built. Modifications of the unique vertices are not tracked.
+     * Query results are undefined once the index is outdated. Checking it
+     * traverses every component mesh, so it is only asserted in debug.
+     */
+    class opengeode_model_api BRepIncidenceIndex
+    {
+        OPENGEODE_DISABLE_COPY( BRepIncidenceIndex );
+
+    public:
+        explicit BRepIncidenceIndex( const BRep& brep );
+        BRepIncidenceIndex( BRepIncidenceIndex&& other ) noexcept;
+        ~BRepIncidenceIndex();
+
+        /*!
+         * Return true if no component mesh connectivity has been modified,
+         * and no component mesh added or removed, since the index was built.
+         */
+        [[nodiscard]] bool is_up_to_date() const;
+
+        /*!
+         * Same result as geode::block_vertices_from_surface_polygon.
+         */
+        [[nodiscard]] const absl::InlinedVector< BlockPolyhedronFacet, 2 >&
+            block_vertices_from_surface_polygon( const Block3D& block,
+                const Surface3D& surface,
+                index_t polygon_id ) const;
+
+        /*!
+         * Same result as geode::block_mesh_polyhedra_from_surface_polygon.
+         */
+        [[nodiscard]] PolyhedraAroundFacet
+            block_mesh_polyhedra_from_surface_polygon( const Block3D& block,
+                const Surface3D& surface,
+                index_t polygon_id ) const;
+
+        /*!
+         * Same result as geode::surface_vertices_from_line_edge.
+         */
+        [[nodiscard]] const absl::InlinedVector< SurfacePolygonEdge, 2 >&
+            surface_vertices_from_line_edge( const Surface3D& surface,
+                const Line3D& line,
+                index_t edge_id ) const;
+
+    private:
+        IMPLEMENTATION_MEMBER( impl_ );
+    };
+} // namespace geode
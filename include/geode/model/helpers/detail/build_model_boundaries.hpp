@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <absl/types/span.h>
+
 #include <geode/model/common.hpp>
 
 namespace geode
@@ -31,6 +33,7 @@ namespace geode
     class SectionBuilder;
     class BRep;
     class BRepBuilder;
+    struct uuid;
 } // namespace geode
 
 namespace geode
@@ -40,7 +43,23 @@ namespace geode
         void opengeode_model_api build_model_boundaries(
             const Section& model, SectionBuilder& builder );
 
+        /*!
+         * Incremental version of build_model_boundaries, only considering
+         * the given Lines, e.g. after they have been added or edited.
+         */
+        void opengeode_model_api build_model_boundaries( const Section& model,
+            SectionBuilder& builder,
+            absl::Span< const uuid > lines );
+
         void opengeode_model_api build_model_boundaries(
             const BRep& model, BRepBuilder& builder );
+
+        /*!
+         * Incremental version of build_model_boundaries, only considering
+         * the given Surfaces, e.g. after they have been added or edited.
+         */
+        void opengeode_model_api build_model_boundaries( const BRep& model,
+            BRepBuilder& builder,
+            absl::Span< const uuid > surfaces );
     } // namespace detail
 } // namespace geode
\ No newline at end of file
@@ -23,6 +23,11 @@
 
 #pragma once
 
+#include <functional>
+#include <vector>
+
+#include <absl/types/span.h>
+
 #include <geode/basic/pimpl.hpp>
 
 #include <geode/model/representation/core/mapping.hpp>
@@ -45,6 +50,16 @@ namespace geode
 
         ModelCopyMapping concatenate( const Model& other_model );
 
+        /*!
+         * Concatenate several models at once.
+         * Meshes of all the models are cloned in parallel, unique vertices
+         * are created in a single batch and filled in parallel.
+         * @return One ModelCopyMapping per given model, in the same order
+         */
+        std::vector< ModelCopyMapping > concatenate(
+            absl::Span< const std::reference_wrapper< const Model > >
+                other_models );
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#pragma once
+
+#include <geode/mesh/helpers/mesh_quality.hpp>
+
+#include <geode/model/common.hpp>
+#include <geode/model/mixin/core/component_mesh_element.hpp>
+
+namespace geode
+{
+    class BRep;
+    class Section;
+} // namespace geode
+
+namespace geode
+{
+    using ModelQualityReport = QualityReport< ComponentMeshElement >;
+
+    /*!
+     * Compute the quality report over all the Block meshes at once.
+     * Blocks are processed in parallel.
+     * If an attribute name is given, it is created on each Block mesh.
+     */
+    [[nodiscard]] ModelQualityReport opengeode_model_api blocks_quality_report(
+        const BRep& brep,
+        QUALITY_METRIC metric,
+        const QualityReportParameters& parameters = {} );
+
+    /*!
+     * Compute the quality report over all the Surface meshes at once.
+     * Surfaces are processed in parallel.
+     * If an attribute name is given, it is created on each Surface mesh.
+     */
+    [[nodiscard]] ModelQualityReport opengeode_model_api
+        surfaces_quality_report( const BRep& brep,
+            QUALITY_METRIC metric,
+            const QualityReportParameters& parameters = {} );
+
+    [[nodiscard]] ModelQualityReport opengeode_model_api
+        surfaces_quality_report( const Section& section,
+            QUALITY_METRIC metric,
+            const QualityReportParameters& parameters = {} );
+} // namespace geode
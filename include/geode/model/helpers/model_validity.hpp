@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <geode/model/common.hpp>
+#include <geode/model/mixin/core/component_mesh_element.hpp>
+#include <geode/model/mixin/core/vertex_identifier.hpp>
+
+namespace geode
+{
+    class BRep;
+    class Section;
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Issues found on a model, grouped by check.
+     * A mesh element paired with a ComponentID refers to the element of one
+     * component that does not match the other component.
+     */
+    struct opengeode_model_api ModelValidityReport
+    {
+        ModelValidityReport() = default;
+        ModelValidityReport( const ModelValidityReport& ) = default;
+        ModelValidityReport( ModelValidityReport&& ) noexcept = default;
+        ModelValidityReport& operator=( const ModelValidityReport& ) = default;
+        ModelValidityReport& operator=(
+            ModelValidityReport&& ) noexcept = default;
+        virtual ~ModelValidityReport() = default;
+
+        [[nodiscard]] virtual bool is_valid() const;
+
+        [[nodiscard]] virtual std::string string() const;
+
+        /*!
+         * Component mesh vertices without unique vertex, or not listed by
+         * their unique vertex.
+         */
+        std::vector< ComponentMeshVertex > inconsistent_component_vertices;
+        /*!
+         * Unique vertices listing a component mesh vertex that does not
+         * exist or is linked to another unique vertex.
+         */
+        std::vector< index_t > inconsistent_unique_vertices;
+        /*!
+         * Boundary or internal relations (boundary/internal first) that are
+         * not symmetric with the incidence/embedding relations, or that link
+         * components of incompatible types.
+         */
+        std::vector< std::pair< ComponentID, ComponentID > > invalid_relations;
+        /*!
+         * Polygons or polyhedra with an adjacency that is not reciprocated
+         * by the adjacent element.
+         */
+        std::vector< ComponentMeshElement > non_reciprocal_adjacencies;
+        /*!
+         * Component mesh vertices whose incident polygons or polyhedra are
+         * not all connected through adjacencies around the vertex.
+         */
+        std::vector< ComponentMeshVertex > non_manifold_vertices;
+        /*!
+         * Line edges not matching exactly one (boundary line) or two
+         * (internal line) polygon edges of a Surface.
+         */
+        std::vector< std::pair< ComponentMeshElement, ComponentID > >
+            non_conformal_line_edges;
+    };
+
+    struct opengeode_model_api SectionValidityReport
+        : public ModelValidityReport
+    {
+    };
+
+    struct opengeode_model_api BRepValidityReport : public ModelValidityReport
+    {
+        [[nodiscard]] bool is_valid() const override;
+
+        [[nodiscard]] std::string string() const override;
+
+        /*!
+         * Surface polygons not matching exactly one (boundary surface) or
+         * two (internal surface) polyhedron facets of a Block.
+         */
+        std::vector< std::pair< ComponentMeshElement, ComponentID > >
+            non_conformal_surface_polygons;
+    };
+
+    /*!
+     * Check the unique vertices, the relationships, the component meshes
+     * and the conformity between components of a Section.
+     * Components are checked in parallel.
+     */
+    [[nodiscard]] SectionValidityReport opengeode_model_api
+        section_validity_report( const Section& section );
+
+    /*!
+     * Check the unique vertices, the relationships, the component meshes
+     * and the conformity between components of a BRep.
+     * Components are checked in parallel, conformity checks share a
+     * BRepIncidenceIndex. Conformity is only checked when unique vertices
+     * are consistent.
+     */
+    [[nodiscard]] BRepValidityReport opengeode_model_api brep_validity_report(
+        const BRep& brep );
+} // namespace geode
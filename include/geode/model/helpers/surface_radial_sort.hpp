@@ -24,7 +24,9 @@
 #pragma once
 
 #include <absl/container/fixed_array.h>
+#include <absl/types/span.h>
 
+#include <geode/basic/pimpl.hpp>
 #include <geode/basic/uuid.hpp>
 
 #include <geode/mesh/core/surface_mesh.hpp>
@@ -89,6 +91,69 @@ namespace geode
 
     [[nodiscard]] SortedSurfaces opengeode_model_api surface_radial_sort(
         const BRep& brep, const Line3D& line );
+
+    /*!
+     * Radial sorts of the Surfaces around every Line of a BRep.
+     * The results are the same as surface_radial_sort, but are computed once
+     * for the whole BRep, in parallel. The Surface polygon edges lying on
+     * Lines are found in a single pass per Surface, with their degeneracy and
+     * opposite point, and shared by all the Lines around this Surface.
+     * The sorted Surfaces of all the Lines are stored contiguously, one range
+     * per Line.
+     * The table is not updated automatically when the BRep is modified: use
+     * is_up_to_date() to know if the component mesh connectivities have
+     * changed since the table was built, and update() to sort again only the
+     * Lines around the modified components.
+     */
+    class opengeode_model_api BRepSurfaceRadialSorts
+    {
+        OPENGEODE_DISABLE_COPY( BRepSurfaceRadialSorts );
+
+    public:
+        explicit BRepSurfaceRadialSorts( const BRep& brep );
+        BRepSurfaceRadialSorts( BRepSurfaceRadialSorts&& other ) noexcept;
+        ~BRepSurfaceRadialSorts();
+
+        /*!
+         * Return true if no component mesh connectivity has been modified,
+         * and no component mesh added or removed, since the table was built.
+         */
+        [[nodiscard]] bool is_up_to_date() const;
+
+        /*!
+         * Update the table after a modification of the BRep.
+         * Sorted again are the given Lines, the Lines around the given
+         * Surfaces before and after the modification, and the Lines added to
+         * the BRep. Added and removed Surfaces are detected and handled as
+         * modified. The polygon edges on Lines are also found again in the
+         * Surfaces sharing vertices with the given or added Lines. Other
+         * Lines keep their previous sorted Surfaces.
+         * @param[in] surfaces Surfaces whose mesh or unique vertices have been
+         * modified.
+         * @param[in] lines Lines whose mesh or unique vertices have been
+         * modified.
+         */
+        void update(
+            absl::Span< const uuid > surfaces, absl::Span< const uuid > lines );
+
+        [[nodiscard]] index_t nb_lines() const;
+
+        /*!
+         * Return the sorted sided Surfaces around the given Line, in the same
+         * order as SortedSurfaces::surfaces.
+         */
+        [[nodiscard]] absl::Span< const SidedSurface > sorted_surfaces(
+            const uuid& line_id ) const;
+
+        /*!
+         * Same result as geode::surface_radial_sort.
+         */
+        [[nodiscard]] SortedSurfaces surface_radial_sort(
+            const Line3D& line ) const;
+
+    private:
+        IMPLEMENTATION_MEMBER( impl_ );
+    };
 } // namespace geode
 
 namespace std
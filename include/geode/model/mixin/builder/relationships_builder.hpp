@@ -72,6 +72,13 @@ namespace geode
         void copy_relationships( const ModelCopyMapping& mapping,
             const Relationships& relationships );
 
+        /*!
+         * Add the relationships between the mapped components, keeping the
+         * existing ones
+         */
+        void append_relationships( const ModelCopyMapping& mapping,
+            const Relationships& relationships );
+
         void load_relationships( std::string_view directory );
 
     private:
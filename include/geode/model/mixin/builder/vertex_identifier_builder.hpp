@@ -27,6 +27,7 @@
 
 #include <geode/model/common.hpp>
 #include <geode/model/mixin/core/vertex_identifier.hpp>
+#include <geode/model/representation/core/mapping.hpp>
 
 namespace geode
 {
@@ -77,6 +78,16 @@ namespace geode
         void set_unique_vertex(
             ComponentMeshVertex component_vertex_id, index_t unique_vertex_id );
 
+        /*!
+         * Identify several component vertices to existing unique vertex
+         * indices, in a single batched update.
+         * @param[in] vertices Pairs of component vertex and unique vertex
+         * index. A component vertex should appear at most once.
+         */
+        void set_unique_vertices(
+            absl::Span< const std::pair< ComponentMeshVertex, index_t > >
+                vertices );
+
         /*!
          * Remove a component vertex to its unique vertex index.
          * @param[in] component_vertex_id Index of the vertex in the component.
@@ -96,6 +107,17 @@ namespace geode
         void update_unique_vertices( const ComponentID& component_id,
             absl::Span< const index_t > old2new );
 
+        /*!
+         * Copy all the unique vertices of another VertexIdentifier: unique
+         * vertex v of other becomes unique vertex first_unique_vertex + v.
+         * @param[in] mapping Mapping from the components of other to their
+         * copies, which must be registered with meshes having the same
+         * vertices and no unique vertex yet.
+         */
+        void copy_unique_vertices( const VertexIdentifier& other,
+            index_t first_unique_vertex,
+            const ModelCopyMapping& mapping );
+
         /*!
          * Load the VertexIdentifier from a file.
          * @param[in] directory Folder containing the file that stores
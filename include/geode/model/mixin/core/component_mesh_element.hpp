@@ -62,7 +62,8 @@ namespace geode
                 *this, Growable< Archive, ComponentMeshElement >{
                            { []( Archive& a, ComponentMeshElement& cme ) {
                                a.object( cme.component_id );
-                               a.value4b( cme.element_id );
+                               a.template value< INDEX_BYTES >(
+                                   cme.element_id );
                            } } } );
         }
 
@@ -84,6 +84,16 @@ namespace geode
             void copy( const RelationshipsImpl& impl,
                 const ModelCopyMapping& mapping );
 
+            /*!
+             * Append the relations of another RelationshipsImpl between
+             * mapped components. Relations already existing are skipped.
+             * Relation attributes are imported.
+             * @return Mapping from the relation edges of impl to the
+             * relation edges of this RelationshipsImpl (NO_ID if skipped)
+             */
+            std::vector< index_t > append( const RelationshipsImpl& impl,
+                const ModelCopyMapping& mapping );
+
         protected:
             RelationshipsImpl();
 
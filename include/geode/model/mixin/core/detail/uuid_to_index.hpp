@@ -98,7 +98,7 @@ namespace geode
                                     uuids.uuid2index_.max_size() },
                                 []( Archive& a2, uuid& id, index_t& index ) {
                                     a2.object( id );
-                                    a2.value4b( index );
+                                    a2.template value< INDEX_BYTES >( index );
                                 } );
                         } } } );
             }
@@ -458,6 +458,10 @@ namespace geode
             const Relationships& relationships,
             RelationshipsBuilderKey );
 
+        void append_relationships( const ModelCopyMapping& mapping,
+            const Relationships& relationships,
+            RelationshipsBuilderKey );
+
         void load_relationships(
             std::string_view directory, RelationshipsBuilderKey );
 
@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <utility>
 #include <vector>
 
 #include <absl/types/span.h>
@@ -160,6 +161,18 @@ namespace geode
             index_t unique_vertex_id,
             BuilderKey );
 
+        /*!
+         * Identify several component vertices to existing unique vertex
+         * indices. Same result as calling set_unique_vertex on each pair, but
+         * each unique vertex is modified only once.
+         * @param[in] vertices Pairs of component vertex and unique vertex
+         * index. A component vertex should appear at most once.
+         */
+        void set_unique_vertices(
+            absl::Span< const std::pair< ComponentMeshVertex, index_t > >
+                vertices,
+            BuilderKey );
+
         /*!
          * Remove a component vertex to its unique vertex index.
          * @param[in] component_vertex_id Index of the vertex in the component.
@@ -181,6 +194,20 @@ namespace geode
             absl::Span< const index_t > old2new,
             BuilderKey );
 
+        /*!
+         * Copy all the unique vertices of another VertexIdentifier: unique
+         * vertex v of other becomes unique vertex first_unique_vertex + v.
+         * Unique vertices are processed in parallel.
+         * @param[in] components_mapping Component ids in other and their
+         * copies in this VertexIdentifier. Copies must be registered with
+         * meshes having the same vertices and no unique vertex yet.
+         */
+        void copy_unique_vertices( const VertexIdentifier& other,
+            index_t first_unique_vertex,
+            absl::Span< const std::pair< uuid, ComponentID > >
+                components_mapping,
+            BuilderKey );
+
         /*!
          * Load the VertexIdentifier from a file.
          * @param[in] directory Folder containing the file that stores
@@ -49,6 +49,7 @@ namespace geode
     ALIAS_3D( Line );
     ALIAS_3D( Surface );
     FORWARD_DECLARATION_DIMENSION_CLASS( BoundingBox );
+    struct MeshRevisions;
     ALIAS_3D( BoundingBox );
     class BRepBuilder;
 } // namespace geode
@@ -526,6 +527,14 @@ namespace geode
 
         [[nodiscard]] BoundingBox3D bounding_box() const;
 
+        /*!
+         * Aggregated revisions of all the component meshes.
+         * Comparing them with previously stored ones tells whether any mesh of
+         * the model has been modified since.
+         * @see MeshRevisions
+         */
+        [[nodiscard]] MeshRevisions mesh_revisions() const;
+
         [[nodiscard]] static std::string_view native_extension_static()
         {
             static const auto extension = "og_brep";
@@ -25,6 +25,8 @@
 
 #include <geode/geometry/bounding_box.hpp>
 
+#include <geode/mesh/core/mesh_revisions.hpp>
+
 #include <geode/model/common.hpp>
 
 namespace geode
@@ -67,5 +69,15 @@ namespace geode
             }
             return box;
         }
+
+        template < typename MeshComponentRange >
+        void add_meshes_revisions(
+            MeshRevisions& revisions, MeshComponentRange range )
+        {
+            for( const auto& component : range )
+            {
+                revisions.add( component.mesh().revisions() );
+            }
+        }
     } // namespace internal
 } // namespace geode
@@ -47,6 +47,7 @@ namespace geode
     ALIAS_2D( LineCollection );
     ALIAS_2D( SurfaceCollection );
     FORWARD_DECLARATION_DIMENSION_CLASS( BoundingBox );
+    struct MeshRevisions;
     ALIAS_2D( BoundingBox );
     class SectionBuilder;
 } // namespace geode
@@ -365,6 +366,14 @@ namespace geode
 
         [[nodiscard]] BoundingBox2D bounding_box() const;
 
+        /*!
+         * Aggregated revisions of all the component meshes.
+         * Comparing them with previously stored ones tells whether any mesh of
+         * the model has been modified since.
+         * @see MeshRevisions
+         */
+        [[nodiscard]] MeshRevisions mesh_revisions() const;
+
         [[nodiscard]] static std::string_view native_extension_static()
         {
             static const auto extension = "og_sctn";
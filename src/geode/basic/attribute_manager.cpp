@@ -348,7 +348,8 @@ namespace geode
             archive.ext(
                 *this, Growable< Archive, Impl >{ { []( Archive &local_archive,
                                                         Impl &impl ) {
-                    local_archive.value4b( impl.nb_elements_ );
+                    local_archive.template value< INDEX_BYTES >(
+                        impl.nb_elements_ );
                     local_archive.ext( impl.attributes_,
                         bitsery::ext::StdMap{ impl.attributes_.max_size() },
                         []( Archive &local_archive2, std::string &name,
@@ -109,11 +109,12 @@ namespace geode
         template < typename Archive >
         void serialize( Archive& archive )
         {
-            archive.ext( *this, Growable< Archive, Impl >{
-                                    { []( Archive& local_archive, Impl& impl ) {
-                                        local_archive.container4b(
-                                            impl.cells_number_ );
-                                    } } } );
+            archive.ext( *this,
+                Growable< Archive, Impl >{
+                    { []( Archive& local_archive, Impl& impl ) {
+                        local_archive.template container< INDEX_BYTES >(
+                            impl.cells_number_ );
+                    } } } );
         }
 
     private:
@@ -89,6 +89,19 @@ namespace geode
         return result;
     }
 
+    template < index_t dimension >
+    void AABBTree< dimension >::containing_boxes(
+        const Point< dimension >& query, std::vector< index_t >& boxes ) const
+    {
+        boxes.clear();
+        if( nb_bboxes() == 0 )
+        {
+            return;
+        }
+        impl_->containing_boxes_sequential(
+            Impl::ROOT_INDEX, 0, nb_bboxes(), query, boxes );
+    }
+
     template class opengeode_geometry_api AABBTree< 1 >;
     template class opengeode_geometry_api AABBTree< 2 >;
     template class opengeode_geometry_api AABBTree< 3 >;
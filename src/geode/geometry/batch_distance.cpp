@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#include <geode/geometry/batch_distance.hpp>
+
+#include <algorithm>
+#include <limits>
+
+#include <geode/geometry/basic_objects/triangle.hpp>
+#include <geode/geometry/point.hpp>
+
+namespace
+{
+    template < geode::index_t dimension >
+    using Coords = std::array< double, dimension >;
+
+    template < std::size_t size >
+    std::array< double, size > difference( const std::array< double, size >& to,
+        const std::array< double, size >& from )
+    {
+        std::array< double, size > result;
+        for( const auto d : geode::LRange{ size } )
+        {
+            result[d] = to[d] - from[d];
+        }
+        return result;
+    }
+
+    template < std::size_t size >
+    double dot( const std::array< double, size >& u,
+        const std::array< double, size >& v )
+    {
+        double result{ 0 };
+        for( const auto d : geode::LRange{ size } )
+        {
+            result += u[d] * v[d];
+        }
+        return result;
+    }
+
+    Coords< 3 > cross( const Coords< 3 >& u, const Coords< 3 >& v )
+    {
+        return { u[1] * v[2] - u[2] * v[1], u[2] * v[0] - u[0] * v[2],
+            u[0] * v[1] - u[1] * v[0] };
+    }
+
+    double cross( const Coords< 2 >& u, const Coords< 2 >& v )
+    {
+        return u[0] * v[1] - u[1] * v[0];
+    }
+
+    /*!
+     * Divide by a value clamped away from zero. The numerators divided by
+     * this function vanish with the denominator, so degenerate inputs give
+     * zero without any test.
+     */
+    double safe_divide( double numerator, double denominator )
+    {
+        return numerator
+               / std::max( denominator, std::numeric_limits< double >::min() );
+    }
+
+    template < std::size_t size >
+    double point_segment_squared_distance(
+        const std::array< double, size >& origin_to_point,
+        const std::array< double, size >& direction )
+    {
+        const auto parameter = std::min(
+            std::max( safe_divide( dot( origin_to_point, direction ),
+                          dot( direction, direction ) ),
+                0. ),
+            1. );
+        std::array< double, size > diff;
+        for( const auto d : geode::LRange{ size } )
+        {
+            diff[d] = origin_to_point[d] - parameter * direction[d];
+        }
+        return dot( diff, diff );
+    }
+
+    /*!
+     * Branch-free point-triangle squared distance: the distance to the
+     * supporting plane when the point projects inside the triangle,
+     * the smallest distance to the three edges otherwise.
+     * Every operation is arithmetic, a min/max or a select, and conditions
+     * are combined without short-circuit, so that the calling loop can be
+     * vectorized.
+     */
+    template < geode::index_t dimension >
+    double point_triangle_squared_distance( const Coords< dimension >& point,
+        const std::array< Coords< dimension >, 3 >& vertices )
+    {
+        const auto v0_to_v1 = difference( vertices[1], vertices[0] );
+        const auto v1_to_v2 = difference( vertices[2], vertices[1] );
+        const auto v2_to_v0 = difference( vertices[0], vertices[2] );
+        const auto v0_to_point = difference( point, vertices[0] );
+        const auto v1_to_point = difference( point, vertices[1] );
+        const auto v2_to_point = difference( point, vertices[2] );
+        const auto edges_distance =
+            std::min( point_segment_squared_distance( v0_to_point, v0_to_v1 ),
+                std::min(
+                    point_segment_squared_distance( v1_to_point, v1_to_v2 ),
+                    point_segment_squared_distance(
+                        v2_to_point, v2_to_v0 ) ) );
+        if constexpr( dimension == 3 )
+        {
+            const auto normal = cross( v0_to_v1, difference( vertices[2],
+                                                     vertices[0] ) );
+            const auto squared_area = dot( normal, normal );
+            const auto side0 = dot( normal, cross( v0_to_v1, v0_to_point ) );
+            const auto side1 = dot( normal, cross( v1_to_v2, v1_to_point ) );
+            const auto side2 = dot( normal, cross( v2_to_v0, v2_to_point ) );
+            const auto inside = ( squared_area > 0 ) & ( side0 >= 0 )
+                                & ( side1 >= 0 ) & ( side2 >= 0 );
+            const auto height = dot( normal, v0_to_point );
+            const auto plane_distance =
+                safe_divide( height * height, squared_area );
+            return inside ? plane_distance : edges_distance;
+        }
+        else
+        {
+            const auto area =
+                cross( v0_to_v1, difference( vertices[2], vertices[0] ) );
+            const auto side0 = area * cross( v0_to_v1, v0_to_point );
+            const auto side1 = area * cross( v1_to_v2, v1_to_point );
+            const auto side2 = area * cross( v2_to_v0, v2_to_point );
+            const auto inside = ( area != 0 ) & ( side0 >= 0 ) & ( side1 >= 0 )
+                                & ( side2 >= 0 );
+            return inside ? 0. : edges_distance;
+        }
+    }
+
+    template < geode::index_t dimension >
+    Coords< dimension > to_coords( const geode::Point< dimension >& point )
+    {
+        Coords< dimension > result;
+        for( const auto d : geode::LRange{ dimension } )
+        {
+            result[d] = point.value( d );
+        }
+        return result;
+    }
+} // namespace
+
+namespace geode
+{
+    template < index_t dimension >
+    void PointBatch< dimension >::clear()
+    {
+        for( auto& coordinates : coordinates_ )
+        {
+            coordinates.clear();
+        }
+    }
+
+    template < index_t dimension >
+    void PointBatch< dimension >::reserve( index_t nb )
+    {
+        for( auto& coordinates : coordinates_ )
+        {
+            coordinates.reserve( nb );
+        }
+    }
+
+    template < index_t dimension >
+    index_t PointBatch< dimension >::add_point(
+        const Point< dimension >& point )
+    {
+        const auto id = size();
+        for( const auto d : LRange{ dimension } )
+        {
+            coordinates_[d].push_back( point.value( d ) );
+        }
+        return id;
+    }
+
+    template < index_t dimension >
+    void TriangleBatch< dimension >::clear()
+    {
+        for( auto& vertex_coordinates : coordinates_ )
+        {
+            for( auto& coordinates : vertex_coordinates )
+            {
+                coordinates.clear();
+            }
+        }
+    }
+
+    template < index_t dimension >
+    void TriangleBatch< dimension >::reserve( index_t nb )
+    {
+        for( auto& vertex_coordinates : coordinates_ )
+        {
+            for( auto& coordinates : vertex_coordinates )
+            {
+                coordinates.reserve( nb );
+            }
+        }
+    }
+
+    template < index_t dimension >
+    index_t TriangleBatch< dimension >::add_triangle(
+        const Triangle< dimension >& triangle )
+    {
+        const auto id = size();
+        const auto& vertices = triangle.vertices();
+        for( const auto v : LRange{ 3 } )
+        {
+            for( const auto d : LRange{ dimension } )
+            {
+                coordinates_[v][d].push_back( vertices[v].get().value( d ) );
+            }
+        }
+        return id;
+    }
+
+    template < index_t dimension >
+    void point_triangles_squared_distances( const Point< dimension >& point,
+        const TriangleBatch< dimension >& triangles,
+        absl::Span< double > squared_distances )
+    {
+        OPENGEODE_ASSERT( squared_distances.size() >= triangles.size(),
+            "[point_triangles_squared_distances] Output is too small" );
+        const auto query = to_coords( point );
+        std::array< std::array< const double*, dimension >, 3 > coordinates;
+        for( const auto v : LRange{ 3 } )
+        {
+            for( const auto d : LRange{ dimension } )
+            {
+                coordinates[v][d] = triangles.coordinates( v, d );
+            }
+        }
+        for( const auto t : Range{ triangles.size() } )
+        {
+            std::array< Coords< dimension >, 3 > vertices;
+            for( const auto v : LRange{ 3 } )
+            {
+                for( const auto d : LRange{ dimension } )
+                {
+                    vertices[v][d] = coordinates[v][d][t];
+                }
+            }
+            squared_distances[t] =
+                point_triangle_squared_distance< dimension >( query, vertices );
+        }
+    }
+
+    template < index_t dimension >
+    void points_triangle_squared_distances(
+        const PointBatch< dimension >& points,
+        const Triangle< dimension >& triangle,
+        absl::Span< double > squared_distances )
+    {
+        OPENGEODE_ASSERT( squared_distances.size() >= points.size(),
+            "[points_triangle_squared_distances] Output is too small" );
+        const auto& triangle_vertices = triangle.vertices();
+        std::array< Coords< dimension >, 3 > vertices;
+        for( const auto v : LRange{ 3 } )
+        {
+            vertices[v] = to_coords( triangle_vertices[v].get() );
+        }
+        std::array< const double*, dimension > coordinates;
+        for( const auto d : LRange{ dimension } )
+        {
+            coordinates[d] = points.coordinates( d );
+        }
+        for( const auto p : Range{ points.size() } )
+        {
+            Coords< dimension > query;
+            for( const auto d : LRange{ dimension } )
+            {
+                query[d] = coordinates[d][p];
+            }
+            squared_distances[p] =
+                point_triangle_squared_distance< dimension >( query, vertices );
+        }
+    }
+
+    template class opengeode_geometry_api PointBatch< 2 >;
+    template class opengeode_geometry_api PointBatch< 3 >;
+    template class opengeode_geometry_api TriangleBatch< 2 >;
+    template class opengeode_geometry_api TriangleBatch< 3 >;
+
+    template opengeode_geometry_api void point_triangles_squared_distances(
+        const Point2D&, const TriangleBatch2D&, absl::Span< double > );
+    template opengeode_geometry_api void point_triangles_squared_distances(
+        const Point3D&, const TriangleBatch3D&, absl::Span< double > );
+
+    template opengeode_geometry_api void points_triangle_squared_distances(
+        const PointBatch2D&, const Triangle2D&, absl::Span< double > );
+    template opengeode_geometry_api void points_triangle_squared_distances(
+        const PointBatch3D&, const Triangle3D&, absl::Span< double > );
+} // namespace geode
@@ -23,6 +23,10 @@
 
 #include <geode/geometry/internal/predicates.hpp>
 
+#include <geode/geometry/basic_objects/tetrahedron.hpp>
+#include <geode/geometry/basic_objects/triangle.hpp>
+#include <geode/geometry/sign.hpp>
+
 /*
  *  Copyright (c) 2012-2014, Bruno Levy
  *  All rights reserved.
@@ -1589,6 +1593,9 @@ namespace GEO
 #endif
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
 
 #define FPG_UNCERTAIN_VALUE 0
 
@@ -1726,6 +1733,186 @@ namespace GEO
     }
 } // namespace GEO
 
+namespace
+{
+    /*!
+     * Evaluation counters of one predicate. Counting is disabled by default
+     * so that the hot path only pays for one relaxed load.
+     */
+    struct Counters
+    {
+        void record( std::uint64_t nb_calls, std::uint64_t nb_exact_calls )
+        {
+            calls.fetch_add( nb_calls, std::memory_order_relaxed );
+            exact_calls.fetch_add( nb_exact_calls, std::memory_order_relaxed );
+        }
+
+        geode::PredicateCounters get() const
+        {
+            return { calls.load( std::memory_order_relaxed ),
+                exact_calls.load( std::memory_order_relaxed ) };
+        }
+
+        void reset()
+        {
+            calls.store( 0, std::memory_order_relaxed );
+            exact_calls.store( 0, std::memory_order_relaxed );
+        }
+
+        std::atomic< std::uint64_t > calls{ 0 };
+        std::atomic< std::uint64_t > exact_calls{ 0 };
+    };
+
+    std::atomic< bool > statistics_enabled{ false };
+    Counters orient_2d_counters;
+    Counters orient_3d_counters;
+
+    bool count()
+    {
+        return statistics_enabled.load( std::memory_order_relaxed );
+    }
+
+    /*!
+     * Number of predicates filtered together by the batch predicates. The
+     * inputs of a chunk are copied as structure of arrays on the stack.
+     */
+    constexpr std::size_t FILTER_CHUNK_SIZE{ 32 };
+
+    template < std::size_t nb_differences >
+    using FilterChunk = std::array< std::array< double, FILTER_CHUNK_SIZE >,
+        nb_differences >;
+
+    /*!
+     * Branch-free semi-static filter of orient_2d, computed from the
+     * coordinate differences to the first point so that it is vectorized over
+     * a chunk. Same constants and same results as orient_2d_filter.
+     */
+    inline int orient_2d_chunk_filter(
+        double a11, double a12, double a21, double a22 )
+    {
+        const auto Delta = ( a11 * a22 ) - ( a12 * a21 );
+        const auto max1 = std::max( std::fabs( a11 ), std::fabs( a12 ) );
+        const auto max2 = std::max( std::fabs( a21 ), std::fabs( a22 ) );
+        const auto lower_bound = std::min( max1, max2 );
+        const auto upper_bound = std::max( max1, max2 );
+        const auto eps = 8.88720573725927976811e-16 * ( max1 * max2 );
+        const auto in_range =
+            static_cast< int >( lower_bound >= 5.00368081960964635413e-147 )
+            & static_cast< int >( upper_bound <= 1.67597599124282407923e+153 );
+        return in_range
+               * ( static_cast< int >( Delta > eps )
+                   - static_cast< int >( Delta < -eps ) );
+    }
+
+    /*!
+     * Branch-free semi-static filter of orient_3d, computed from the
+     * coordinate differences to the first point so that it is vectorized over
+     * a chunk. Same constants and same results as orient_3d_filter.
+     */
+    inline int orient_3d_chunk_filter( double a11,
+        double a12,
+        double a13,
+        double a21,
+        double a22,
+        double a23,
+        double a31,
+        double a32,
+        double a33 )
+    {
+        const auto Delta = ( ( ( a11 * ( ( a22 * a33 ) - ( a23 * a32 ) ) )
+                                 - ( a21 * ( ( a12 * a33 ) - ( a13 * a32 ) ) ) )
+                             + ( a31 * ( ( a12 * a23 ) - ( a13 * a22 ) ) ) );
+        const auto max1 = std::max(
+            std::max( std::fabs( a11 ), std::fabs( a21 ) ), std::fabs( a31 ) );
+        const auto max2 =
+            std::max( std::max( std::max( std::fabs( a12 ), std::fabs( a13 ) ),
+                          std::fabs( a22 ) ),
+                std::fabs( a23 ) );
+        const auto max3 =
+            std::max( std::max( std::max( std::fabs( a22 ), std::fabs( a23 ) ),
+                          std::fabs( a32 ) ),
+                std::fabs( a33 ) );
+        const auto lower_bound = std::min( std::min( max1, max2 ), max3 );
+        const auto upper_bound = std::max( std::max( max1, max2 ), max3 );
+        const auto eps =
+            5.11071278299732992696e-15 * ( ( max2 * max3 ) * max1 );
+        const auto in_range =
+            static_cast< int >( lower_bound >= 1.63288018496748314939e-98 )
+            & static_cast< int >( upper_bound <= 5.59936185544450928309e+101 );
+        return in_range
+               * ( static_cast< int >( Delta > eps )
+                   - static_cast< int >( Delta < -eps ) );
+    }
+
+    /*!
+     * Run the orient_2d filter on at most FILTER_CHUNK_SIZE triangles.
+     * Uncertain signs are set to zero.
+     */
+    void filter_orient_2d_chunk(
+        absl::Span< const geode::Triangle2D > triangles,
+        absl::Span< GEO::SIGN > signs )
+    {
+        FilterChunk< 4 > differences;
+        for( const auto t : geode::Indices{ triangles } )
+        {
+            const auto& vertices = triangles[t].vertices();
+            const auto& p0 = vertices[0].get();
+            const auto& p1 = vertices[1].get();
+            const auto& p2 = vertices[2].get();
+            differences[0][t] = p1.value( 0 ) - p0.value( 0 );
+            differences[1][t] = p1.value( 1 ) - p0.value( 1 );
+            differences[2][t] = p2.value( 0 ) - p0.value( 0 );
+            differences[3][t] = p2.value( 1 ) - p0.value( 1 );
+        }
+        std::array< int, FILTER_CHUNK_SIZE > results;
+        for( std::size_t t = 0; t < triangles.size(); t++ )
+        {
+            results[t] = orient_2d_chunk_filter( differences[0][t],
+                differences[1][t], differences[2][t], differences[3][t] );
+        }
+        for( const auto t : geode::Indices{ triangles } )
+        {
+            signs[t] = GEO::SIGN( results[t] );
+        }
+    }
+
+    /*!
+     * Run the orient_3d filter on at most FILTER_CHUNK_SIZE tetrahedra.
+     * Uncertain signs are set to zero.
+     */
+    void filter_orient_3d_chunk(
+        absl::Span< const geode::Tetrahedron > tetrahedra,
+        absl::Span< GEO::SIGN > signs )
+    {
+        FilterChunk< 9 > differences;
+        for( const auto t : geode::Indices{ tetrahedra } )
+        {
+            const auto& vertices = tetrahedra[t].vertices();
+            const auto& p0 = vertices[0].get();
+            for( const auto v : geode::LRange{ 1, 4 } )
+            {
+                for( const auto d : geode::LRange{ 3 } )
+                {
+                    differences[3 * ( v - 1 ) + d][t] =
+                        vertices[v].get().value( d ) - p0.value( d );
+                }
+            }
+        }
+        std::array< int, FILTER_CHUNK_SIZE > results;
+        for( std::size_t t = 0; t < tetrahedra.size(); t++ )
+        {
+            results[t] = orient_3d_chunk_filter( differences[0][t],
+                differences[1][t], differences[2][t], differences[3][t],
+                differences[4][t], differences[5][t], differences[6][t],
+                differences[7][t], differences[8][t] );
+        }
+        for( const auto t : geode::Indices{ tetrahedra } )
+        {
+            signs[t] = GEO::SIGN( results[t] );
+        }
+    }
+} // namespace
+
 namespace GEO
 {
     namespace PCK
@@ -1735,10 +1922,15 @@ namespace GEO
             const geode::Point2D& p2 )
         {
             SIGN result = SIGN( orient_2d_filter( p0, p1, p2 ) );
-            if( result == 0 )
+            const auto exact = result == 0;
+            if( exact )
             {
                 result = orient_2d_exact( p0, p1, p2 );
             }
+            if( count() )
+            {
+                orient_2d_counters.record( 1, exact ? 1 : 0 );
+            }
             return result;
         }
 
@@ -1748,13 +1940,97 @@ namespace GEO
             const geode::Point3D& p3 )
         {
             SIGN result = SIGN( orient_3d_filter( p0, p1, p2, p3 ) );
-            if( result == 0 )
+            const auto exact = result == 0;
+            if( exact )
             {
                 result = orient_3d_exact( p0, p1, p2, p3 );
             }
+            if( count() )
+            {
+                orient_3d_counters.record( 1, exact ? 1 : 0 );
+            }
             return result;
         }
 
+        void orient_2d_batch( absl::Span< const geode::Triangle2D > triangles,
+            absl::Span< SIGN > signs )
+        {
+            OPENGEODE_ASSERT( signs.size() >= triangles.size(),
+                "[orient_2d_batch] Output is too small" );
+            for( std::size_t begin = 0; begin < triangles.size();
+                 begin += FILTER_CHUNK_SIZE )
+            {
+                const auto size =
+                    std::min( FILTER_CHUNK_SIZE, triangles.size() - begin );
+                filter_orient_2d_chunk( triangles.subspan( begin, size ),
+                    signs.subspan( begin, size ) );
+            }
+            std::uint64_t nb_exact{ 0 };
+            for( const auto t : geode::Indices{ triangles } )
+            {
+                if( signs[t] != zero )
+                {
+                    continue;
+                }
+                const auto& vertices = triangles[t].vertices();
+                signs[t] =
+                    orient_2d_exact( vertices[0], vertices[1], vertices[2] );
+                nb_exact++;
+            }
+            if( count() )
+            {
+                orient_2d_counters.record( triangles.size(), nb_exact );
+            }
+        }
+
+        void orient_3d_batch(
+            absl::Span< const geode::Tetrahedron > tetrahedra,
+            absl::Span< SIGN > signs )
+        {
+            OPENGEODE_ASSERT( signs.size() >= tetrahedra.size(),
+                "[orient_3d_batch] Output is too small" );
+            for( std::size_t begin = 0; begin < tetrahedra.size();
+                 begin += FILTER_CHUNK_SIZE )
+            {
+                const auto size =
+                    std::min( FILTER_CHUNK_SIZE, tetrahedra.size() - begin );
+                filter_orient_3d_chunk( tetrahedra.subspan( begin, size ),
+                    signs.subspan( begin, size ) );
+            }
+            std::uint64_t nb_exact{ 0 };
+            for( const auto t : geode::Indices{ tetrahedra } )
+            {
+                if( signs[t] != zero )
+                {
+                    continue;
+                }
+                const auto& vertices = tetrahedra[t].vertices();
+                signs[t] = orient_3d_exact(
+                    vertices[0], vertices[1], vertices[2], vertices[3] );
+                nb_exact++;
+            }
+            if( count() )
+            {
+                orient_3d_counters.record( tetrahedra.size(), nb_exact );
+            }
+        }
+
+        void enable_statistics( bool enable )
+        {
+            statistics_enabled.store( enable, std::memory_order_relaxed );
+        }
+
+        geode::PredicatesStatistics statistics()
+        {
+            return { orient_2d_counters.get(), orient_3d_counters.get() };
+        }
+
+        void reset_statistics()
+        {
+            orient_2d_counters.reset();
+            orient_3d_counters.reset();
+        }
+
         SIGN det_3d( const geode::Vector3D& p0,
             const geode::Vector3D& p1,
             const geode::Vector3D& p2 )
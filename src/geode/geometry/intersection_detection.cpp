@@ -25,6 +25,7 @@
 
 #include <geode/geometry/basic_objects/infinite_line.hpp>
 #include <geode/geometry/basic_objects/segment.hpp>
+#include <geode/geometry/basic_objects/tetrahedron.hpp>
 #include <geode/geometry/basic_objects/triangle.hpp>
 #include <geode/geometry/bounding_box.hpp>
 #include <geode/geometry/internal/intersection_from_sides.hpp>
@@ -35,6 +36,26 @@
 
 namespace
 {
+    /*!
+     * Orientations of the line going through the two points relatively to
+     * the three edges of the triangle, evaluated by one batch predicate.
+     */
+    std::array< GEO::SIGN, 3 > triangle_edge_signs(
+        const geode::Point3D& point0,
+        const geode::Point3D& point1,
+        const geode::Triangle3D& triangle )
+    {
+        const auto& vertices = triangle.vertices();
+        const std::array< geode::Tetrahedron, 3 > tetrahedra{
+            geode::Tetrahedron{ point0, vertices[0], vertices[1], point1 },
+            geode::Tetrahedron{ point0, vertices[1], vertices[2], point1 },
+            geode::Tetrahedron{ point0, vertices[2], vertices[0], point1 }
+        };
+        std::array< GEO::SIGN, 3 > signs;
+        GEO::PCK::orient_3d_batch( tetrahedra, absl::MakeSpan( signs ) );
+        return signs;
+    }
+
     static constexpr std::array< geode::POSITION, 4 > VERTEX_ID_TO_POSITION{
         geode::POSITION::vertex0, geode::POSITION::vertex1,
         geode::POSITION::vertex2, geode::POSITION::vertex0
@@ -324,18 +345,11 @@ namespace geode
         }
 
         const auto other = line.origin() + line.direction();
-        const auto sign01 = GEO::PCK::orient_3d( line.origin(),
-            triangle.vertices()[0], triangle.vertices()[1], other );
-
-        const auto sign12 = GEO::PCK::orient_3d( line.origin(),
-            triangle.vertices()[1], triangle.vertices()[2], other );
-
-        const auto sign20 = GEO::PCK::orient_3d( line.origin(),
-            triangle.vertices()[2], triangle.vertices()[0], other );
-
+        const auto signs =
+            triangle_edge_signs( line.origin(), other, triangle );
         return internal::triangle_intersection_detection(
-            internal::side( sign01 ), internal::side( sign12 ),
-            internal::side( sign20 ) );
+            internal::side( signs[0] ), internal::side( signs[1] ),
+            internal::side( signs[2] ) );
     }
 
     SegmentTriangleIntersection segment_triangle_intersection_detection(
@@ -356,21 +370,12 @@ namespace geode
             return { POSITION::outside, POSITION::outside };
         }
 
-        const auto sign01 =
-            GEO::PCK::orient_3d( segment.vertices()[0], triangle.vertices()[0],
-                triangle.vertices()[1], segment.vertices()[1] );
-
-        const auto sign12 =
-            GEO::PCK::orient_3d( segment.vertices()[0], triangle.vertices()[1],
-                triangle.vertices()[2], segment.vertices()[1] );
-
-        const auto sign20 =
-            GEO::PCK::orient_3d( segment.vertices()[0], triangle.vertices()[2],
-                triangle.vertices()[0], segment.vertices()[1] );
-
+        const auto signs = triangle_edge_signs(
+            segment.vertices()[0], segment.vertices()[1], triangle );
         const auto triangle_position =
-            internal::triangle_intersection_detection( internal::side( sign01 ),
-                internal::side( sign12 ), internal::side( sign20 ) );
+            internal::triangle_intersection_detection(
+                internal::side( signs[0] ), internal::side( signs[1] ),
+                internal::side( signs[2] ) );
         if( triangle_position == POSITION::outside )
         {
             return { POSITION::outside, POSITION::outside };
@@ -27,10 +27,14 @@
 #include <geode/geometry/frame.hpp>
 #include <geode/geometry/intersection.hpp>
 
+#include <fstream>
+#include <limits>
 #include <mutex>
 #include <numeric>
+#include <thread>
 
 #include <absl/algorithm/container.h>
+#include <absl/container/fixed_array.h>
 
 #include <async++.h>
 
@@ -44,16 +48,60 @@ namespace geode
     template < index_t dimension >
     class NNSearch< dimension >::Impl
     {
+        static constexpr index_t CONCURRENT_BUILD_THRESHOLD{ 100000 };
+        static constexpr index_t QUERY_CHUNK_SIZE{ 1024 };
+
     public:
         explicit Impl( std::vector< Point< dimension > > points )
-            : cloud_{ std::move( points ) }, nn_tree_{ dimension, cloud_ }
+            : owned_points_{ std::move( points ) },
+              cloud_{ owned_points_ },
+              nn_tree_{ dimension, cloud_, tree_parameters() }
         {
             nn_tree_.buildIndex();
         }
 
+        Impl( absl::Span< const Point< dimension > > points,
+            std::string_view index_filename )
+            : cloud_{ points }, nn_tree_{ dimension, cloud_, tree_parameters() }
+        {
+            if( index_filename.empty() )
+            {
+                nn_tree_.buildIndex();
+                return;
+            }
+            std::ifstream file{ to_string( index_filename ),
+                std::ifstream::binary };
+            OPENGEODE_EXCEPTION( !file.fail(),
+                "[NNSearch::load_view] Failed to open file: ",
+                index_filename );
+            IndexHeader header;
+            file.read( reinterpret_cast< char* >( &header ), sizeof( header ) );
+            OPENGEODE_EXCEPTION( header.dimension == dimension
+                                     && header.nb_points == points.size(),
+                "[NNSearch::load_view] Saved index does not match the given "
+                "points" );
+            nn_tree_.loadIndex( file );
+            OPENGEODE_EXCEPTION( !file.fail(),
+                "[NNSearch::load_view] Failed to read index from file: ",
+                index_filename );
+        }
+
+        void save_index( std::string_view filename ) const
+        {
+            std::ofstream file{ to_string( filename ), std::ofstream::binary };
+            OPENGEODE_EXCEPTION( !file.fail(),
+                "[NNSearch::save_index] Failed to open file: ", filename );
+            const IndexHeader header{ dimension, nb_points() };
+            file.write(
+                reinterpret_cast< const char* >( &header ), sizeof( header ) );
+            nn_tree_.saveIndex( file );
+        }
+
         const Point< dimension >& point( const index_t index ) const
         {
-            return cloud_.points.at( index );
+            OPENGEODE_ASSERT( index < nb_points(),
+                "[NNSearch::point] Invalid point index" );
+            return cloud_.points[index];
         }
 
         index_t nb_points() const
@@ -114,6 +162,163 @@ namespace geode
             return indices;
         }
 
+        index_t nearest_vertex( const Point< dimension >& point ) const
+        {
+            index_t result{ NO_ID };
+            double distance;
+            nn_tree_.knnSearch( &copy( point )[0], 1, &result, &distance );
+            return result;
+        }
+
+        std::vector< index_t > nearest_vertices(
+            absl::Span< const Point< dimension > > points ) const
+        {
+            std::vector< index_t > result( points.size(), NO_ID );
+            async::parallel_for( async::irange( size_t{ 0 }, points.size() ),
+                [&points, &result, this]( size_t query ) {
+                    result[query] = nearest_vertex( points[query] );
+                } );
+            return result;
+        }
+
+        typename NNSearch< dimension >::BulkNeighbors bulk_nearest_vertices(
+            absl::Span< const Point< dimension > > points,
+            index_t nb_neighbors,
+            bool compute_distances ) const
+        {
+            const auto nb_queries = checked_index( points.size() );
+            const auto nb_results = std::min( nb_neighbors, nb_points() );
+            OPENGEODE_EXCEPTION( nb_results == 0
+                                     || nb_queries <= std::numeric_limits<
+                                            index_t >::max() / nb_results,
+                "[NNSearch::bulk_neighbors] Too many neighbors requested: ",
+                nb_queries, " queries of ", nb_results,
+                " neighbors cannot be indexed by index_t" );
+            typename NNSearch< dimension >::BulkNeighbors result;
+            result.offsets.resize( nb_queries + 1 );
+            for( const auto query : Range{ nb_queries + 1 } )
+            {
+                result.offsets[query] = query * nb_results;
+            }
+            if( nb_results == 0 )
+            {
+                return result;
+            }
+            result.neighbors.resize( nb_queries * nb_results );
+            if( compute_distances )
+            {
+                result.squared_distances.resize( nb_queries * nb_results );
+            }
+            async::parallel_for(
+                async::irange( index_t{ 0 }, nb_chunks( nb_queries ) ),
+                [&points, &result, nb_queries, nb_results, compute_distances,
+                    this]( index_t chunk ) {
+                    std::vector< double > distances_buffer(
+                        compute_distances ? 0 : nb_results );
+                    const auto begin = chunk * QUERY_CHUNK_SIZE;
+                    const auto end =
+                        std::min( begin + QUERY_CHUNK_SIZE, nb_queries );
+                    for( const auto query : Range{ begin, end } )
+                    {
+                        const auto offset = query * nb_results;
+                        auto* distances =
+                            compute_distances
+                                ? &result.squared_distances[offset]
+                                : distances_buffer.data();
+                        nn_tree_.knnSearch( &copy( points[query] )[0],
+                            nb_results, &result.neighbors[offset], distances );
+                    }
+                } );
+            return result;
+        }
+
+        typename NNSearch< dimension >::BulkNeighbors bulk_radius_vertices(
+            absl::Span< const Point< dimension > > points,
+            double threshold_distance,
+            bool compute_distances ) const
+        {
+            struct ChunkResults
+            {
+                std::vector< index_t > nb_neighbors;
+                std::vector< index_t > neighbors;
+                std::vector< double > squared_distances;
+            };
+            const auto nb_queries = checked_index( points.size() );
+            const auto nb_query_chunks = nb_chunks( nb_queries );
+            absl::FixedArray< ChunkResults > chunks( nb_query_chunks );
+            const auto squared_radius = threshold_distance * threshold_distance;
+            async::parallel_for( async::irange( index_t{ 0 }, nb_query_chunks ),
+                [&points, &chunks, nb_queries, squared_radius,
+                    compute_distances, this]( index_t chunk ) {
+                    auto& chunk_results = chunks[chunk];
+                    std::vector< nanoflann::ResultItem< index_t, double > >
+                        results;
+                    nanoflann::SearchParameters params;
+                    params.sorted = true;
+                    const auto begin = chunk * QUERY_CHUNK_SIZE;
+                    const auto end =
+                        std::min( begin + QUERY_CHUNK_SIZE, nb_queries );
+                    chunk_results.nb_neighbors.reserve( end - begin );
+                    for( const auto query : Range{ begin, end } )
+                    {
+                        nn_tree_.radiusSearch( &copy( points[query] )[0],
+                            squared_radius, results, params );
+                        chunk_results.nb_neighbors.push_back(
+                            checked_index( results.size() ) );
+                        for( const auto& item : results )
+                        {
+                            chunk_results.neighbors.push_back( item.first );
+                            if( compute_distances )
+                            {
+                                chunk_results.squared_distances.push_back(
+                                    item.second );
+                            }
+                        }
+                    }
+                } );
+            std::size_t nb_found_neighbors{ 0 };
+            for( const auto& chunk_results : chunks )
+            {
+                nb_found_neighbors += chunk_results.neighbors.size();
+            }
+            OPENGEODE_EXCEPTION(
+                nb_found_neighbors < std::numeric_limits< index_t >::max(),
+                "[NNSearch::bulk_radius_neighbors] Too many neighbors found: ",
+                nb_found_neighbors, " neighbors cannot be indexed by index_t" );
+            typename NNSearch< dimension >::BulkNeighbors result;
+            result.offsets.resize( nb_queries + 1 );
+            result.offsets[0] = 0;
+            absl::FixedArray< index_t > chunk_offsets( nb_query_chunks + 1 );
+            chunk_offsets[0] = 0;
+            index_t query{ 0 };
+            for( const auto chunk : Indices{ chunks } )
+            {
+                for( const auto nb_neighbors : chunks[chunk].nb_neighbors )
+                {
+                    result.offsets[query + 1] =
+                        result.offsets[query] + nb_neighbors;
+                    query++;
+                }
+                chunk_offsets[chunk + 1] =
+                    chunk_offsets[chunk]
+                    + checked_index( chunks[chunk].neighbors.size() );
+            }
+            result.neighbors.resize( result.offsets.back() );
+            if( compute_distances )
+            {
+                result.squared_distances.resize( result.offsets.back() );
+            }
+            async::parallel_for( async::irange( index_t{ 0 }, nb_query_chunks ),
+                [&chunks, &chunk_offsets, &result]( index_t chunk ) {
+                    absl::c_copy( chunks[chunk].neighbors,
+                        result.neighbors.begin() + chunk_offsets[chunk] );
+                    absl::c_copy( chunks[chunk].squared_distances,
+                        result.squared_distances.begin()
+                            + chunk_offsets[chunk] );
+                } );
+            return result;
+        }
+
         std::vector< index_t > nearest_vertices(
             const Point< dimension >& point, const index_t nb_neighbors ) const
         {
@@ -196,9 +401,15 @@ namespace geode
             }
             return result;
         }
+        struct IndexHeader
+        {
+            std::uint64_t dimension;
+            std::uint64_t nb_points;
+        };
+
         struct PointCloud
         {
-            std::vector< Point< dimension > > points;
+            absl::Span< const Point< dimension > > points;
 
             size_t kdtree_get_point_count() const
             {
@@ -223,7 +434,26 @@ namespace geode
             }
         };
 
+        static index_t nb_chunks( index_t nb_queries )
+        {
+            return ( nb_queries + QUERY_CHUNK_SIZE - 1 ) / QUERY_CHUNK_SIZE;
+        }
+
+        nanoflann::KDTreeSingleIndexAdaptorParams tree_parameters() const
+        {
+            nanoflann::KDTreeSingleIndexAdaptorParams parameters;
+            parameters.flags =
+                nanoflann::KDTreeSingleIndexAdaptorFlags::SkipInitialBuildIndex;
+            if( cloud_.points.size() >= CONCURRENT_BUILD_THRESHOLD )
+            {
+                parameters.n_thread_build =
+                    std::max( 1u, std::thread::hardware_concurrency() );
+            }
+            return parameters;
+        }
+
     private:
+        const std::vector< Point< dimension > > owned_points_;
         const PointCloud cloud_;
         nanoflann::KDTreeSingleIndexAdaptor<
             nanoflann::L2_Simple_Adaptor< double, PointCloud >,
@@ -239,12 +469,43 @@ namespace geode
     {
     }
 
+    template < index_t dimension >
+    NNSearch< dimension >::NNSearch(
+        absl::Span< const Point< dimension > > points,
+        std::string_view index_filename )
+        : impl_( points, index_filename )
+    {
+    }
+
     template < index_t dimension >
     NNSearch< dimension >::NNSearch( NNSearch&& ) noexcept = default;
 
     template < index_t dimension >
     NNSearch< dimension >::~NNSearch() = default;
 
+    template < index_t dimension >
+    NNSearch< dimension > NNSearch< dimension >::create_view(
+        absl::Span< const Point< dimension > > points )
+    {
+        return { points, "" };
+    }
+
+    template < index_t dimension >
+    NNSearch< dimension > NNSearch< dimension >::load_view(
+        absl::Span< const Point< dimension > > points,
+        std::string_view index_filename )
+    {
+        OPENGEODE_EXCEPTION( !index_filename.empty(),
+            "[NNSearch::load_view] Empty index filename" );
+        return { points, index_filename };
+    }
+
+    template < index_t dimension >
+    void NNSearch< dimension >::save_index( std::string_view filename ) const
+    {
+        impl_->save_index( filename );
+    }
+
     template < index_t dimension >
     const Point< dimension >& NNSearch< dimension >::point(
         index_t index ) const
@@ -262,7 +523,7 @@ namespace geode
     index_t NNSearch< dimension >::closest_neighbor(
         const Point< dimension >& point ) const
     {
-        return impl_->nearest_vertices( point, 1 ).front();
+        return impl_->nearest_vertex( point );
     }
 
     template < index_t dimension >
@@ -287,6 +548,35 @@ namespace geode
         return impl_->nearest_vertices( point, nb_neighbors );
     }
 
+    template < index_t dimension >
+    std::vector< index_t > NNSearch< dimension >::closest_neighbors(
+        absl::Span< const Point< dimension > > points ) const
+    {
+        return impl_->nearest_vertices( points );
+    }
+
+    template < index_t dimension >
+    typename NNSearch< dimension >::BulkNeighbors
+        NNSearch< dimension >::bulk_neighbors(
+            absl::Span< const Point< dimension > > points,
+            index_t nb_neighbors,
+            bool compute_distances ) const
+    {
+        return impl_->bulk_nearest_vertices(
+            points, nb_neighbors, compute_distances );
+    }
+
+    template < index_t dimension >
+    typename NNSearch< dimension >::BulkNeighbors
+        NNSearch< dimension >::bulk_radius_neighbors(
+            absl::Span< const Point< dimension > > points,
+            double threshold_distance,
+            bool compute_distances ) const
+    {
+        return impl_->bulk_radius_vertices(
+            points, threshold_distance, compute_distances );
+    }
+
     template < geode::index_t dimension >
     typename geode::NNSearch< dimension >::ColocatedInfo
         NNSearch< dimension >::colocated_index_mapping(
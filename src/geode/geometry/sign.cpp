@@ -23,6 +23,8 @@
 
 #include <geode/geometry/sign.hpp>
 
+#include <absl/strings/str_cat.h>
+
 #include <geode/geometry/basic_objects/tetrahedron.hpp>
 #include <geode/geometry/basic_objects/triangle.hpp>
 #include <geode/geometry/internal/position_from_sides.hpp>
@@ -66,4 +68,65 @@ namespace geode
             vertices[2].get().value( axis2 ) } };
         return triangle_area_sign( { pt0, pt1, pt2 } );
     }
+
+    std::vector< Sign > tetrahedra_volume_signs(
+        absl::Span< const Tetrahedron > tetrahedra )
+    {
+        std::vector< GEO::SIGN > signs( tetrahedra.size() );
+        GEO::PCK::orient_3d_batch( tetrahedra, absl::MakeSpan( signs ) );
+        std::vector< Sign > result;
+        result.reserve( signs.size() );
+        for( const auto sign : signs )
+        {
+            result.push_back( internal::side( sign ) );
+        }
+        return result;
+    }
+
+    std::vector< Sign > triangles_area_signs(
+        absl::Span< const Triangle2D > triangles )
+    {
+        std::vector< GEO::SIGN > signs( triangles.size() );
+        GEO::PCK::orient_2d_batch( triangles, absl::MakeSpan( signs ) );
+        std::vector< Sign > result;
+        result.reserve( signs.size() );
+        for( const auto sign : signs )
+        {
+            result.push_back( internal::side( sign ) );
+        }
+        return result;
+    }
+
+    double PredicateCounters::exact_ratio() const
+    {
+        if( nb_evaluations == 0 )
+        {
+            return 0;
+        }
+        return static_cast< double >( nb_exact_evaluations )
+               / static_cast< double >( nb_evaluations );
+    }
+
+    std::string PredicatesStatistics::string() const
+    {
+        return absl::StrCat( "orient_2d: ", orient_2d.nb_evaluations,
+            " evaluations (", orient_2d.nb_exact_evaluations,
+            " exact), orient_3d: ", orient_3d.nb_evaluations,
+            " evaluations (", orient_3d.nb_exact_evaluations, " exact)" );
+    }
+
+    void enable_predicates_statistics( bool enable )
+    {
+        GEO::PCK::enable_statistics( enable );
+    }
+
+    PredicatesStatistics predicates_statistics()
+    {
+        return GEO::PCK::statistics();
+    }
+
+    void reset_predicates_statistics()
+    {
+        GEO::PCK::reset_statistics();
+    }
 } // namespace geode
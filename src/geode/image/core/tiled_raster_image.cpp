@@ -0,0 +1,717 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/image/core/tiled_raster_image.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+#include <async++.h>
+
+#include <absl/algorithm/container.h>
+#include <absl/container/fixed_array.h>
+#include <absl/container/flat_hash_map.h>
+#include <absl/types/span.h>
+
+#include <geode/basic/pimpl_impl.hpp>
+#include <geode/basic/range.hpp>
+
+#include <geode/image/core/raster_image.hpp>
+#include <geode/image/core/rgb_color.hpp>
+
+namespace
+{
+    constexpr std::uint32_t TILED_IMAGE_MAGIC{ 0x4f475449 };
+    constexpr std::uint32_t TILED_IMAGE_VERSION{ 1 };
+    constexpr geode::index_t NB_CHANNELS{ 3 };
+    constexpr geode::index_t NB_TILES_PER_WRITE{ 64 };
+
+    template < typename T >
+    void write_value( std::ofstream& file, T value )
+    {
+        file.write( reinterpret_cast< const char* >( &value ), sizeof( T ) );
+    }
+
+    /*!
+     * Indices are stored on 32 bits to keep the file format independent of
+     * the index_t size.
+     */
+    template < typename Index >
+    std::uint32_t stored_index( Index value )
+    {
+        if constexpr( std::is_same_v< Index, std::uint32_t > )
+        {
+            return value;
+        }
+        else
+        {
+            OPENGEODE_EXCEPTION(
+                value <= std::numeric_limits< std::uint32_t >::max(),
+                "[save_tiled_raster_image] Value ", value,
+                " does not fit in the tiled image file format" );
+            return static_cast< std::uint32_t >( value );
+        }
+    }
+
+    template < typename T >
+    T read_value( std::ifstream& file )
+    {
+        T value;
+        file.read( reinterpret_cast< char* >( &value ), sizeof( T ) );
+        return value;
+    }
+
+    template < geode::index_t dimension >
+    using CellArrayIndices = std::array< geode::index_t, dimension >;
+
+    template < geode::index_t dimension >
+    geode::index_t nb_cells( const CellArrayIndices< dimension >& sizes )
+    {
+        geode::index_t result{ 1 };
+        for( const auto d : geode::LRange{ dimension } )
+        {
+            result *= sizes[d];
+        }
+        return result;
+    }
+
+    template < geode::index_t dimension >
+    geode::index_t linear_index( const CellArrayIndices< dimension >& indices,
+        const CellArrayIndices< dimension >& sizes )
+    {
+        geode::index_t index{ 0 };
+        geode::index_t offset{ 1 };
+        for( const auto d : geode::LRange{ dimension } )
+        {
+            index += indices[d] * offset;
+            offset *= sizes[d];
+        }
+        return index;
+    }
+
+    template < geode::index_t dimension >
+    CellArrayIndices< dimension > cell_indices(
+        geode::index_t index, const CellArrayIndices< dimension >& sizes )
+    {
+        CellArrayIndices< dimension > indices;
+        for( const auto d : geode::LRange{ dimension } )
+        {
+            indices[d] = index % sizes[d];
+            index /= sizes[d];
+        }
+        return indices;
+    }
+
+    /*!
+     * Position of the levels and tiles in a tiled image file.
+     * Tiles of a level are ordered with the first direction varying fastest,
+     * as the cells inside a tile.
+     */
+    template < geode::index_t dimension >
+    class TiledLayout
+    {
+    public:
+        TiledLayout() = default;
+
+        TiledLayout( geode::index_t tile_size,
+            std::vector< CellArrayIndices< dimension > > level_sizes )
+            : tile_size_( tile_size ), level_sizes_( std::move( level_sizes ) )
+        {
+            OPENGEODE_EXCEPTION( tile_size_ != 0,
+                "[TiledRasterImage] Tile size should not be null" );
+            CellArrayIndices< dimension > tile_sizes;
+            tile_sizes.fill( tile_size_ );
+            tile_volume_ = nb_cells< dimension >( tile_sizes );
+            level_first_tiles_.push_back( 0 );
+            for( const auto& sizes : level_sizes_ )
+            {
+                auto& nb_tiles = level_nb_tiles_.emplace_back();
+                for( const auto d : geode::LRange{ dimension } )
+                {
+                    nb_tiles[d] = ( sizes[d] + tile_size_ - 1 ) / tile_size_;
+                }
+                const auto nb_level_tiles = nb_cells< dimension >( nb_tiles );
+                level_first_tiles_.push_back(
+                    level_first_tiles_.back() + nb_level_tiles );
+            }
+        }
+
+        geode::index_t tile_size() const
+        {
+            return tile_size_;
+        }
+
+        geode::index_t tile_volume() const
+        {
+            return tile_volume_;
+        }
+
+        geode::index_t nb_levels() const
+        {
+            return geode::checked_index( level_sizes_.size() );
+        }
+
+        const CellArrayIndices< dimension >& level_sizes(
+            geode::index_t level ) const
+        {
+            return level_sizes_[level];
+        }
+
+        geode::index_t nb_level_tiles( geode::index_t level ) const
+        {
+            return level_first_tiles_[level + 1] - level_first_tiles_[level];
+        }
+
+        /*!
+         * Global tile index and position of the cell in the tile.
+         */
+        std::pair< geode::index_t, geode::index_t > tile(
+            geode::index_t level,
+            const CellArrayIndices< dimension >& indices ) const
+        {
+            CellArrayIndices< dimension > tile_indices;
+            CellArrayIndices< dimension > local_indices;
+            CellArrayIndices< dimension > tile_sizes;
+            for( const auto d : geode::LRange{ dimension } )
+            {
+                OPENGEODE_ASSERT( indices[d] < level_sizes_[level][d],
+                    "[TiledRasterImage] Invalid cell indices" );
+                tile_indices[d] = indices[d] / tile_size_;
+                local_indices[d] = indices[d] % tile_size_;
+                tile_sizes[d] = tile_size_;
+            }
+            return { level_first_tiles_[level]
+                         + linear_index< dimension >(
+                             tile_indices, level_nb_tiles_[level] ),
+                linear_index< dimension >( local_indices, tile_sizes ) };
+        }
+
+        /*!
+         * Indices of the first cell of a tile of the given level.
+         */
+        CellArrayIndices< dimension > tile_origin(
+            geode::index_t level, geode::index_t level_tile ) const
+        {
+            auto origin =
+                cell_indices< dimension >( level_tile, level_nb_tiles_[level] );
+            for( const auto d : geode::LRange{ dimension } )
+            {
+                origin[d] *= tile_size_;
+            }
+            return origin;
+        }
+
+    private:
+        geode::index_t tile_size_{ 0 };
+        geode::index_t tile_volume_{ 0 };
+        std::vector< CellArrayIndices< dimension > > level_sizes_;
+        std::vector< CellArrayIndices< dimension > > level_nb_tiles_;
+        std::vector< geode::index_t > level_first_tiles_;
+    };
+
+    template < geode::index_t dimension >
+    std::vector< geode::RGBColor > image_colors(
+        const geode::RasterImage< dimension >& image )
+    {
+        std::vector< geode::RGBColor > colors( image.nb_cells() );
+        async::parallel_for(
+            async::irange( geode::index_t{ 0 }, image.nb_cells() ),
+            [&image, &colors]( geode::index_t cell ) {
+                colors[cell] = image.color( cell );
+            } );
+        return colors;
+    }
+
+    template < geode::index_t dimension >
+    std::vector< geode::RGBColor > coarser_level_colors(
+        const std::vector< geode::RGBColor >& colors,
+        const CellArrayIndices< dimension >& sizes,
+        const CellArrayIndices< dimension >& coarser_sizes )
+    {
+        const auto nb_coarser_cells = nb_cells< dimension >( coarser_sizes );
+        std::vector< geode::RGBColor > coarser_colors( nb_coarser_cells );
+        async::parallel_for(
+            async::irange( geode::index_t{ 0 }, nb_coarser_cells ),
+            [&colors, &sizes, &coarser_sizes, &coarser_colors](
+                geode::index_t cell ) {
+                const auto indices =
+                    cell_indices< dimension >( cell, coarser_sizes );
+                std::array< geode::index_t, NB_CHANNELS > sums{ 0, 0, 0 };
+                geode::index_t nb_children{ 0 };
+                for( const auto child : geode::Range{ 1u << dimension } )
+                {
+                    CellArrayIndices< dimension > child_indices;
+                    bool valid{ true };
+                    for( const auto d : geode::LRange{ dimension } )
+                    {
+                        child_indices[d] =
+                            2 * indices[d] + ( ( child >> d ) & 1 );
+                        valid = valid && child_indices[d] < sizes[d];
+                    }
+                    if( !valid )
+                    {
+                        continue;
+                    }
+                    const auto& color = colors[linear_index< dimension >(
+                        child_indices, sizes )];
+                    sums[0] += color.red();
+                    sums[1] += color.green();
+                    sums[2] += color.blue();
+                    nb_children++;
+                }
+                const auto average = [nb_children]( geode::index_t sum ) {
+                    return static_cast< geode::local_index_t >(
+                        ( sum + nb_children / 2 ) / nb_children );
+                };
+                coarser_colors[cell] = { average( sums[0] ),
+                    average( sums[1] ), average( sums[2] ) };
+            } );
+        return coarser_colors;
+    }
+
+    template < geode::index_t dimension >
+    void fill_tile( const TiledLayout< dimension >& layout,
+        geode::index_t level,
+        geode::index_t level_tile,
+        const std::vector< geode::RGBColor >& colors,
+        absl::Span< geode::local_index_t > tile )
+    {
+        const auto& sizes = layout.level_sizes( level );
+        const auto origin = layout.tile_origin( level, level_tile );
+        CellArrayIndices< dimension > tile_sizes;
+        tile_sizes.fill( layout.tile_size() );
+        for( const auto local : geode::Range{ layout.tile_volume() } )
+        {
+            auto indices = cell_indices< dimension >( local, tile_sizes );
+            bool inside{ true };
+            for( const auto d : geode::LRange{ dimension } )
+            {
+                indices[d] += origin[d];
+                inside = inside && indices[d] < sizes[d];
+            }
+            if( !inside )
+            {
+                continue;
+            }
+            const auto& color =
+                colors[linear_index< dimension >( indices, sizes )];
+            tile[NB_CHANNELS * local] = color.red();
+            tile[NB_CHANNELS * local + 1] = color.green();
+            tile[NB_CHANNELS * local + 2] = color.blue();
+        }
+    }
+
+    template < geode::index_t dimension >
+    void write_level_tiles( std::ofstream& file,
+        const TiledLayout< dimension >& layout,
+        geode::index_t level,
+        const std::vector< geode::RGBColor >& colors )
+    {
+        const auto tile_bytes = NB_CHANNELS * layout.tile_volume();
+        std::vector< geode::local_index_t > buffer(
+            NB_TILES_PER_WRITE * tile_bytes );
+        const auto nb_tiles = layout.nb_level_tiles( level );
+        for( geode::index_t first{ 0 }; first < nb_tiles;
+             first += NB_TILES_PER_WRITE )
+        {
+            const auto nb_batch_tiles =
+                std::min( NB_TILES_PER_WRITE, nb_tiles - first );
+            absl::c_fill( buffer, geode::local_index_t{ 0 } );
+            async::parallel_for(
+                async::irange( geode::index_t{ 0 }, nb_batch_tiles ),
+                [&layout, level, first, &colors, &buffer, tile_bytes](
+                    geode::index_t t ) {
+                    fill_tile( layout, level, first + t, colors,
+                        absl::MakeSpan( buffer ).subspan(
+                            t * tile_bytes, tile_bytes ) );
+                } );
+            file.write( reinterpret_cast< const char* >( buffer.data() ),
+                static_cast< std::streamsize >(
+                    nb_batch_tiles * tile_bytes ) );
+        }
+    }
+} // namespace
+
+namespace geode
+{
+    template < index_t dimension >
+    class TiledRasterImage< dimension >::Impl
+    {
+        static constexpr index_t MAX_NB_CACHE_SHARDS{ 16 };
+        using Tile = std::vector< local_index_t >;
+        using SharedTile = std::shared_ptr< const Tile >;
+
+        /*!
+         * Least recently used tiles of a subset of the tile indices, with
+         * its own mutex so that concurrent accesses to tiles of different
+         * shards do not wait for each other.
+         */
+        class TileCacheShard
+        {
+            using CachedTiles = std::list< std::pair< index_t, SharedTile > >;
+
+        public:
+            void set_capacity( index_t capacity )
+            {
+                capacity_ = capacity;
+            }
+
+            SharedTile find( index_t tile_id )
+            {
+                std::lock_guard< std::mutex > lock{ mutex_ };
+                const auto it = tile_positions_.find( tile_id );
+                if( it == tile_positions_.end() )
+                {
+                    return nullptr;
+                }
+                cached_tiles_.splice(
+                    cached_tiles_.begin(), cached_tiles_, it->second );
+                return it->second->second;
+            }
+
+            /*!
+             * Add a loaded tile to the cache, evicting the least recently
+             * used one if needed. If the tile has been added meanwhile by
+             * another thread, the cached tile is returned.
+             */
+            SharedTile add( index_t tile_id, SharedTile tile )
+            {
+                std::lock_guard< std::mutex > lock{ mutex_ };
+                const auto it = tile_positions_.find( tile_id );
+                if( it != tile_positions_.end() )
+                {
+                    return it->second->second;
+                }
+                if( cached_tiles_.size() == capacity_ )
+                {
+                    tile_positions_.erase( cached_tiles_.back().first );
+                    cached_tiles_.pop_back();
+                }
+                cached_tiles_.emplace_front( tile_id, std::move( tile ) );
+                tile_positions_.emplace( tile_id, cached_tiles_.begin() );
+                return cached_tiles_.front().second;
+            }
+
+            index_t size() const
+            {
+                std::lock_guard< std::mutex > lock{ mutex_ };
+                return checked_index( cached_tiles_.size() );
+            }
+
+        private:
+            mutable std::mutex mutex_;
+            index_t capacity_{ 1 };
+            CachedTiles cached_tiles_;
+            absl::flat_hash_map< index_t, typename CachedTiles::iterator >
+                tile_positions_;
+        };
+
+    public:
+        Impl( std::string_view filename, index_t max_nb_cached_tiles )
+            : filename_{ to_string( filename ) },
+              cache_shards_( std::clamp(
+                  max_nb_cached_tiles, index_t{ 1 }, MAX_NB_CACHE_SHARDS ) )
+        {
+            auto file = std::make_unique< std::ifstream >(
+                filename_, std::ifstream::binary );
+            OPENGEODE_EXCEPTION( *file,
+                "[TiledRasterImage] Failed to open file: ", filename );
+            OPENGEODE_EXCEPTION(
+                read_value< std::uint32_t >( *file ) == TILED_IMAGE_MAGIC
+                    && read_value< std::uint32_t >( *file )
+                           == TILED_IMAGE_VERSION,
+                "[TiledRasterImage] Wrong file format: ", filename );
+            OPENGEODE_EXCEPTION(
+                read_value< std::uint32_t >( *file ) == dimension,
+                "[TiledRasterImage] Wrong image dimension: ", filename );
+            const auto tile_size = read_value< std::uint32_t >( *file );
+            const auto nb_levels = read_value< std::uint32_t >( *file );
+            std::vector< CellArrayIndices< dimension > > level_sizes(
+                nb_levels );
+            for( auto& sizes : level_sizes )
+            {
+                for( const auto d : LRange{ dimension } )
+                {
+                    sizes[d] = read_value< std::uint32_t >( *file );
+                }
+            }
+            OPENGEODE_EXCEPTION( *file,
+                "[TiledRasterImage] Failed to read header: ", filename );
+            layout_ = TiledLayout< dimension >{ tile_size,
+                std::move( level_sizes ) };
+            data_start_ = file->tellg();
+            files_.emplace_back( std::move( file ) );
+            const auto nb_tiles = std::max( max_nb_cached_tiles, index_t{ 1 } );
+            const auto nb_shards = nb_cache_shards();
+            for( const auto shard : Range{ nb_shards } )
+            {
+                cache_shards_[shard].set_capacity(
+                    nb_tiles / nb_shards
+                    + ( shard < nb_tiles % nb_shards ? 1 : 0 ) );
+            }
+        }
+
+        const TiledLayout< dimension >& layout() const
+        {
+            return layout_;
+        }
+
+        RGBColor color( index_t level, const CellIndices& indices ) const
+        {
+            RGBColor result;
+            colors( level, { &indices, 1 }, { &result, 1 } );
+            return result;
+        }
+
+        void colors( index_t level,
+            absl::Span< const CellIndices > cells,
+            absl::Span< RGBColor > colors ) const
+        {
+            OPENGEODE_ASSERT( level < layout_.nb_levels(),
+                "[TiledRasterImage::colors] Invalid level" );
+            OPENGEODE_ASSERT( cells.size() == colors.size(),
+                "[TiledRasterImage::colors] Wrong output size" );
+            index_t current_tile_id{ NO_ID };
+            SharedTile current_tile;
+            for( const auto c : Indices{ cells } )
+            {
+                const auto [tile_id, local] = layout_.tile( level, cells[c] );
+                if( tile_id != current_tile_id )
+                {
+                    current_tile_id = tile_id;
+                    current_tile = tile( tile_id );
+                }
+                const auto base = NB_CHANNELS * local;
+                colors[c] = { ( *current_tile )[base],
+                    ( *current_tile )[base + 1], ( *current_tile )[base + 2] };
+            }
+        }
+
+        index_t nb_cached_tiles() const
+        {
+            index_t result{ 0 };
+            for( const auto& shard : cache_shards_ )
+            {
+                result += shard.size();
+            }
+            return result;
+        }
+
+    private:
+        /*!
+         * Return the tile, reading it from the file if it is not cached.
+         * The file is read without holding any cache lock.
+         */
+        SharedTile tile( index_t tile_id ) const
+        {
+            auto& shard = cache_shards_[tile_id % nb_cache_shards()];
+            if( auto cached_tile = shard.find( tile_id ) )
+            {
+                return cached_tile;
+            }
+            return shard.add( tile_id, read_tile( tile_id ) );
+        }
+
+        index_t nb_cache_shards() const
+        {
+            return checked_index( cache_shards_.size() );
+        }
+
+        SharedTile read_tile( index_t tile_id ) const
+        {
+            const auto tile_bytes = NB_CHANNELS * layout_.tile_volume();
+            auto tile = std::make_shared< Tile >( tile_bytes );
+            auto file = acquire_file();
+            file->seekg( data_start_
+                         + static_cast< std::streamoff >( tile_id )
+                               * static_cast< std::streamoff >(
+                                   tile_bytes ) );
+            file->read( reinterpret_cast< char* >( tile->data() ),
+                static_cast< std::streamsize >( tile_bytes ) );
+            OPENGEODE_EXCEPTION(
+                *file, "[TiledRasterImage] Failed to read tile ", tile_id );
+            release_file( std::move( file ) );
+            return tile;
+        }
+
+        /*!
+         * Take an opened file from the pool, or open a new one if all of
+         * them are being read, so that tiles are read concurrently.
+         */
+        std::unique_ptr< std::ifstream > acquire_file() const
+        {
+            {
+                std::lock_guard< std::mutex > lock{ files_mutex_ };
+                if( !files_.empty() )
+                {
+                    auto file = std::move( files_.back() );
+                    files_.pop_back();
+                    return file;
+                }
+            }
+            auto file = std::make_unique< std::ifstream >(
+                filename_, std::ifstream::binary );
+            OPENGEODE_EXCEPTION( *file,
+                "[TiledRasterImage] Failed to open file: ", filename_ );
+            return file;
+        }
+
+        void release_file( std::unique_ptr< std::ifstream > file ) const
+        {
+            std::lock_guard< std::mutex > lock{ files_mutex_ };
+            files_.emplace_back( std::move( file ) );
+        }
+
+    private:
+        std::string filename_;
+        std::streamoff data_start_{ 0 };
+        TiledLayout< dimension > layout_;
+        mutable std::mutex files_mutex_;
+        mutable std::vector< std::unique_ptr< std::ifstream > > files_;
+        mutable absl::FixedArray< TileCacheShard > cache_shards_;
+    };
+
+    template < index_t dimension >
+    TiledRasterImage< dimension >::TiledRasterImage(
+        std::string_view filename, index_t max_nb_cached_tiles )
+        : impl_{ filename, max_nb_cached_tiles }
+    {
+    }
+
+    template < index_t dimension >
+    TiledRasterImage< dimension >::TiledRasterImage(
+        TiledRasterImage&& ) noexcept = default;
+
+    template < index_t dimension >
+    TiledRasterImage< dimension >::~TiledRasterImage() = default;
+
+    template < index_t dimension >
+    index_t TiledRasterImage< dimension >::nb_levels() const
+    {
+        return impl_->layout().nb_levels();
+    }
+
+    template < index_t dimension >
+    index_t TiledRasterImage< dimension >::tile_size() const
+    {
+        return impl_->layout().tile_size();
+    }
+
+    template < index_t dimension >
+    index_t TiledRasterImage< dimension >::nb_cells_in_direction(
+        index_t level, index_t direction ) const
+    {
+        return impl_->layout().level_sizes( level )[direction];
+    }
+
+    template < index_t dimension >
+    RGBColor TiledRasterImage< dimension >::color(
+        index_t level, const CellIndices& cell_indices ) const
+    {
+        return impl_->color( level, cell_indices );
+    }
+
+    template < index_t dimension >
+    void TiledRasterImage< dimension >::colors( index_t level,
+        absl::Span< const CellIndices > cells,
+        absl::Span< RGBColor > colors ) const
+    {
+        impl_->colors( level, cells, colors );
+    }
+
+    template < index_t dimension >
+    index_t TiledRasterImage< dimension >::nb_cached_tiles() const
+    {
+        return impl_->nb_cached_tiles();
+    }
+
+    template < index_t dimension >
+    void save_tiled_raster_image( const RasterImage< dimension >& image,
+        std::string_view filename,
+        index_t tile_size,
+        bool build_mipmaps )
+    {
+        std::vector< CellArrayIndices< dimension > > level_sizes( 1 );
+        for( const auto d : LRange{ dimension } )
+        {
+            level_sizes[0][d] = image.nb_cells_in_direction( d );
+            OPENGEODE_EXCEPTION( level_sizes[0][d] != 0,
+                "[save_tiled_raster_image] Cannot save an empty image" );
+        }
+        while(
+            build_mipmaps && nb_cells< dimension >( level_sizes.back() ) > 1 )
+        {
+            auto coarser_sizes = level_sizes.back();
+            for( auto& size : coarser_sizes )
+            {
+                size = ( size + 1 ) / 2;
+            }
+            level_sizes.push_back( coarser_sizes );
+        }
+        const TiledLayout< dimension > layout{ tile_size, level_sizes };
+        std::vector< std::uint32_t > header{ TILED_IMAGE_MAGIC,
+            TILED_IMAGE_VERSION, stored_index( dimension ),
+            stored_index( tile_size ), stored_index( layout.nb_levels() ) };
+        for( const auto& sizes : level_sizes )
+        {
+            for( const auto size : sizes )
+            {
+                header.push_back( stored_index( size ) );
+            }
+        }
+        std::ofstream file{ to_string( filename ), std::ofstream::binary };
+        OPENGEODE_EXCEPTION( file,
+            "[save_tiled_raster_image] Failed to open file: ", filename );
+        for( const auto value : header )
+        {
+            write_value( file, value );
+        }
+        auto colors = image_colors( image );
+        for( const auto level : Indices{ level_sizes } )
+        {
+            if( level != 0 )
+            {
+                colors = coarser_level_colors< dimension >(
+                    colors, level_sizes[level - 1], level_sizes[level] );
+            }
+            write_level_tiles( file, layout, level, colors );
+        }
+        OPENGEODE_EXCEPTION( file,
+            "[save_tiled_raster_image] Failed to write file: ", filename );
+    }
+
+    template class opengeode_image_api TiledRasterImage< 2 >;
+    template class opengeode_image_api TiledRasterImage< 3 >;
+
+    template opengeode_image_api void save_tiled_raster_image(
+        const RasterImage< 2 >&, std::string_view, index_t, bool );
+    template opengeode_image_api void save_tiled_raster_image(
+        const RasterImage< 3 >&, std::string_view, index_t, bool );
+} // namespace geode
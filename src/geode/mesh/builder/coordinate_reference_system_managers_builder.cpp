@@ -77,6 +77,13 @@ namespace geode
         crs_managers_.set_point( vertex, std::move( point ), {} );
     }
 
+    template < index_t dimension >
+    void CoordinateReferenceSystemManagersBuilder<
+        dimension >::reset_points_bounding_box()
+    {
+        crs_managers_.reset_points_bounding_box( {} );
+    }
+
     template class opengeode_mesh_api
         CoordinateReferenceSystemManagersBuilder< 1 >;
     template class opengeode_mesh_api
@@ -68,6 +68,7 @@ namespace geode
         absl::Span< const index_t > /*unused*/ )
     {
         // Operation is directly handled by the AttributeManager
+        this->reset_points_bounding_box();
     }
 
     template < index_t dimension >
@@ -105,6 +105,7 @@ namespace geode
         }
         associate_edge_vertex_to_vertex( edge_vertex, vertex_id );
         do_set_edge_vertex( edge_vertex, vertex_id );
+        update_connectivity_revision();
     }
 
     void GraphBuilder::associate_edge_vertex_to_vertex(
@@ -124,6 +125,8 @@ namespace geode
         const auto added_edge = graph_.nb_edges();
         graph_.edge_attribute_manager().resize( added_edge + 1 );
         do_create_edge();
+        update_connectivity_revision();
+        update_attribute_revision();
         return added_edge;
     }
 
@@ -144,6 +147,8 @@ namespace geode
         const auto first_added_edge = graph_.nb_edges();
         graph_.edge_attribute_manager().resize( first_added_edge + nb );
         do_create_edges( nb );
+        update_connectivity_revision();
+        update_attribute_revision();
         return first_added_edge;
     }
 
@@ -179,6 +184,8 @@ namespace geode
         update_edges_around( graph_, *this, old2new );
         graph_.edge_attribute_manager().delete_elements( to_delete );
         do_delete_edges( to_delete, old2new );
+        update_connectivity_revision();
+        update_attribute_revision();
         return old2new;
     }
 
@@ -189,6 +196,8 @@ namespace geode
         update_edges_around( graph_, *this, old2new );
         graph_.edge_attribute_manager().permute_elements( permutation );
         do_permute_edges( permutation, old2new );
+        update_connectivity_revision();
+        update_attribute_revision();
         return old2new;
     }
 
@@ -248,5 +257,7 @@ namespace geode
                 }
             }
         }
+        update_connectivity_revision();
+        update_attribute_revision();
     }
 } // namespace geode
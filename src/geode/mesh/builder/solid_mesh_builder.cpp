@@ -443,6 +443,7 @@ namespace geode
                 solid_mesh_, *this, polyhedron_vertex, new_vertex_id );
         }
         update_polyhedron_vertex( polyhedron_vertex, new_vertex_id );
+        this->update_connectivity_revision();
     }
 
     template < index_t dimension >
@@ -515,6 +516,8 @@ namespace geode
                 builder.find_or_create_facet( std::move( facet_vertices ) );
             }
         }
+        this->update_connectivity_revision();
+        this->update_attribute_revision();
         return added_polyhedron;
     }
 
@@ -584,6 +587,7 @@ namespace geode
         {
             edges_builder().update_edge_vertices( old2new );
         }
+        this->reset_points_bounding_box();
         do_delete_solid_vertices( to_delete, old2new );
     }
 
@@ -617,6 +621,7 @@ namespace geode
         reset_polyhedra_around_facet_vertices(
             solid_mesh_, *this, polyhedron_facet );
         do_set_polyhedron_adjacent( polyhedron_facet, adjacent_id );
+        this->update_connectivity_revision();
     }
 
     template < index_t dimension >
@@ -629,6 +634,7 @@ namespace geode
         reset_polyhedra_around_facet_vertices(
             solid_mesh_, *this, polyhedron_facet );
         do_unset_polyhedron_adjacent( polyhedron_facet );
+        this->update_connectivity_revision();
     }
 
     template < index_t dimension >
@@ -668,6 +674,7 @@ namespace geode
                 }
             }
         }
+        this->update_connectivity_revision();
     }
 
     template < index_t dimension >
@@ -717,6 +724,8 @@ namespace geode
         update_polyhedron_adjacencies( old2new );
         solid_mesh_.polyhedron_attribute_manager().delete_elements( to_delete );
         do_delete_polyhedra( to_delete, old2new );
+        this->update_connectivity_revision();
+        this->update_attribute_revision();
         return old2new;
     }
 
@@ -731,6 +740,8 @@ namespace geode
         solid_mesh_.polyhedron_attribute_manager().permute_elements(
             permutation );
         do_permute_polyhedra( permutation, old2new );
+        this->update_connectivity_revision();
+        this->update_attribute_revision();
         return old2new;
     }
 
@@ -889,6 +900,8 @@ namespace geode
         {
             solid_mesh_.copy_facets( solid_mesh, {} );
         }
+        this->update_connectivity_revision();
+        this->update_attribute_revision();
     }
 
     template class opengeode_mesh_api SolidMeshBuilder< 3 >;
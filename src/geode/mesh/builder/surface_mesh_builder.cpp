@@ -362,6 +362,8 @@ namespace geode
             edges.find_or_create_edge( { vertices.back(), vertices.front() } );
         }
         do_create_polygon( vertices );
+        this->update_connectivity_revision();
+        this->update_attribute_revision();
         return added_polygon;
     }
 
@@ -454,6 +456,7 @@ namespace geode
                 new_vertex_id );
         }
         update_polygon_vertex( polygon_vertex, new_vertex_id );
+        this->update_connectivity_revision();
     }
 
     template < index_t dimension >
@@ -507,6 +510,7 @@ namespace geode
         {
             edges_builder().update_edge_vertices( old2new );
         }
+        this->reset_points_bounding_box();
         do_delete_surface_vertices( to_delete, old2new );
     }
 
@@ -536,6 +540,7 @@ namespace geode
         reset_polygons_around_edge_vertices(
             surface_mesh_, *this, polygon_edge );
         do_set_polygon_adjacent( polygon_edge, adjacent_id );
+        this->update_connectivity_revision();
     }
 
     template < index_t dimension >
@@ -548,6 +553,7 @@ namespace geode
         reset_polygons_around_edge_vertices(
             surface_mesh_, *this, polygon_edge );
         do_unset_polygon_adjacent( polygon_edge );
+        this->update_connectivity_revision();
     }
 
     template < index_t dimension >
@@ -644,6 +650,7 @@ namespace geode
                 }
             }
         }
+        this->update_connectivity_revision();
     }
 
     template < index_t dimension >
@@ -682,6 +689,8 @@ namespace geode
         update_polygon_adjacencies( old2new );
         surface_mesh_.polygon_attribute_manager().delete_elements( to_delete );
         do_delete_polygons( to_delete, old2new );
+        this->update_connectivity_revision();
+        this->update_attribute_revision();
         return old2new;
     }
 
@@ -695,6 +704,8 @@ namespace geode
         surface_mesh_.polygon_attribute_manager().permute_elements(
             permutation );
         do_permute_polygons( permutation, old2new );
+        this->update_connectivity_revision();
+        this->update_attribute_revision();
         return old2new;
     }
 
@@ -778,6 +789,8 @@ namespace geode
         {
             surface_mesh_.copy_edges( surface_mesh, {} );
         }
+        this->update_connectivity_revision();
+        this->update_attribute_revision();
     }
 
     template class opengeode_mesh_api SurfaceMeshBuilder< 2 >;
@@ -59,6 +59,7 @@ namespace geode
         create_vertices( vertex_set.nb_vertices() );
         vertex_set_.vertex_attribute_manager().copy(
             vertex_set.vertex_attribute_manager() );
+        update_revisions();
     }
 
     index_t VertexSetBuilder::create_vertex()
@@ -66,6 +67,7 @@ namespace geode
         const auto added_vertex = vertex_set_.nb_vertices();
         vertex_set_.vertex_attribute_manager().resize( added_vertex + 1 );
         do_create_vertex();
+        update_revisions();
         return added_vertex;
     }
 
@@ -75,6 +77,7 @@ namespace geode
         vertex_set_.vertex_attribute_manager().resize(
             first_added_vertex + nb );
         do_create_vertices( nb );
+        update_revisions();
         return first_added_vertex;
     }
 
@@ -88,6 +91,7 @@ namespace geode
         }
         vertex_set_.vertex_attribute_manager().delete_elements( to_delete );
         do_delete_vertices( to_delete, old2new );
+        update_revisions();
         return old2new;
     }
 
@@ -97,6 +101,29 @@ namespace geode
         const auto old2new = old2new_permutation( permutation );
         vertex_set_.vertex_attribute_manager().permute_elements( permutation );
         do_permute_vertices( permutation, old2new );
+        update_revisions();
         return old2new;
     }
+
+    void VertexSetBuilder::update_geometry_revision()
+    {
+        vertex_set_.update_geometry_revision( {} );
+    }
+
+    void VertexSetBuilder::update_connectivity_revision()
+    {
+        vertex_set_.update_connectivity_revision( {} );
+    }
+
+    void VertexSetBuilder::update_attribute_revision()
+    {
+        vertex_set_.update_attribute_revision( {} );
+    }
+
+    void VertexSetBuilder::update_revisions()
+    {
+        update_geometry_revision();
+        update_connectivity_revision();
+        update_attribute_revision();
+    }
 } // namespace geode
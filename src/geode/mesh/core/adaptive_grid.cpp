@@ -0,0 +1,597 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/mesh/core/adaptive_grid.hpp>
+
+#include <absl/container/fixed_array.h>
+#include <absl/container/flat_hash_map.h>
+
+#include <geode/basic/attribute_manager.hpp>
+#include <geode/basic/mapping.hpp>
+#include <geode/basic/pimpl_impl.hpp>
+
+#include <geode/geometry/coordinate_system.hpp>
+#include <geode/geometry/point.hpp>
+#include <geode/geometry/vector.hpp>
+
+#include <geode/mesh/core/light_regular_grid.hpp>
+
+namespace
+{
+    template < geode::index_t dimension >
+    geode::LightRegularGrid< dimension > copy_grid_geometry(
+        const geode::Grid< dimension >& grid )
+    {
+        const auto& coordinate_system = grid.grid_coordinate_system();
+        std::array< geode::index_t, dimension > cells_number;
+        std::array< geode::Vector< dimension >, dimension > directions;
+        for( const auto d : geode::LRange{ dimension } )
+        {
+            cells_number[d] = grid.nb_cells_in_direction( d );
+            directions[d] = coordinate_system.direction( d );
+        }
+        return { coordinate_system.origin(), cells_number, directions };
+    }
+} // namespace
+
+namespace geode
+{
+    template < index_t dimension >
+    class AdaptiveGrid< dimension >::Impl
+    {
+        struct Level
+        {
+            CellIndices nb_cells;
+            index_t shift{ 0 };
+            absl::flat_hash_map< index_t, index_t > key_to_cell;
+            std::vector< CellIndices > cells;
+            std::vector< bool > refined;
+            mutable AttributeManager attribute_manager;
+        };
+
+    public:
+        Impl( LightRegularGrid< dimension > finest_grid,
+            local_index_t nb_levels )
+            : finest_grid_( std::move( finest_grid ) ), levels_( nb_levels )
+        {
+            OPENGEODE_EXCEPTION( nb_levels > 0
+                                     && nb_levels <= sizeof( index_t ) * 8 - 1,
+                "[AdaptiveGrid] Invalid number of levels" );
+            for( const auto level : LRange{ nb_levels } )
+            {
+                auto& current = levels_[level];
+                current.shift = finest_level() - level;
+                for( const auto d : LRange{ dimension } )
+                {
+                    const auto nb_finest_cells =
+                        finest_grid_.nb_cells_in_direction( d );
+                    current.nb_cells[d] =
+                        nb_finest_cells == 0
+                            ? 0
+                            : ( ( nb_finest_cells - 1 ) >> current.shift ) + 1;
+                }
+            }
+            auto& coarsest = levels_[0];
+            index_t nb_coarsest_cells{ 1 };
+            for( const auto d : LRange{ dimension } )
+            {
+                nb_coarsest_cells *= coarsest.nb_cells[d];
+            }
+            coarsest.cells.reserve( nb_coarsest_cells );
+            for( const auto key : Range{ nb_coarsest_cells } )
+            {
+                add_cell( 0, level_indices( 0, key ) );
+            }
+            coarsest.attribute_manager.resize( nb_coarsest_cells );
+            nb_leaf_cells_ = nb_coarsest_cells;
+        }
+
+        const LightRegularGrid< dimension >& finest_grid() const
+        {
+            return finest_grid_;
+        }
+
+        local_index_t nb_levels() const
+        {
+            return static_cast< local_index_t >( levels_.size() );
+        }
+
+        local_index_t finest_level() const
+        {
+            return nb_levels() - 1;
+        }
+
+        index_t nb_cells_in_direction(
+            local_index_t level, index_t direction ) const
+        {
+            return levels_[level].nb_cells[direction];
+        }
+
+        double cell_length_in_direction(
+            local_index_t level, index_t direction ) const
+        {
+            return finest_grid_.cell_length_in_direction( direction )
+                   * static_cast< double >(
+                       index_t{ 1 } << levels_[level].shift );
+        }
+
+        index_t nb_cells( local_index_t level ) const
+        {
+            return checked_index( levels_[level].cells.size() );
+        }
+
+        index_t nb_leaf_cells() const
+        {
+            return nb_leaf_cells_;
+        }
+
+        Cell cell( local_index_t level, index_t cell_id ) const
+        {
+            OPENGEODE_ASSERT( cell_id < nb_cells( level ),
+                "[AdaptiveGrid::cell] Invalid cell index" );
+            return { level, levels_[level].cells[cell_id] };
+        }
+
+        std::optional< index_t > cell_id( const Cell& cell ) const
+        {
+            if( cell.level >= nb_levels() )
+            {
+                return std::nullopt;
+            }
+            const auto& level = levels_[cell.level];
+            for( const auto d : LRange{ dimension } )
+            {
+                if( cell.indices[d] >= level.nb_cells[d] )
+                {
+                    return std::nullopt;
+                }
+            }
+            const auto it =
+                level.key_to_cell.find( level_key( cell.level, cell.indices ) );
+            if( it == level.key_to_cell.end() )
+            {
+                return std::nullopt;
+            }
+            return it->second;
+        }
+
+        bool is_refined( local_index_t level, index_t cell_id ) const
+        {
+            return levels_[level].refined[cell_id];
+        }
+
+        Cells children( const Cell& cell ) const
+        {
+            Cells result;
+            for_each_child( cell, [&result]( const Cell& child ) {
+                result.push_back( child );
+            } );
+            return result;
+        }
+
+        Cell leaf_cell( const CellIndices& finest_cell ) const
+        {
+            for( const auto level : LRange{ nb_levels() } )
+            {
+                const auto& current = levels_[level];
+                CellIndices indices;
+                for( const auto d : LRange{ dimension } )
+                {
+                    indices[d] = finest_cell[d] >> current.shift;
+                }
+                const auto it =
+                    current.key_to_cell.find( level_key( level, indices ) );
+                OPENGEODE_ASSERT( it != current.key_to_cell.end(),
+                    "[AdaptiveGrid::leaf_cell] Missing cell" );
+                if( !current.refined[it->second] )
+                {
+                    return { level, indices };
+                }
+            }
+            OPENGEODE_ASSERT_NOT_REACHED(
+                "[AdaptiveGrid::leaf_cell] Finest cell is refined" );
+            return { finest_level(), finest_cell };
+        }
+
+        std::pair< VertexIndices, VertexIndices > finest_range(
+            const Cell& cell ) const
+        {
+            const auto shift = levels_[cell.level].shift;
+            std::pair< VertexIndices, VertexIndices > range;
+            for( const auto d : LRange{ dimension } )
+            {
+                range.first[d] = cell.indices[d] << shift;
+                range.second[d] =
+                    std::min( range.first[d] + ( index_t{ 1 } << shift ),
+                        finest_grid_.nb_cells_in_direction( d ) );
+            }
+            return range;
+        }
+
+        void refine_cells(
+            local_index_t level, absl::Span< const index_t > cell_ids )
+        {
+            OPENGEODE_EXCEPTION( level < finest_level(),
+                "[AdaptiveGrid::refine] Cannot refine cells of the finest "
+                "level" );
+            auto& current = levels_[level];
+            GenericMapping< index_t > parent_to_children;
+            for( const auto cell_id : cell_ids )
+            {
+                OPENGEODE_EXCEPTION( !current.refined[cell_id],
+                    "[AdaptiveGrid::refine] Cell is already refined" );
+                current.refined[cell_id] = true;
+                nb_leaf_cells_--;
+                for_each_child( { level, current.cells[cell_id] },
+                    [this, &parent_to_children, cell_id]( const Cell& child ) {
+                        parent_to_children.map(
+                            cell_id, add_cell( child.level, child.indices ) );
+                        nb_leaf_cells_++;
+                    } );
+            }
+            auto& next = levels_[level + 1];
+            next.attribute_manager.resize( checked_index( next.cells.size() ) );
+            next.attribute_manager.import(
+                current.attribute_manager, parent_to_children );
+        }
+
+        void refine_finest_cells( absl::Span< const CellIndices > finest_cells )
+        {
+            for( const auto level : LRange{ finest_level() } )
+            {
+                const auto& current = levels_[level];
+                std::vector< index_t > to_refine;
+                for( const auto& finest_cell : finest_cells )
+                {
+                    CellIndices indices;
+                    for( const auto d : LRange{ dimension } )
+                    {
+                        indices[d] = finest_cell[d] >> current.shift;
+                    }
+                    const auto it =
+                        current.key_to_cell.find( level_key( level, indices ) );
+                    OPENGEODE_ASSERT( it != current.key_to_cell.end(),
+                        "[AdaptiveGrid::refine_finest_cells] Missing cell" );
+                    if( !current.refined[it->second] )
+                    {
+                        to_refine.push_back( it->second );
+                    }
+                }
+                absl::c_sort( to_refine );
+                to_refine.erase(
+                    std::unique( to_refine.begin(), to_refine.end() ),
+                    to_refine.end() );
+                if( !to_refine.empty() )
+                {
+                    refine_cells( level, to_refine );
+                }
+            }
+        }
+
+        AttributeManager& cell_attribute_manager( local_index_t level ) const
+        {
+            return levels_[level].attribute_manager;
+        }
+
+    private:
+        index_t level_key(
+            local_index_t level, const CellIndices& indices ) const
+        {
+            const auto& current = levels_[level];
+            index_t key{ 0 };
+            index_t offset{ 1 };
+            for( const auto d : LRange{ dimension } )
+            {
+                key += indices[d] * offset;
+                offset *= current.nb_cells[d];
+            }
+            return key;
+        }
+
+        CellIndices level_indices( local_index_t level, index_t key ) const
+        {
+            const auto& current = levels_[level];
+            CellIndices indices;
+            for( const auto d : LRange{ dimension } )
+            {
+                indices[d] = key % current.nb_cells[d];
+                key /= current.nb_cells[d];
+            }
+            return indices;
+        }
+
+        index_t add_cell( local_index_t level, const CellIndices& indices )
+        {
+            auto& current = levels_[level];
+            const auto cell_id = checked_index( current.cells.size() );
+            current.key_to_cell.emplace( level_key( level, indices ), cell_id );
+            current.cells.push_back( indices );
+            current.refined.push_back( false );
+            return cell_id;
+        }
+
+        template < typename Action >
+        void for_each_child( const Cell& cell, Action&& action ) const
+        {
+            if( cell.level >= finest_level() )
+            {
+                return;
+            }
+            const auto child_level =
+                static_cast< local_index_t >( cell.level + 1 );
+            const auto& next = levels_[child_level];
+            for( const auto child : Range{ 1u << dimension } )
+            {
+                Cell result{ child_level, {} };
+                bool inside{ true };
+                for( const auto d : LRange{ dimension } )
+                {
+                    result.indices[d] =
+                        2 * cell.indices[d] + ( ( child >> d ) & 1 );
+                    inside = inside && result.indices[d] < next.nb_cells[d];
+                }
+                if( inside )
+                {
+                    action( result );
+                }
+            }
+        }
+
+    private:
+        LightRegularGrid< dimension > finest_grid_;
+        absl::FixedArray< Level > levels_;
+        index_t nb_leaf_cells_{ 0 };
+    };
+
+    template < index_t dimension >
+    AdaptiveGrid< dimension >::AdaptiveGrid( Point< dimension > origin,
+        std::array< index_t, dimension > finest_cells_number,
+        std::array< double, dimension > finest_cells_length,
+        local_index_t nb_levels )
+        : impl_{ LightRegularGrid< dimension >{ std::move( origin ),
+                     std::move( finest_cells_number ),
+                     std::move( finest_cells_length ) },
+              nb_levels }
+    {
+    }
+
+    template < index_t dimension >
+    AdaptiveGrid< dimension >::AdaptiveGrid(
+        const Grid< dimension >& finest_grid, local_index_t nb_levels )
+        : impl_{ copy_grid_geometry( finest_grid ), nb_levels }
+    {
+    }
+
+    template < index_t dimension >
+    AdaptiveGrid< dimension >::AdaptiveGrid( AdaptiveGrid&& ) noexcept =
+        default;
+
+    template < index_t dimension >
+    auto AdaptiveGrid< dimension >::operator=( AdaptiveGrid&& ) noexcept
+        -> AdaptiveGrid& = default;
+
+    template < index_t dimension >
+    AdaptiveGrid< dimension >::~AdaptiveGrid() = default;
+
+    template < index_t dimension >
+    const LightRegularGrid< dimension >&
+        AdaptiveGrid< dimension >::finest_grid() const
+    {
+        return impl_->finest_grid();
+    }
+
+    template < index_t dimension >
+    local_index_t AdaptiveGrid< dimension >::nb_levels() const
+    {
+        return impl_->nb_levels();
+    }
+
+    template < index_t dimension >
+    local_index_t AdaptiveGrid< dimension >::finest_level() const
+    {
+        return impl_->finest_level();
+    }
+
+    template < index_t dimension >
+    index_t AdaptiveGrid< dimension >::nb_cells_in_direction(
+        local_index_t level, index_t direction ) const
+    {
+        return impl_->nb_cells_in_direction( level, direction );
+    }
+
+    template < index_t dimension >
+    double AdaptiveGrid< dimension >::cell_length_in_direction(
+        local_index_t level, index_t direction ) const
+    {
+        return impl_->cell_length_in_direction( level, direction );
+    }
+
+    template < index_t dimension >
+    index_t AdaptiveGrid< dimension >::nb_cells( local_index_t level ) const
+    {
+        return impl_->nb_cells( level );
+    }
+
+    template < index_t dimension >
+    index_t AdaptiveGrid< dimension >::nb_leaf_cells() const
+    {
+        return impl_->nb_leaf_cells();
+    }
+
+    template < index_t dimension >
+    auto AdaptiveGrid< dimension >::cell(
+        local_index_t level, index_t cell_id ) const -> Cell
+    {
+        return impl_->cell( level, cell_id );
+    }
+
+    template < index_t dimension >
+    std::optional< index_t > AdaptiveGrid< dimension >::cell_id(
+        const Cell& cell ) const
+    {
+        return impl_->cell_id( cell );
+    }
+
+    template < index_t dimension >
+    bool AdaptiveGrid< dimension >::is_leaf( const Cell& cell ) const
+    {
+        const auto id = cell_id( cell );
+        return id && !impl_->is_refined( cell.level, id.value() );
+    }
+
+    template < index_t dimension >
+    auto AdaptiveGrid< dimension >::parent( const Cell& cell ) const
+        -> std::optional< Cell >
+    {
+        if( cell.level == 0 )
+        {
+            return std::nullopt;
+        }
+        Cell result{ static_cast< local_index_t >( cell.level - 1 ), {} };
+        for( const auto d : LRange{ dimension } )
+        {
+            result.indices[d] = cell.indices[d] / 2;
+        }
+        return result;
+    }
+
+    template < index_t dimension >
+    auto AdaptiveGrid< dimension >::children( const Cell& cell ) const
+        -> Cells
+    {
+        const auto id = cell_id( cell );
+        if( !id || !impl_->is_refined( cell.level, id.value() ) )
+        {
+            return {};
+        }
+        return impl_->children( cell );
+    }
+
+    template < index_t dimension >
+    auto AdaptiveGrid< dimension >::leaf_cell(
+        const CellIndices& finest_cell ) const -> Cell
+    {
+        return impl_->leaf_cell( finest_cell );
+    }
+
+    template < index_t dimension >
+    auto AdaptiveGrid< dimension >::central_finest_cell(
+        const Cell& cell ) const -> CellIndices
+    {
+        const auto [begin, end] = impl_->finest_range( cell );
+        CellIndices result;
+        for( const auto d : LRange{ dimension } )
+        {
+            result[d] = begin[d] + ( end[d] - begin[d] ) / 2;
+        }
+        return result;
+    }
+
+    template < index_t dimension >
+    void AdaptiveGrid< dimension >::refine( const Cell& cell )
+    {
+        const auto id = cell_id( cell );
+        OPENGEODE_EXCEPTION(
+            id, "[AdaptiveGrid::refine] Cell is not allocated" );
+        const std::array< index_t, 1 > cell_ids{ id.value() };
+        impl_->refine_cells( cell.level, cell_ids );
+    }
+
+    template < index_t dimension >
+    void AdaptiveGrid< dimension >::refine_finest_cells(
+        absl::Span< const CellIndices > finest_cells )
+    {
+        impl_->refine_finest_cells( finest_cells );
+    }
+
+    template < index_t dimension >
+    bool AdaptiveGrid< dimension >::contains(
+        const Point< dimension >& query ) const
+    {
+        return finest_grid().contains( query );
+    }
+
+    template < index_t dimension >
+    auto AdaptiveGrid< dimension >::cells(
+        const Point< dimension >& query ) const -> Cells
+    {
+        Cells result;
+        for( const auto& finest_cell : finest_grid().cells( query ) )
+        {
+            auto leaf = leaf_cell( finest_cell );
+            if( absl::c_find( result, leaf ) == result.end() )
+            {
+                result.push_back( std::move( leaf ) );
+            }
+        }
+        return result;
+    }
+
+    template < index_t dimension >
+    Point< dimension > AdaptiveGrid< dimension >::cell_barycenter(
+        const Cell& cell ) const
+    {
+        const auto [begin, end] = impl_->finest_range( cell );
+        return ( finest_grid().grid_point( begin )
+                   + finest_grid().grid_point( end ) )
+               / 2.;
+    }
+
+    template < index_t dimension >
+    auto AdaptiveGrid< dimension >::closest_vertex(
+        const Point< dimension >& query ) const -> VertexIndices
+    {
+        const auto query_in_grid =
+            finest_grid().grid_coordinate_system().coordinates( query );
+        CellIndices finest_cell;
+        for( const auto d : LRange{ dimension } )
+        {
+            const auto value = query_in_grid.value( d );
+            const auto last_cell = static_cast< double >(
+                finest_grid().nb_cells_in_direction( d ) - 1 );
+            finest_cell[d] =
+                value <= 0.
+                    ? 0
+                    : static_cast< index_t >( std::min( value, last_cell ) );
+        }
+        const auto [begin, end] =
+            impl_->finest_range( leaf_cell( finest_cell ) );
+        VertexIndices result;
+        for( const auto d : LRange{ dimension } )
+        {
+            const auto value = query_in_grid.value( d );
+            result[d] = value - begin[d] <= end[d] - value ? begin[d] : end[d];
+        }
+        return result;
+    }
+
+    template < index_t dimension >
+    AttributeManager& AdaptiveGrid< dimension >::cell_attribute_manager(
+        local_index_t level ) const
+    {
+        return impl_->cell_attribute_manager( level );
+    }
+
+    template class opengeode_mesh_api AdaptiveGrid< 2 >;
+    template class opengeode_mesh_api AdaptiveGrid< 3 >;
+} // namespace geode
@@ -102,6 +102,27 @@ namespace geode
         impl_->set_point( point_id, std::move( point ) );
     }
 
+    template < index_t dimension >
+    absl::Span< const Point< dimension > >
+        AttributeCoordinateReferenceSystem< dimension >::points_storage() const
+    {
+        return impl_->points_storage();
+    }
+
+    template < index_t dimension >
+    index_t AttributeCoordinateReferenceSystem<
+        dimension >::first_modified_point() const
+    {
+        return impl_->first_modified_point();
+    }
+
+    template < index_t dimension >
+    index_t AttributeCoordinateReferenceSystem<
+        dimension >::take_first_modified_point() const
+    {
+        return impl_->take_first_modified_point();
+    }
+
     template < index_t dimension >
     std::string_view
         AttributeCoordinateReferenceSystem< dimension >::attribute_name() const
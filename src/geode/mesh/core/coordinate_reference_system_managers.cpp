@@ -23,13 +23,21 @@
 
 #include <geode/mesh/core/coordinate_reference_system_managers.hpp>
 
+#include <mutex>
+
+#include <async++.h>
+
+#include <absl/container/fixed_array.h>
+
 #include <geode/basic/pimpl_impl.hpp>
 
+#include <geode/geometry/bounding_box.hpp>
 #include <geode/geometry/point.hpp>
 
 #include <geode/mesh/builder/coordinate_reference_system_manager_builder.hpp>
 #include <geode/mesh/core/coordinate_reference_system.hpp>
 #include <geode/mesh/core/coordinate_reference_system_manager.hpp>
+#include <geode/mesh/core/internal/revision_counter.hpp>
 
 namespace geode
 {
@@ -37,6 +45,7 @@ namespace geode
     class CoordinateReferenceSystemManagers< dimension >::Impl
     {
         friend class bitsery::Access;
+        static constexpr index_t BOUNDING_BOX_CHUNK_SIZE{ 16384 };
 
     public:
         const CoordinateReferenceSystemManager1D&
@@ -88,6 +97,43 @@ namespace geode
         CoordinateReferenceSystemManager< dimension >&
             main_coordinate_reference_system_manager();
 
+        BoundingBox< dimension > points_bounding_box( index_t nb_points ) const
+        {
+            std::lock_guard< std::mutex > lock{ bounding_box_mutex_ };
+            update_modified_points();
+            if( first_modified_point_ < nb_boxed_points_
+                || nb_points < nb_boxed_points_ )
+            {
+                bounding_box_ = BoundingBox< dimension >{};
+                nb_boxed_points_ = 0;
+            }
+            if( nb_points > nb_boxed_points_ )
+            {
+                add_points_to_bounding_box( nb_boxed_points_, nb_points );
+            }
+            nb_boxed_points_ = nb_points;
+            first_modified_point_ = NO_ID;
+            return bounding_box_;
+        }
+
+        void reset_points_bounding_box()
+        {
+            points_revision_.modified();
+            std::lock_guard< std::mutex > lock{ bounding_box_mutex_ };
+            bounding_box_ = BoundingBox< dimension >{};
+            nb_boxed_points_ = 0;
+        }
+
+        std::uint64_t points_revision() const
+        {
+            if( active_first_modified_point() != NO_ID )
+            {
+                std::lock_guard< std::mutex > lock{ bounding_box_mutex_ };
+                update_modified_points();
+            }
+            return points_revision_.revision();
+        }
+
         void set_point( index_t vertex, Point< dimension > point )
         {
             CoordinateReferenceSystemManagerBuilder< dimension >{
@@ -98,6 +144,74 @@ namespace geode
         }
 
     private:
+        index_t active_first_modified_point() const
+        {
+            const auto& manager = main_coordinate_reference_system_manager();
+            if( manager.active_coordinate_reference_system_name().empty() )
+            {
+                return NO_ID;
+            }
+            return manager.active_coordinate_reference_system()
+                .first_modified_point();
+        }
+
+        /*!
+         * Collect the points modified in the active CRS since the previous
+         * call, whether through set_point or directly in the CRS storage.
+         * The cached box is only outdated if one of its points moved: new
+         * points are added to it on the next query.
+         * Must be called with bounding_box_mutex_ locked.
+         */
+        void update_modified_points() const
+        {
+            const auto& manager = main_coordinate_reference_system_manager();
+            if( manager.active_coordinate_reference_system_name().empty() )
+            {
+                return;
+            }
+            const auto first_modified =
+                manager.active_coordinate_reference_system()
+                    .take_first_modified_point();
+            if( first_modified == NO_ID )
+            {
+                return;
+            }
+            points_revision_.modified();
+            first_modified_point_ =
+                std::min( first_modified_point_, first_modified );
+        }
+
+        void add_points_to_bounding_box( index_t begin, index_t end ) const
+        {
+            const auto nb_chunks =
+                ( end - begin + BOUNDING_BOX_CHUNK_SIZE - 1 )
+                / BOUNDING_BOX_CHUNK_SIZE;
+            if( nb_chunks < 2 )
+            {
+                for( const auto p : Range{ begin, end } )
+                {
+                    bounding_box_.add_point( point( p ) );
+                }
+                return;
+            }
+            absl::FixedArray< BoundingBox< dimension > > boxes( nb_chunks );
+            async::parallel_for( async::irange( index_t{ 0 }, nb_chunks ),
+                [this, begin, end, &boxes]( index_t chunk ) {
+                    const auto chunk_begin =
+                        begin + chunk * BOUNDING_BOX_CHUNK_SIZE;
+                    const auto chunk_end =
+                        std::min( chunk_begin + BOUNDING_BOX_CHUNK_SIZE, end );
+                    for( const auto p : Range{ chunk_begin, chunk_end } )
+                    {
+                        boxes[chunk].add_point( point( p ) );
+                    }
+                } );
+            for( const auto& box : boxes )
+            {
+                bounding_box_.add_box( box );
+            }
+        }
+
         template < typename Archive >
         void serialize( Archive& archive )
         {
@@ -113,6 +227,11 @@ namespace geode
         CoordinateReferenceSystemManager1D crs_manager1D_;
         CoordinateReferenceSystemManager2D crs_manager2D_;
         CoordinateReferenceSystemManager3D crs_manager3D_;
+        mutable std::mutex bounding_box_mutex_;
+        mutable BoundingBox< dimension > bounding_box_;
+        mutable index_t nb_boxed_points_{ 0 };
+        mutable index_t first_modified_point_{ NO_ID };
+        mutable internal::RevisionCounter points_revision_;
     };
 
     template <>
@@ -215,10 +334,26 @@ namespace geode
         return impl_->point( vertex );
     }
 
+    template < index_t dimension >
+    BoundingBox< dimension >
+        CoordinateReferenceSystemManagers< dimension >::points_bounding_box(
+            index_t nb_points ) const
+    {
+        return impl_->points_bounding_box( nb_points );
+    }
+
+    template < index_t dimension >
+    std::uint64_t
+        CoordinateReferenceSystemManagers< dimension >::points_revision() const
+    {
+        return impl_->points_revision();
+    }
+
     template < index_t dimension >
     CoordinateReferenceSystemManager1D& CoordinateReferenceSystemManagers<
         dimension >::coordinate_reference_system_manager1D( CRSManagersKey )
     {
+        impl_->reset_points_bounding_box();
         return impl_->coordinate_reference_system_manager1D();
     }
 
@@ -226,6 +361,7 @@ namespace geode
     CoordinateReferenceSystemManager2D& CoordinateReferenceSystemManagers<
         dimension >::coordinate_reference_system_manager2D( CRSManagersKey )
     {
+        impl_->reset_points_bounding_box();
         return impl_->coordinate_reference_system_manager2D();
     }
 
@@ -233,6 +369,7 @@ namespace geode
     CoordinateReferenceSystemManager3D& CoordinateReferenceSystemManagers<
         dimension >::coordinate_reference_system_manager3D( CRSManagersKey )
     {
+        impl_->reset_points_bounding_box();
         return impl_->coordinate_reference_system_manager3D();
     }
 
@@ -241,6 +378,7 @@ namespace geode
         CoordinateReferenceSystemManagers< dimension >::
             main_coordinate_reference_system_manager( CRSManagersKey )
     {
+        impl_->reset_points_bounding_box();
         return impl_->main_coordinate_reference_system_manager();
     }
 
@@ -251,6 +389,13 @@ namespace geode
         impl_->set_point( vertex, std::move( point ) );
     }
 
+    template < index_t dimension >
+    void CoordinateReferenceSystemManagers<
+        dimension >::reset_points_bounding_box( CRSManagersKey )
+    {
+        impl_->reset_points_bounding_box();
+    }
+
     template < index_t dimension >
     template < typename Archive >
     void CoordinateReferenceSystemManagers< dimension >::serialize(
@@ -23,6 +23,8 @@
 
 #include <geode/mesh/core/edged_curve.hpp>
 
+#include <algorithm>
+
 #include <geode/basic/bitsery_archive.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 
@@ -158,12 +160,15 @@ namespace geode
     template < index_t dimension >
     BoundingBox< dimension > EdgedCurve< dimension >::bounding_box() const
     {
-        BoundingBox< dimension > box;
-        for( const auto p : Range{ nb_vertices() } )
-        {
-            box.add_point( this->point( p ) );
-        }
-        return box;
+        return this->points_bounding_box( nb_vertices() );
+    }
+
+    template < index_t dimension >
+    MeshRevisions EdgedCurve< dimension >::revisions() const
+    {
+        auto result = Graph::revisions();
+        result.geometry = std::max( result.geometry, this->points_revision() );
+        return result;
     }
 
     template < index_t dimension >
@@ -419,13 +419,17 @@ namespace geode
         {
             archive.ext( *this,
                 Growable< Archive, Impl >{ { []( Archive& a, Impl& impl ) {
-                    a.container4b( impl.polyhedron_vertices_,
+                    a.template container< INDEX_BYTES >(
+                        impl.polyhedron_vertices_,
                         impl.polyhedron_vertices_.max_size() );
-                    a.container4b( impl.polyhedron_vertex_ptr_,
+                    a.template container< INDEX_BYTES >(
+                        impl.polyhedron_vertex_ptr_,
                         impl.polyhedron_vertex_ptr_.max_size() );
-                    a.container4b( impl.polyhedron_adjacents_,
+                    a.template container< INDEX_BYTES >(
+                        impl.polyhedron_adjacents_,
                         impl.polyhedron_adjacents_.max_size() );
-                    a.container4b( impl.polyhedron_adjacent_ptr_,
+                    a.template container< INDEX_BYTES >(
+                        impl.polyhedron_adjacent_ptr_,
                         impl.polyhedron_adjacent_ptr_.max_size() );
                     a.ext( impl, bitsery::ext::BaseClass<
                                      internal::PointsImpl< dimension > >{} );
@@ -186,11 +186,12 @@ namespace geode
         {
             archive.ext( *this,
                 Growable< Archive, Impl >{ { []( Archive& a, Impl& impl ) {
-                    a.container4b( impl.polygon_vertices_,
+                    a.template container< INDEX_BYTES >( impl.polygon_vertices_,
                         impl.polygon_vertices_.max_size() );
-                    a.container4b( impl.polygon_adjacents_,
+                    a.template container< INDEX_BYTES >(
+                        impl.polygon_adjacents_,
                         impl.polygon_adjacents_.max_size() );
-                    a.container4b(
+                    a.template container< INDEX_BYTES >(
                         impl.polygon_ptr_, impl.polygon_ptr_.max_size() );
                     a.ext( impl, bitsery::ext::BaseClass<
                                      internal::PointsImpl< dimension > >{} );
@@ -327,40 +327,50 @@ namespace geode
             archive.ext( *this,
                 Growable< Archive, Impl >{
                     { []( Archive& a, Impl& impl ) {
-                         a.container4b( impl.polyhedron_vertices_,
+                         a.template container< INDEX_BYTES >(
+                             impl.polyhedron_vertices_,
                              impl.polyhedron_vertices_.max_size() );
-                         a.container4b( impl.polyhedron_vertex_ptr_,
+                         a.template container< INDEX_BYTES >(
+                             impl.polyhedron_vertex_ptr_,
                              impl.polyhedron_vertex_ptr_.max_size() );
                          std::vector< index_t > facets;
-                         a.container4b(
+                         a.template container< INDEX_BYTES >(
                              facets, impl.polyhedron_facets_.max_size() );
                          impl.polyhedron_facets_.reserve( facets.size() );
                          for( const auto v : facets )
                          {
                              impl.polyhedron_facets_.emplace_back( v );
                          }
-                         a.container4b( impl.polyhedron_facet_ptr_,
+                         a.template container< INDEX_BYTES >(
+                             impl.polyhedron_facet_ptr_,
                              impl.polyhedron_facet_ptr_.max_size() );
-                         a.container4b( impl.polyhedron_adjacents_,
+                         a.template container< INDEX_BYTES >(
+                             impl.polyhedron_adjacents_,
                              impl.polyhedron_adjacents_.max_size() );
-                         a.container4b( impl.polyhedron_adjacent_ptr_,
+                         a.template container< INDEX_BYTES >(
+                             impl.polyhedron_adjacent_ptr_,
                              impl.polyhedron_adjacent_ptr_.max_size() );
                          a.ext(
                              impl, bitsery::ext::BaseClass<
                                        internal::PointsImpl< dimension > >{} );
                      },
                         []( Archive& a, Impl& impl ) {
-                            a.container4b( impl.polyhedron_vertices_,
+                            a.template container< INDEX_BYTES >(
+                                impl.polyhedron_vertices_,
                                 impl.polyhedron_vertices_.max_size() );
-                            a.container4b( impl.polyhedron_vertex_ptr_,
+                            a.template container< INDEX_BYTES >(
+                                impl.polyhedron_vertex_ptr_,
                                 impl.polyhedron_vertex_ptr_.max_size() );
                             a.container1b( impl.polyhedron_facets_,
                                 impl.polyhedron_facets_.max_size() );
-                            a.container4b( impl.polyhedron_facet_ptr_,
+                            a.template container< INDEX_BYTES >(
+                                impl.polyhedron_facet_ptr_,
                                 impl.polyhedron_facet_ptr_.max_size() );
-                            a.container4b( impl.polyhedron_adjacents_,
+                            a.template container< INDEX_BYTES >(
+                                impl.polyhedron_adjacents_,
                                 impl.polyhedron_adjacents_.max_size() );
-                            a.container4b( impl.polyhedron_adjacent_ptr_,
+                            a.template container< INDEX_BYTES >(
+                                impl.polyhedron_adjacent_ptr_,
                                 impl.polyhedron_adjacent_ptr_.max_size() );
                             a.ext( impl,
                                 bitsery::ext::BaseClass<
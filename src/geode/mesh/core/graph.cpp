@@ -144,13 +144,15 @@ namespace geode
     {
         archive.ext( *this, Growable< Archive, EdgeVertex >{
                                 { []( Archive& a, EdgeVertex& edge_vertex ) {
-                                     a.value4b( edge_vertex.edge_id );
+                                     a.template value< INDEX_BYTES >(
+                                         edge_vertex.edge_id );
                                      index_t value{ NO_ID };
-                                     a.value4b( value );
+                                     a.template value< INDEX_BYTES >( value );
                                      edge_vertex.vertex_id = value;
                                  },
                                     []( Archive& a, EdgeVertex& edge_vertex ) {
-                                        a.value4b( edge_vertex.edge_id );
+                                        a.template value< INDEX_BYTES >(
+                                            edge_vertex.edge_id );
                                         a.value1b( edge_vertex.vertex_id );
                                     } } } );
     }
@@ -384,7 +384,8 @@ namespace geode
             OPENGEODE_EXCEPTION( nb_vertices_double < static_cast< double >(
                                      std::numeric_limits< index_t >::max() ),
                 "[Grid] Creation of a grid for which the number of cell "
-                "vertices exceeds the unsigned int limit." );
+                "vertices exceeds the index_t limit. Consider building with "
+                "OPENGEODE_WITH_64BIT_INDEX." );
             for( const auto d : LRange{ dimension } )
             {
                 const auto& direction = grid_coordinate_system_.direction( d );
@@ -428,7 +429,8 @@ namespace geode
             archive.ext(
                 *this, Growable< Archive, Impl >{
                            { []( Archive& a, Impl& impl ) {
-                                a.container4b( impl.deprecated_cells_number_ );
+                                a.template container< INDEX_BYTES >(
+                                    impl.deprecated_cells_number_ );
                                 a.container8b( impl.cells_length_ );
                                 impl.set_base_origin();
                                 impl.set_base_grid_directions();
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/mesh/core/mesh_revisions.hpp>
+
+#include <algorithm>
+#include <atomic>
+
+namespace
+{
+    std::atomic< std::uint64_t > last_revision{ 0 };
+} // namespace
+
+namespace geode
+{
+    std::uint64_t MeshRevisions::new_revision()
+    {
+        return ++last_revision;
+    }
+
+    void MeshRevisions::add( const MeshRevisions& other )
+    {
+        geometry = std::max( geometry, other.geometry );
+        connectivity = std::max( connectivity, other.connectivity );
+        attribute = std::max( attribute, other.attribute );
+        nb_meshes += other.nb_meshes;
+    }
+
+    bool MeshRevisions::operator==( const MeshRevisions& other ) const
+    {
+        return geometry == other.geometry && connectivity == other.connectivity
+               && attribute == other.attribute
+               && nb_meshes == other.nb_meshes;
+    }
+
+    bool MeshRevisions::operator!=( const MeshRevisions& other ) const
+    {
+        return !( *this == other );
+    }
+} // namespace geode
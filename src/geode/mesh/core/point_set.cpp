@@ -21,10 +21,12 @@
  *
  */
 
-#include <bitsery/ext/inheritance.h>
-
 #include <geode/mesh/core/point_set.hpp>
 
+#include <algorithm>
+
+#include <bitsery/ext/inheritance.h>
+
 #include <geode/basic/bitsery_archive.hpp>
 
 #include <geode/geometry/bounding_box.hpp>
@@ -86,12 +88,15 @@ namespace geode
     template < index_t dimension >
     BoundingBox< dimension > PointSet< dimension >::bounding_box() const
     {
-        BoundingBox< dimension > box;
-        for( const auto p : Range{ nb_vertices() } )
-        {
-            box.add_point( this->point( p ) );
-        }
-        return box;
+        return this->points_bounding_box( nb_vertices() );
+    }
+
+    template < index_t dimension >
+    MeshRevisions PointSet< dimension >::revisions() const
+    {
+        auto result = VertexSet::revisions();
+        result.geometry = std::max( result.geometry, this->points_revision() );
+        return result;
     }
 
     template class opengeode_mesh_api PointSet< 1 >;
@@ -67,13 +67,10 @@ namespace geode
         Impl() = default;
         Impl( const SolidMesh< dimension >& solid )
         {
-            for( const auto p : Range{ solid.nb_polyhedra() } )
-            {
-                for( auto&& e : solid.polyhedron_edges_vertices( p ) )
-                {
-                    this->find_or_create_edge( std::move( e ) );
-                }
-            }
+            this->add_facets(
+                solid.nb_polyhedra(), [&solid]( index_t polyhedron ) {
+                    return solid.polyhedron_edges_vertices( polyhedron );
+                } );
         }
 
     private:
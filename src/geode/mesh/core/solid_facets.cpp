@@ -71,13 +71,10 @@ namespace geode
         Impl() = default;
         Impl( const SolidMesh< dimension >& solid )
         {
-            for( const auto p : Range{ solid.nb_polyhedra() } )
-            {
-                for( auto&& f : solid.polyhedron_facets_vertices( p ) )
-                {
-                    this->find_or_create_facet( std::move( f ) );
-                }
-            }
+            this->add_facets(
+                solid.nb_polyhedra(), [&solid]( index_t polyhedron ) {
+                    return solid.polyhedron_facets_vertices( polyhedron );
+                } );
         }
 
         std::optional< index_t > find_facet(
@@ -336,13 +336,15 @@ namespace geode
         archive.ext( *this,
             Growable< Archive, PolyhedronVertex >{
                 { []( Archive& a, PolyhedronVertex& polyhedron_vertex ) {
-                     a.value4b( polyhedron_vertex.polyhedron_id );
+                     a.template value< INDEX_BYTES >(
+                         polyhedron_vertex.polyhedron_id );
                      index_t value{ NO_ID };
-                     a.value4b( value );
+                     a.template value< INDEX_BYTES >( value );
                      polyhedron_vertex.vertex_id = value;
                  },
                     []( Archive& a, PolyhedronVertex& polyhedron_vertex ) {
-                        a.value4b( polyhedron_vertex.polyhedron_id );
+                        a.template value< INDEX_BYTES >(
+                            polyhedron_vertex.polyhedron_id );
                         a.value1b( polyhedron_vertex.vertex_id );
                     } } } );
     }
@@ -353,13 +355,15 @@ namespace geode
         archive.ext(
             *this, Growable< Archive, PolyhedronFacet >{
                        { []( Archive& a, PolyhedronFacet& polyhedron_facet ) {
-                            a.value4b( polyhedron_facet.polyhedron_id );
+                            a.template value< INDEX_BYTES >(
+                                polyhedron_facet.polyhedron_id );
                             index_t value{ NO_ID };
-                            a.value4b( value );
+                            a.template value< INDEX_BYTES >( value );
                             polyhedron_facet.facet_id = value;
                         },
                            []( Archive& a, PolyhedronFacet& polyhedron_facet ) {
-                               a.value4b( polyhedron_facet.polyhedron_id );
+                               a.template value< INDEX_BYTES >(
+                                   polyhedron_facet.polyhedron_id );
                                a.value1b( polyhedron_facet.facet_id );
                            } } } );
     }
@@ -373,7 +377,7 @@ namespace geode
                       PolyhedronFacetVertex& polyhedron_facet_vertex ) {
                      a.object( polyhedron_facet_vertex.polyhedron_facet );
                      index_t value{ NO_ID };
-                     a.value4b( value );
+                     a.template value< INDEX_BYTES >( value );
                      polyhedron_facet_vertex.vertex_id = value;
                  },
                     []( Archive& a,
@@ -391,7 +395,7 @@ namespace geode
                 { []( Archive& a, PolyhedronFacetEdge& polyhedron_facet_edge ) {
                      a.object( polyhedron_facet_edge.polyhedron_facet );
                      index_t value{ NO_ID };
-                     a.value4b( value );
+                     a.template value< INDEX_BYTES >( value );
                      polyhedron_facet_edge.edge_id = value;
                  },
                     []( Archive& a,
@@ -1686,12 +1690,15 @@ namespace geode
     template < index_t dimension >
     BoundingBox< dimension > SolidMesh< dimension >::bounding_box() const
     {
-        BoundingBox< dimension > box;
-        for( const auto p : Range{ nb_vertices() } )
-        {
-            box.add_point( this->point( p ) );
-        }
-        return box;
+        return this->points_bounding_box( nb_vertices() );
+    }
+
+    template < index_t dimension >
+    MeshRevisions SolidMesh< dimension >::revisions() const
+    {
+        auto result = VertexSet::revisions();
+        result.geometry = std::max( result.geometry, this->points_revision() );
+        return result;
     }
 
     template < index_t dimension >
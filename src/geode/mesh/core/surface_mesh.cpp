@@ -210,13 +210,15 @@ namespace geode
         archive.ext(
             *this, Growable< Archive, PolygonVertex >{
                        { []( Archive& a, PolygonVertex& polygon_vertex ) {
-                            a.value4b( polygon_vertex.polygon_id );
+                            a.template value< INDEX_BYTES >(
+                                polygon_vertex.polygon_id );
                             index_t value{ NO_ID };
-                            a.value4b( value );
+                            a.template value< INDEX_BYTES >( value );
                             polygon_vertex.vertex_id = value;
                         },
                            []( Archive& a, PolygonVertex& polygon_vertex ) {
-                               a.value4b( polygon_vertex.polygon_id );
+                               a.template value< INDEX_BYTES >(
+                                   polygon_vertex.polygon_id );
                                a.value1b( polygon_vertex.vertex_id );
                            } } } );
     }
@@ -227,13 +229,15 @@ namespace geode
         archive.ext(
             *this, Growable< Archive, PolygonEdge >{
                        { []( Archive& a, PolygonEdge& polygon_edge ) {
-                            a.value4b( polygon_edge.polygon_id );
+                            a.template value< INDEX_BYTES >(
+                                polygon_edge.polygon_id );
                             index_t value{ NO_ID };
-                            a.value4b( value );
+                            a.template value< INDEX_BYTES >( value );
                             polygon_edge.edge_id = value;
                         },
                            []( Archive& a, PolygonEdge& polygon_edge ) {
-                               a.value4b( polygon_edge.polygon_id );
+                               a.template value< INDEX_BYTES >(
+                                   polygon_edge.polygon_id );
                                a.value1b( polygon_edge.edge_id );
                            } } } );
     }
@@ -1048,12 +1052,15 @@ namespace geode
     template < index_t dimension >
     BoundingBox< dimension > SurfaceMesh< dimension >::bounding_box() const
     {
-        BoundingBox< dimension > box;
-        for( const auto p : Range{ nb_vertices() } )
-        {
-            box.add_point( this->point( p ) );
-        }
-        return box;
+        return this->points_bounding_box( nb_vertices() );
+    }
+
+    template < index_t dimension >
+    MeshRevisions SurfaceMesh< dimension >::revisions() const
+    {
+        auto result = VertexSet::revisions();
+        result.geometry = std::max( result.geometry, this->points_revision() );
+        return result;
     }
 
     template < index_t dimension >
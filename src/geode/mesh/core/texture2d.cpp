@@ -91,6 +91,21 @@ namespace geode
         impl_->set_image( std::move( image ) );
     }
 
+    void Texture< 2 >::set_tiled_image( std::string_view filename )
+    {
+        impl_->set_tiled_image( filename );
+    }
+
+    bool Texture< 2 >::is_image_tiled() const
+    {
+        return impl_->is_image_tiled();
+    }
+
+    const TiledRasterImage2D& Texture< 2 >::tiled_image() const
+    {
+        return impl_->tiled_image();
+    }
+
     const Point2D& Texture< 2 >::texture_coordinates(
         const PolygonVertex& vertex ) const
     {
@@ -113,4 +128,4 @@ namespace geode
     }
 
     SERIALIZE_BITSERY_ARCHIVE( opengeode_mesh_api, Texture< 2 > );
-} // namespace geode
\ No newline at end of file
+} // namespace geode
\ No newline at end of file
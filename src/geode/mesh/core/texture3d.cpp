@@ -92,6 +92,21 @@ namespace geode
         impl_->set_image( std::move( image ) );
     }
 
+    void Texture< 3 >::set_tiled_image( std::string_view filename )
+    {
+        impl_->set_tiled_image( filename );
+    }
+
+    bool Texture< 3 >::is_image_tiled() const
+    {
+        return impl_->is_image_tiled();
+    }
+
+    const TiledRasterImage3D& Texture< 3 >::tiled_image() const
+    {
+        return impl_->tiled_image();
+    }
+
     const Point3D& Texture< 3 >::texture_coordinates(
         const PolyhedronVertex& vertex ) const
     {
@@ -114,4 +129,4 @@ namespace geode
     }
 
     SERIALIZE_BITSERY_ARCHIVE( opengeode_mesh_api, Texture< 3 > );
-} // namespace geode
\ No newline at end of file
+} // namespace geode
\ No newline at end of file
@@ -28,6 +28,7 @@
 #include <geode/basic/pimpl_impl.hpp>
 
 #include <geode/mesh/builder/vertex_set_builder.hpp>
+#include <geode/mesh/core/internal/revision_counter.hpp>
 #include <geode/mesh/core/mesh_factory.hpp>
 
 namespace geode
@@ -40,6 +41,30 @@ namespace geode
             return vertex_attribute_manager_;
         }
 
+        MeshRevisions revisions() const
+        {
+            MeshRevisions revisions;
+            revisions.geometry = geometry_revision_.revision();
+            revisions.connectivity = connectivity_revision_.revision();
+            revisions.attribute = attribute_revision_.revision();
+            return revisions;
+        }
+
+        void update_geometry_revision()
+        {
+            geometry_revision_.modified();
+        }
+
+        void update_connectivity_revision()
+        {
+            connectivity_revision_.modified();
+        }
+
+        void update_attribute_revision()
+        {
+            attribute_revision_.modified();
+        }
+
     private:
         friend class bitsery::Access;
         template < typename Archive >
@@ -53,6 +78,9 @@ namespace geode
 
     private:
         mutable AttributeManager vertex_attribute_manager_;
+        internal::RevisionCounter geometry_revision_;
+        internal::RevisionCounter connectivity_revision_;
+        internal::RevisionCounter attribute_revision_;
     };
 
     VertexSet::VertexSet() = default;
@@ -89,6 +117,26 @@ namespace geode
         return impl_->vertex_attribute_manager();
     }
 
+    MeshRevisions VertexSet::revisions() const
+    {
+        return impl_->revisions();
+    }
+
+    void VertexSet::update_geometry_revision( VertexSetBuilderKey )
+    {
+        impl_->update_geometry_revision();
+    }
+
+    void VertexSet::update_connectivity_revision( VertexSetBuilderKey )
+    {
+        impl_->update_connectivity_revision();
+    }
+
+    void VertexSet::update_attribute_revision( VertexSetBuilderKey )
+    {
+        impl_->update_attribute_revision();
+    }
+
     template < typename Archive >
     void VertexSet::serialize( Archive& archive )
     {
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/mesh/helpers/adaptive_grid_attribute.hpp>
+
+#include <geode/mesh/core/light_regular_grid.hpp>
+
+namespace geode
+{
+    template < typename T, index_t dimension >
+    void sample_finest_cell_attribute( const AdaptiveGrid< dimension >& grid,
+        const ReadOnlyAttribute< T >& finest_attribute,
+        std::string_view attribute_name,
+        T default_value )
+    {
+        const auto& finest_grid = grid.finest_grid();
+        sample_cell_attribute< T >(
+            grid,
+            [&grid, &finest_grid, &finest_attribute](
+                const typename AdaptiveGrid< dimension >::Cell& cell ) {
+                return finest_attribute.value( finest_grid.cell_index(
+                    grid.central_finest_cell( cell ) ) );
+            },
+            attribute_name, std::move( default_value ) );
+    }
+
+    template void opengeode_mesh_api sample_finest_cell_attribute(
+        const AdaptiveGrid2D&, const ReadOnlyAttribute< double >&,
+        std::string_view,
+        double );
+    template void opengeode_mesh_api sample_finest_cell_attribute(
+        const AdaptiveGrid3D&, const ReadOnlyAttribute< double >&,
+        std::string_view,
+        double );
+    template void opengeode_mesh_api sample_finest_cell_attribute(
+        const AdaptiveGrid2D&, const ReadOnlyAttribute< index_t >&,
+        std::string_view,
+        index_t );
+    template void opengeode_mesh_api sample_finest_cell_attribute(
+        const AdaptiveGrid3D&, const ReadOnlyAttribute< index_t >&,
+        std::string_view,
+        index_t );
+} // namespace geode
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/mesh/helpers/bricked_grid_values.hpp>
+
+#include <async++.h>
+
+namespace geode
+{
+    template < typename T, index_t dimension >
+    void BrickedGridValues< T, dimension >::import_values(
+        const ReadOnlyAttribute< T >& attribute )
+    {
+        async::parallel_for( async::irange( index_t{ 0 }, layout_.nb_bricks() ),
+            [this, &attribute]( index_t brick ) {
+                layout_.for_each_element_in_brick(
+                    brick, [this, &attribute]( const ElementIndices& indices,
+                               index_t storage_index ) {
+                        values_[storage_index] =
+                            attribute.value( layout_.linear_index( indices ) );
+                    } );
+            } );
+    }
+
+    template < typename T, index_t dimension >
+    void BrickedGridValues< T, dimension >::export_values(
+        VariableAttribute< T >& attribute ) const
+    {
+        async::parallel_for( async::irange( index_t{ 0 }, layout_.nb_bricks() ),
+            [this, &attribute]( index_t brick ) {
+                layout_.for_each_element_in_brick(
+                    brick, [this, &attribute]( const ElementIndices& indices,
+                               index_t storage_index ) {
+                        attribute.set_value( layout_.linear_index( indices ),
+                            values_[storage_index] );
+                    } );
+            } );
+    }
+
+    template class opengeode_mesh_api BrickedGridValues< double, 2 >;
+    template class opengeode_mesh_api BrickedGridValues< double, 3 >;
+    template class opengeode_mesh_api BrickedGridValues< index_t, 2 >;
+    template class opengeode_mesh_api BrickedGridValues< index_t, 3 >;
+} // namespace geode
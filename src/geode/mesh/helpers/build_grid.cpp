@@ -61,15 +61,15 @@ namespace geode
         {
             if( target_is_ok )
             {
-                cell_numbers[d] = std::max(
-                    1u, static_cast< index_t >(
-                            std::ceil( diagonal.value( d ) / cell_length ) ) );
+                cell_numbers[d] = std::max( index_t{ 1 },
+                    static_cast< index_t >(
+                        std::ceil( diagonal.value( d ) / cell_length ) ) );
             }
             else
             {
-                cell_numbers[d] = std::max(
-                    1u, static_cast< index_t >(
-                            std::floor( diagonal.value( d ) / cell_length ) ) );
+                cell_numbers[d] = std::max( index_t{ 1 },
+                    static_cast< index_t >(
+                        std::floor( diagonal.value( d ) / cell_length ) ) );
             }
             cell_lengths[d] = std::max(
                 2 * GLOBAL_EPSILON, diagonal.value( d ) / cell_numbers[d] );
@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#include <geode/mesh/helpers/closest_triangle_grid.hpp>
+
+#include <cmath>
+#include <limits>
+
+#include <async++.h>
+
+#include <absl/algorithm/container.h>
+#include <absl/container/fixed_array.h>
+
+#include <geode/basic/pimpl_impl.hpp>
+
+#include <geode/geometry/aabb.hpp>
+#include <geode/geometry/bounding_box.hpp>
+#include <geode/geometry/point.hpp>
+
+#include <geode/mesh/core/light_regular_grid.hpp>
+#include <geode/mesh/core/triangulated_surface.hpp>
+#include <geode/mesh/helpers/aabb_surface_helpers.hpp>
+
+namespace
+{
+    geode::LightRegularGrid3D build_grid(
+        const geode::TriangulatedSurface3D& surface, geode::index_t max_cells )
+    {
+        OPENGEODE_EXCEPTION( surface.nb_polygons() != 0,
+            "[ClosestTriangleGrid] Surface has no triangle" );
+        OPENGEODE_EXCEPTION(
+            max_cells != 0, "[ClosestTriangleGrid] Invalid cell budget" );
+        const auto box = surface.bounding_box();
+        std::array< double, 3 > extents;
+        double volume{ 1 };
+        for( const auto d : geode::LRange{ 3 } )
+        {
+            extents[d] = std::max( box.max().value( d ) - box.min().value( d ),
+                geode::GLOBAL_EPSILON );
+            volume *= extents[d];
+        }
+        auto cell_length = std::cbrt( volume / max_cells );
+        std::array< geode::index_t, 3 > nb_cells;
+        while( true )
+        {
+            double total{ 1 };
+            for( const auto d : geode::LRange{ 3 } )
+            {
+                nb_cells[d] = std::max( geode::index_t{ 1 },
+                    static_cast< geode::index_t >(
+                        std::ceil( extents[d] / cell_length ) ) );
+                total *= nb_cells[d];
+            }
+            if( total <= max_cells )
+            {
+                break;
+            }
+            cell_length *= 1.1;
+        }
+        return { box.min(), nb_cells, { cell_length, cell_length,
+                                           cell_length } };
+    }
+} // namespace
+
+namespace geode
+{
+    class ClosestTriangleGrid::Impl
+    {
+    public:
+        Impl( const TriangulatedSurface3D& surface,
+            const ClosestTriangleGridParameters& parameters )
+            : tree_{ create_aabb_tree( surface ) },
+              distance_action_{ surface },
+              grid_{ build_grid( surface, parameters.max_nb_cells ) },
+              origin_{ grid_.grid_point( { 0, 0, 0 } ) },
+              cell_length_{ grid_.cell_length_in_direction( 0 ) }
+        {
+            compute_candidates( parameters.max_nb_candidates );
+        }
+
+        const LightRegularGrid3D& grid() const
+        {
+            return grid_;
+        }
+
+        index_t nb_accelerated_cells() const
+        {
+            return nb_accelerated_cells_;
+        }
+
+        std::tuple< index_t, double > closest_triangle(
+            const Point3D& query ) const
+        {
+            const auto cell = locate( query );
+            if( cell == NO_ID || offsets_[cell] == offsets_[cell + 1] )
+            {
+                return tree_.closest_element_box( query, distance_action_ );
+            }
+            std::tuple< index_t, double > result{ NO_ID,
+                std::numeric_limits< double >::max() };
+            for( const auto c : Range{ offsets_[cell], offsets_[cell + 1] } )
+            {
+                const auto distance =
+                    distance_action_( query, candidates_[c] );
+                if( distance < std::get< 1 >( result ) )
+                {
+                    result = { candidates_[c], distance };
+                }
+            }
+            return result;
+        }
+
+    private:
+        void compute_candidates( index_t max_nb_candidates )
+        {
+            const auto nb_cells = grid_.nb_cells();
+            const auto half_diagonal = std::sqrt( 3. ) * cell_length_ / 2.;
+            absl::FixedArray< std::vector< index_t > > cell_candidates(
+                nb_cells );
+            async::parallel_for( async::irange( index_t{ 0 }, nb_cells ),
+                [this, &cell_candidates, half_diagonal,
+                    max_nb_candidates]( index_t cell ) {
+                    const auto center =
+                        grid_.cell_barycenter( grid_.cell_indices( cell ) );
+                    const auto closest_distance = std::get< 1 >(
+                        tree_.closest_element_box( center, distance_action_ ) );
+                    // Any triangle closest to a point of the cell is closer
+                    // to the center than this radius
+                    const auto radius = closest_distance + 2 * half_diagonal;
+                    BoundingBox3D box;
+                    box.add_point( Point3D{ { center.value( 0 ) - radius,
+                        center.value( 1 ) - radius,
+                        center.value( 2 ) - radius } } );
+                    box.add_point( Point3D{ { center.value( 0 ) + radius,
+                        center.value( 1 ) + radius,
+                        center.value( 2 ) + radius } } );
+                    auto& candidates = cell_candidates[cell];
+                    bool overflow{ false };
+                    auto action = [this, &center, &candidates, &overflow,
+                                      radius, max_nb_candidates](
+                                      index_t triangle ) {
+                        if( distance_action_( center, triangle ) > radius )
+                        {
+                            return false;
+                        }
+                        if( candidates.size() == max_nb_candidates )
+                        {
+                            overflow = true;
+                            return true;
+                        }
+                        candidates.push_back( triangle );
+                        return false;
+                    };
+                    tree_.compute_bbox_element_bbox_intersections(
+                        box, action );
+                    if( overflow )
+                    {
+                        candidates.clear();
+                        candidates.shrink_to_fit();
+                    }
+                } );
+            offsets_.resize( nb_cells + 1 );
+            offsets_[0] = 0;
+            for( const auto cell : Range{ nb_cells } )
+            {
+                const auto nb_candidates =
+                    checked_index( cell_candidates[cell].size() );
+                offsets_[cell + 1] = offsets_[cell] + nb_candidates;
+                if( nb_candidates != 0 )
+                {
+                    nb_accelerated_cells_++;
+                }
+            }
+            candidates_.resize( offsets_.back() );
+            async::parallel_for( async::irange( index_t{ 0 }, nb_cells ),
+                [this, &cell_candidates]( index_t cell ) {
+                    absl::c_copy( cell_candidates[cell],
+                        candidates_.begin() + offsets_[cell] );
+                } );
+        }
+
+        index_t locate( const Point3D& query ) const
+        {
+            std::array< index_t, 3 > cell;
+            for( const auto d : LRange{ 3 } )
+            {
+                const auto position =
+                    ( query.value( d ) - origin_.value( d ) ) / cell_length_;
+                const auto nb_cells = grid_.nb_cells_in_direction( d );
+                if( position < 0 || position > nb_cells )
+                {
+                    return NO_ID;
+                }
+                cell[d] = std::min(
+                    static_cast< index_t >( position ), nb_cells - 1 );
+            }
+            return grid_.cell_index( cell );
+        }
+
+    private:
+        const AABBTree3D tree_;
+        const DistanceToTriangle3D distance_action_;
+        const LightRegularGrid3D grid_;
+        const Point3D origin_;
+        const double cell_length_;
+        std::vector< index_t > offsets_;
+        std::vector< index_t > candidates_;
+        index_t nb_accelerated_cells_{ 0 };
+    };
+
+    ClosestTriangleGrid::ClosestTriangleGrid(
+        const TriangulatedSurface3D& surface,
+        const ClosestTriangleGridParameters& parameters )
+        : impl_{ surface, parameters }
+    {
+    }
+
+    ClosestTriangleGrid::ClosestTriangleGrid(
+        ClosestTriangleGrid&& ) noexcept = default;
+
+    ClosestTriangleGrid::~ClosestTriangleGrid() = default;
+
+    const LightRegularGrid3D& ClosestTriangleGrid::grid() const
+    {
+        return impl_->grid();
+    }
+
+    index_t ClosestTriangleGrid::nb_accelerated_cells() const
+    {
+        return impl_->nb_accelerated_cells();
+    }
+
+    std::tuple< index_t, double > ClosestTriangleGrid::closest_triangle(
+        const Point3D& query ) const
+    {
+        return impl_->closest_triangle( query );
+    }
+
+    std::vector< std::tuple< index_t, double > >
+        ClosestTriangleGrid::closest_triangles(
+            absl::Span< const Point3D > queries ) const
+    {
+        std::vector< std::tuple< index_t, double > > results( queries.size() );
+        async::parallel_for( async::irange( size_t{ 0 }, queries.size() ),
+            [this, &queries, &results]( size_t query ) {
+                results[query] = impl_->closest_triangle( queries[query] );
+            } );
+        return results;
+    }
+} // namespace geode
@@ -0,0 +1,746 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/mesh/helpers/compressed_simplicial_mesh.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#include <geode/basic/pimpl_impl.hpp>
+#include <geode/basic/range.hpp>
+
+#include <geode/geometry/point.hpp>
+#include <geode/geometry/points_sort.hpp>
+
+#include <geode/mesh/builder/tetrahedral_solid_builder.hpp>
+#include <geode/mesh/builder/triangulated_surface_builder.hpp>
+#include <geode/mesh/core/tetrahedral_solid.hpp>
+#include <geode/mesh/core/triangulated_surface.hpp>
+
+namespace
+{
+    using Adjacent = std::pair< geode::index_t, geode::local_index_t >;
+
+    geode::local_index_t bit_width( std::uint64_t value )
+    {
+        geode::local_index_t width{ 0 };
+        while( value != 0 )
+        {
+            width++;
+            value >>= 1;
+        }
+        return width;
+    }
+
+    std::uint64_t zigzag_encode( std::int64_t value )
+    {
+        return ( static_cast< std::uint64_t >( value ) << 1 )
+               ^ static_cast< std::uint64_t >( value >> 63 );
+    }
+
+    std::int64_t zigzag_decode( std::uint64_t value )
+    {
+        return static_cast< std::int64_t >( value >> 1 )
+               ^ -static_cast< std::int64_t >( value & 1 );
+    }
+
+    /*!
+     * Append-only sequence of unsigned values of at most 64 bits.
+     */
+    class BitStream
+    {
+    public:
+        std::uint64_t nb_bits() const
+        {
+            return nb_bits_;
+        }
+
+        geode::index_t nb_bytes() const
+        {
+            return geode::checked_index(
+                words_.size() * sizeof( std::uint64_t ) );
+        }
+
+        void push( std::uint64_t value, geode::local_index_t width )
+        {
+            if( width == 0 )
+            {
+                return;
+            }
+            const auto shift = nb_bits_ % WORD_SIZE;
+            if( shift == 0 )
+            {
+                words_.push_back( 0 );
+            }
+            words_.back() |= value << shift;
+            if( shift + width > WORD_SIZE )
+            {
+                words_.push_back( value >> ( WORD_SIZE - shift ) );
+            }
+            nb_bits_ += width;
+        }
+
+        std::uint64_t read(
+            std::uint64_t offset, geode::local_index_t width ) const
+        {
+            if( width == 0 )
+            {
+                return 0;
+            }
+            const auto word = offset / WORD_SIZE;
+            const auto shift = offset % WORD_SIZE;
+            auto value = words_[word] >> shift;
+            if( shift + width > WORD_SIZE )
+            {
+                value |= words_[word + 1] << ( WORD_SIZE - shift );
+            }
+            if( width < WORD_SIZE )
+            {
+                value &= ( std::uint64_t{ 1 } << width ) - 1;
+            }
+            return value;
+        }
+
+        void shrink_to_fit()
+        {
+            words_.shrink_to_fit();
+        }
+
+    private:
+        static constexpr std::uint64_t WORD_SIZE{ 64 };
+
+        std::vector< std::uint64_t > words_;
+        std::uint64_t nb_bits_{ 0 };
+    };
+
+    /*!
+     * Bit-packed vertices and adjacencies of simplices, stored by blocks of
+     * BLOCK_SIZE simplices. Each block stores first the vertex offsets from
+     * the smallest vertex of the block, then the adjacency codes: 0 for no
+     * adjacent, otherwise one plus the zigzag-coded difference between the
+     * adjacent and the simplex indices followed by the two bits of the local
+     * facet in the adjacent simplex.
+     */
+    template < geode::local_index_t nb_simplex_vertices >
+    class CompressedSimplices
+    {
+        static constexpr geode::index_t BLOCK_SIZE{ 64 };
+        static constexpr geode::local_index_t FACET_BITS{ 2 };
+
+        struct Block
+        {
+            std::uint64_t offset;
+            geode::index_t vertex_base;
+            geode::local_index_t vertex_width;
+            geode::local_index_t adjacent_width;
+        };
+
+    public:
+        using Vertices = std::array< geode::index_t, nb_simplex_vertices >;
+
+        template < typename VerticesGetter, typename AdjacentGetter >
+        CompressedSimplices( geode::index_t nb_simplices,
+            const VerticesGetter& simplex_vertices,
+            const AdjacentGetter& simplex_adjacent )
+            : nb_simplices_( nb_simplices )
+        {
+            blocks_.reserve( ( nb_simplices + BLOCK_SIZE - 1 ) / BLOCK_SIZE );
+            std::array< Vertices, BLOCK_SIZE > vertices;
+            std::array< std::array< std::uint64_t, nb_simplex_vertices >,
+                BLOCK_SIZE >
+                codes;
+            for( geode::index_t begin = 0; begin < nb_simplices;
+                 begin += BLOCK_SIZE )
+            {
+                const auto end = std::min( begin + BLOCK_SIZE, nb_simplices );
+                Block block{ bits_.nb_bits(),
+                    std::numeric_limits< geode::index_t >::max(), 0, 0 };
+                std::uint64_t max_vertex_offset{ 0 };
+                std::uint64_t max_code{ 0 };
+                for( const auto s : geode::Range{ begin, end } )
+                {
+                    vertices[s - begin] = simplex_vertices( s );
+                    for( const auto vertex : vertices[s - begin] )
+                    {
+                        block.vertex_base =
+                            std::min( block.vertex_base, vertex );
+                    }
+                }
+                for( const auto s : geode::Range{ begin, end } )
+                {
+                    for( const auto v :
+                        geode::LRange{ nb_simplex_vertices } )
+                    {
+                        max_vertex_offset = std::max( max_vertex_offset,
+                            std::uint64_t{ vertices[s - begin][v]
+                                           - block.vertex_base } );
+                        auto& code = codes[s - begin][v];
+                        code = encode_adjacent( s, simplex_adjacent( s, v ) );
+                        max_code = std::max( max_code, code );
+                    }
+                }
+                block.vertex_width = bit_width( max_vertex_offset );
+                block.adjacent_width = bit_width( max_code );
+                for( const auto s : geode::Range{ begin, end } )
+                {
+                    for( const auto vertex : vertices[s - begin] )
+                    {
+                        bits_.push(
+                            vertex - block.vertex_base, block.vertex_width );
+                    }
+                }
+                for( const auto s : geode::Range{ begin, end } )
+                {
+                    for( const auto code : codes[s - begin] )
+                    {
+                        bits_.push( code, block.adjacent_width );
+                    }
+                }
+                blocks_.push_back( block );
+            }
+            bits_.shrink_to_fit();
+        }
+
+        geode::index_t nb_simplices() const
+        {
+            return nb_simplices_;
+        }
+
+        geode::index_t vertex(
+            geode::index_t simplex, geode::local_index_t vertex_id ) const
+        {
+            OPENGEODE_ASSERT( simplex < nb_simplices_,
+                "[CompressedSimplices::vertex] Invalid simplex" );
+            const auto& block = blocks_[simplex / BLOCK_SIZE];
+            const auto local = simplex % BLOCK_SIZE;
+            const auto position = std::uint64_t{ local } * nb_simplex_vertices
+                                  + vertex_id;
+            return block.vertex_base
+                   + geode::checked_index( bits_.read(
+                       block.offset + position * block.vertex_width,
+                       block.vertex_width ) );
+        }
+
+        Vertices vertices( geode::index_t simplex ) const
+        {
+            Vertices result;
+            for( const auto v : geode::LRange{ nb_simplex_vertices } )
+            {
+                result[v] = vertex( simplex, v );
+            }
+            return result;
+        }
+
+        std::optional< Adjacent > adjacent(
+            geode::index_t simplex, geode::local_index_t facet ) const
+        {
+            OPENGEODE_ASSERT( simplex < nb_simplices_,
+                "[CompressedSimplices::adjacent] Invalid simplex" );
+            const auto block_id = simplex / BLOCK_SIZE;
+            const auto& block = blocks_[block_id];
+            const auto block_begin = block_id * BLOCK_SIZE;
+            const auto nb_block_values =
+                std::uint64_t{ std::min( BLOCK_SIZE,
+                    nb_simplices_ - block_begin ) }
+                * nb_simplex_vertices;
+            const auto position =
+                std::uint64_t{ simplex - block_begin } * nb_simplex_vertices
+                + facet;
+            const auto code = bits_.read( block.offset
+                                              + nb_block_values
+                                                    * block.vertex_width
+                                              + position
+                                                    * block.adjacent_width,
+                block.adjacent_width );
+            if( code == 0 )
+            {
+                return std::nullopt;
+            }
+            const auto value = code - 1;
+            const auto adjacent_simplex = geode::checked_index(
+                simplex + zigzag_decode( value >> FACET_BITS ) );
+            const auto adjacent_facet = static_cast< geode::local_index_t >(
+                value & ( ( 1u << FACET_BITS ) - 1 ) );
+            return Adjacent{ adjacent_simplex, adjacent_facet };
+        }
+
+        geode::index_t nb_bytes() const
+        {
+            return bits_.nb_bytes()
+                   + geode::checked_index( blocks_.size() * sizeof( Block ) );
+        }
+
+    private:
+        static std::uint64_t encode_adjacent(
+            geode::index_t simplex, const std::optional< Adjacent >& adjacent )
+        {
+            if( !adjacent )
+            {
+                return 0;
+            }
+            const auto delta = static_cast< std::int64_t >( adjacent->first )
+                               - static_cast< std::int64_t >( simplex );
+            return ( ( zigzag_encode( delta ) << FACET_BITS )
+                       | adjacent->second )
+                   + 1;
+        }
+
+    private:
+        geode::index_t nb_simplices_;
+        std::vector< Block > blocks_;
+        BitStream bits_;
+    };
+
+    template < typename Mesh >
+    auto mesh_points( const Mesh& mesh )
+    {
+        std::vector< std::decay_t< decltype( mesh.point( 0 ) ) > > points;
+        points.reserve( mesh.nb_vertices() );
+        for( const auto v : geode::Range{ mesh.nb_vertices() } )
+        {
+            points.push_back( mesh.point( v ) );
+        }
+        return points;
+    }
+} // namespace
+
+namespace geode
+{
+    template < index_t dimension >
+    class CompressedTriangulatedSurface< dimension >::Impl
+    {
+    public:
+        explicit Impl( const TriangulatedSurface< dimension >& surface )
+            : points_( mesh_points( surface ) ),
+              triangles_( surface.nb_polygons(),
+                  [&surface]( index_t polygon_id ) {
+                      const auto vertices =
+                          surface.polygon_vertices( polygon_id );
+                      return std::array< index_t, 3 >{ vertices[0],
+                          vertices[1], vertices[2] };
+                  },
+                  [&surface]( index_t polygon_id,
+                      local_index_t edge_id ) -> std::optional< Adjacent > {
+                      if( const auto adjacent = surface.polygon_adjacent_edge(
+                              { polygon_id, edge_id } ) )
+                      {
+                          return Adjacent{ adjacent->polygon_id,
+                              adjacent->edge_id };
+                      }
+                      return std::nullopt;
+                  } )
+        {
+        }
+
+        index_t nb_vertices() const
+        {
+            return checked_index( points_.size() );
+        }
+
+        index_t nb_polygons() const
+        {
+            return triangles_.nb_simplices();
+        }
+
+        const Point< dimension >& point( index_t vertex_id ) const
+        {
+            return points_[vertex_id];
+        }
+
+        index_t polygon_vertex( const PolygonVertex& polygon_vertex ) const
+        {
+            return triangles_.vertex(
+                polygon_vertex.polygon_id, polygon_vertex.vertex_id );
+        }
+
+        std::array< index_t, 3 > polygon_vertices( index_t polygon_id ) const
+        {
+            return triangles_.vertices( polygon_id );
+        }
+
+        std::optional< PolygonEdge > polygon_adjacent_edge(
+            const PolygonEdge& polygon_edge ) const
+        {
+            if( const auto adjacent = triangles_.adjacent(
+                    polygon_edge.polygon_id, polygon_edge.edge_id ) )
+            {
+                return PolygonEdge{ adjacent->first, adjacent->second };
+            }
+            return std::nullopt;
+        }
+
+        index_t connectivity_nb_bytes() const
+        {
+            return triangles_.nb_bytes();
+        }
+
+        std::unique_ptr< TriangulatedSurface< dimension > > decompress() const
+        {
+            auto surface = TriangulatedSurface< dimension >::create();
+            auto builder =
+                TriangulatedSurfaceBuilder< dimension >::create( *surface );
+            for( const auto& point : points_ )
+            {
+                builder->create_point( point );
+            }
+            for( const auto t : Range{ nb_polygons() } )
+            {
+                builder->create_triangle( triangles_.vertices( t ) );
+            }
+            for( const auto t : Range{ nb_polygons() } )
+            {
+                for( const auto e : LRange{ 3 } )
+                {
+                    if( const auto adjacent = triangles_.adjacent( t, e ) )
+                    {
+                        builder->set_polygon_adjacent(
+                            { t, e }, adjacent->first );
+                    }
+                }
+            }
+            return surface;
+        }
+
+    private:
+        std::vector< Point< dimension > > points_;
+        CompressedSimplices< 3 > triangles_;
+    };
+
+    template < index_t dimension >
+    CompressedTriangulatedSurface< dimension >::CompressedTriangulatedSurface(
+        const TriangulatedSurface< dimension >& surface )
+        : impl_{ surface }
+    {
+    }
+
+    template < index_t dimension >
+    CompressedTriangulatedSurface< dimension >::CompressedTriangulatedSurface(
+        CompressedTriangulatedSurface&& ) noexcept = default;
+
+    template < index_t dimension >
+    CompressedTriangulatedSurface<
+        dimension >::~CompressedTriangulatedSurface() = default;
+
+    template < index_t dimension >
+    index_t CompressedTriangulatedSurface< dimension >::nb_vertices() const
+    {
+        return impl_->nb_vertices();
+    }
+
+    template < index_t dimension >
+    index_t CompressedTriangulatedSurface< dimension >::nb_polygons() const
+    {
+        return impl_->nb_polygons();
+    }
+
+    template < index_t dimension >
+    const Point< dimension >& CompressedTriangulatedSurface< dimension >::point(
+        index_t vertex_id ) const
+    {
+        return impl_->point( vertex_id );
+    }
+
+    template < index_t dimension >
+    index_t CompressedTriangulatedSurface< dimension >::polygon_vertex(
+        const PolygonVertex& polygon_vertex ) const
+    {
+        return impl_->polygon_vertex( polygon_vertex );
+    }
+
+    template < index_t dimension >
+    std::array< index_t, 3 >
+        CompressedTriangulatedSurface< dimension >::polygon_vertices(
+            index_t polygon_id ) const
+    {
+        return impl_->polygon_vertices( polygon_id );
+    }
+
+    template < index_t dimension >
+    std::optional< index_t >
+        CompressedTriangulatedSurface< dimension >::polygon_adjacent(
+            const PolygonEdge& polygon_edge ) const
+    {
+        if( const auto adjacent = impl_->polygon_adjacent_edge( polygon_edge ) )
+        {
+            return adjacent->polygon_id;
+        }
+        return std::nullopt;
+    }
+
+    template < index_t dimension >
+    std::optional< PolygonEdge >
+        CompressedTriangulatedSurface< dimension >::polygon_adjacent_edge(
+            const PolygonEdge& polygon_edge ) const
+    {
+        return impl_->polygon_adjacent_edge( polygon_edge );
+    }
+
+    template < index_t dimension >
+    index_t CompressedTriangulatedSurface<
+        dimension >::connectivity_nb_bytes() const
+    {
+        return impl_->connectivity_nb_bytes();
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< TriangulatedSurface< dimension > >
+        CompressedTriangulatedSurface< dimension >::decompress() const
+    {
+        return impl_->decompress();
+    }
+
+    template < index_t dimension >
+    class CompressedTetrahedralSolid< dimension >::Impl
+    {
+    public:
+        explicit Impl( const TetrahedralSolid< dimension >& solid )
+            : points_( mesh_points( solid ) ),
+              tetrahedra_( solid.nb_polyhedra(),
+                  [&solid]( index_t polyhedron_id ) {
+                      const auto vertices =
+                          solid.polyhedron_vertices( polyhedron_id );
+                      return std::array< index_t, 4 >{ vertices[0],
+                          vertices[1], vertices[2], vertices[3] };
+                  },
+                  [&solid]( index_t polyhedron_id,
+                      local_index_t facet_id ) -> std::optional< Adjacent > {
+                      if( const auto adjacent = solid.polyhedron_adjacent_facet(
+                              { polyhedron_id, facet_id } ) )
+                      {
+                          return Adjacent{ adjacent->polyhedron_id,
+                              adjacent->facet_id };
+                      }
+                      return std::nullopt;
+                  } )
+        {
+        }
+
+        index_t nb_vertices() const
+        {
+            return checked_index( points_.size() );
+        }
+
+        index_t nb_polyhedra() const
+        {
+            return tetrahedra_.nb_simplices();
+        }
+
+        const Point< dimension >& point( index_t vertex_id ) const
+        {
+            return points_[vertex_id];
+        }
+
+        index_t polyhedron_vertex(
+            const PolyhedronVertex& polyhedron_vertex ) const
+        {
+            return tetrahedra_.vertex(
+                polyhedron_vertex.polyhedron_id, polyhedron_vertex.vertex_id );
+        }
+
+        std::array< index_t, 4 > polyhedron_vertices(
+            index_t polyhedron_id ) const
+        {
+            return tetrahedra_.vertices( polyhedron_id );
+        }
+
+        std::optional< PolyhedronFacet > polyhedron_adjacent_facet(
+            const PolyhedronFacet& polyhedron_facet ) const
+        {
+            if( const auto adjacent =
+                    tetrahedra_.adjacent( polyhedron_facet.polyhedron_id,
+                        polyhedron_facet.facet_id ) )
+            {
+                return PolyhedronFacet{ adjacent->first, adjacent->second };
+            }
+            return std::nullopt;
+        }
+
+        index_t connectivity_nb_bytes() const
+        {
+            return tetrahedra_.nb_bytes();
+        }
+
+        std::unique_ptr< TetrahedralSolid< dimension > > decompress() const
+        {
+            auto solid = TetrahedralSolid< dimension >::create();
+            auto builder =
+                TetrahedralSolidBuilder< dimension >::create( *solid );
+            for( const auto& point : points_ )
+            {
+                builder->create_point( point );
+            }
+            for( const auto t : Range{ nb_polyhedra() } )
+            {
+                builder->create_tetrahedron( tetrahedra_.vertices( t ) );
+            }
+            for( const auto t : Range{ nb_polyhedra() } )
+            {
+                for( const auto f : LRange{ 4 } )
+                {
+                    if( const auto adjacent = tetrahedra_.adjacent( t, f ) )
+                    {
+                        builder->set_polyhedron_adjacent(
+                            { t, f }, adjacent->first );
+                    }
+                }
+            }
+            return solid;
+        }
+
+    private:
+        std::vector< Point< dimension > > points_;
+        CompressedSimplices< 4 > tetrahedra_;
+    };
+
+    template < index_t dimension >
+    CompressedTetrahedralSolid< dimension >::CompressedTetrahedralSolid(
+        const TetrahedralSolid< dimension >& solid )
+        : impl_{ solid }
+    {
+    }
+
+    template < index_t dimension >
+    CompressedTetrahedralSolid< dimension >::CompressedTetrahedralSolid(
+        CompressedTetrahedralSolid&& ) noexcept = default;
+
+    template < index_t dimension >
+    CompressedTetrahedralSolid< dimension >::~CompressedTetrahedralSolid() =
+        default;
+
+    template < index_t dimension >
+    index_t CompressedTetrahedralSolid< dimension >::nb_vertices() const
+    {
+        return impl_->nb_vertices();
+    }
+
+    template < index_t dimension >
+    index_t CompressedTetrahedralSolid< dimension >::nb_polyhedra() const
+    {
+        return impl_->nb_polyhedra();
+    }
+
+    template < index_t dimension >
+    const Point< dimension >& CompressedTetrahedralSolid< dimension >::point(
+        index_t vertex_id ) const
+    {
+        return impl_->point( vertex_id );
+    }
+
+    template < index_t dimension >
+    index_t CompressedTetrahedralSolid< dimension >::polyhedron_vertex(
+        const PolyhedronVertex& polyhedron_vertex ) const
+    {
+        return impl_->polyhedron_vertex( polyhedron_vertex );
+    }
+
+    template < index_t dimension >
+    std::array< index_t, 4 >
+        CompressedTetrahedralSolid< dimension >::polyhedron_vertices(
+            index_t polyhedron_id ) const
+    {
+        return impl_->polyhedron_vertices( polyhedron_id );
+    }
+
+    template < index_t dimension >
+    std::optional< index_t >
+        CompressedTetrahedralSolid< dimension >::polyhedron_adjacent(
+            const PolyhedronFacet& polyhedron_facet ) const
+    {
+        if( const auto adjacent =
+                impl_->polyhedron_adjacent_facet( polyhedron_facet ) )
+        {
+            return adjacent->polyhedron_id;
+        }
+        return std::nullopt;
+    }
+
+    template < index_t dimension >
+    std::optional< PolyhedronFacet >
+        CompressedTetrahedralSolid< dimension >::polyhedron_adjacent_facet(
+            const PolyhedronFacet& polyhedron_facet ) const
+    {
+        return impl_->polyhedron_adjacent_facet( polyhedron_facet );
+    }
+
+    template < index_t dimension >
+    index_t
+        CompressedTetrahedralSolid< dimension >::connectivity_nb_bytes() const
+    {
+        return impl_->connectivity_nb_bytes();
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< TetrahedralSolid< dimension > >
+        CompressedTetrahedralSolid< dimension >::decompress() const
+    {
+        return impl_->decompress();
+    }
+
+    template < index_t dimension >
+    SpatialSortMappings sort_triangulated_surface_spatially(
+        TriangulatedSurface< dimension >& surface )
+    {
+        auto builder =
+            TriangulatedSurfaceBuilder< dimension >::create( surface );
+        SpatialSortMappings mappings;
+        mappings.vertices = builder->permute_vertices(
+            morton_mapping< dimension >( mesh_points( surface ) ) );
+        std::vector< Point< dimension > > barycenters;
+        barycenters.reserve( surface.nb_polygons() );
+        for( const auto p : Range{ surface.nb_polygons() } )
+        {
+            barycenters.push_back( surface.polygon_barycenter( p ) );
+        }
+        mappings.elements = builder->permute_polygons(
+            morton_mapping< dimension >( barycenters ) );
+        return mappings;
+    }
+
+    SpatialSortMappings sort_tetrahedral_solid_spatially(
+        TetrahedralSolid3D& solid )
+    {
+        auto builder = TetrahedralSolidBuilder3D::create( solid );
+        SpatialSortMappings mappings;
+        mappings.vertices = builder->permute_vertices(
+            morton_mapping< 3 >( mesh_points( solid ) ) );
+        std::vector< Point3D > barycenters;
+        barycenters.reserve( solid.nb_polyhedra() );
+        for( const auto p : Range{ solid.nb_polyhedra() } )
+        {
+            barycenters.push_back( solid.polyhedron_barycenter( p ) );
+        }
+        mappings.elements =
+            builder->permute_polyhedra( morton_mapping< 3 >( barycenters ) );
+        return mappings;
+    }
+
+    template class opengeode_mesh_api CompressedTriangulatedSurface< 2 >;
+    template class opengeode_mesh_api CompressedTriangulatedSurface< 3 >;
+    template class opengeode_mesh_api CompressedTetrahedralSolid< 3 >;
+
+    template SpatialSortMappings opengeode_mesh_api
+        sort_triangulated_surface_spatially( TriangulatedSurface2D& );
+    template SpatialSortMappings opengeode_mesh_api
+        sort_triangulated_surface_spatially( TriangulatedSurface3D& );
+} // namespace geode
@@ -25,28 +25,142 @@
 
 #include <async++.h>
 
+#include <absl/strings/str_cat.h>
+
 #include <geode/basic/attribute_manager.hpp>
 #include <geode/basic/progress_logger.hpp>
 
 #include <geode/mesh/core/grid.hpp>
+#include <geode/mesh/helpers/bricked_grid_values.hpp>
+
+namespace
+{
+    template < geode::index_t dimension >
+    class LinearDistanceStorage
+    {
+        using Index = typename geode::Grid< dimension >::CellIndices;
+
+    public:
+        LinearDistanceStorage( const geode::Grid< dimension >& grid,
+            geode::VariableAttribute< double >& distance_map )
+            : grid_( grid ), distance_map_( distance_map )
+        {
+        }
+
+        double value( const Index& index ) const
+        {
+            return distance_map_.value( grid_.cell_index( index ) );
+        }
+
+        void set_value( const Index& index, double value )
+        {
+            distance_map_.set_value( grid_.cell_index( index ), value );
+        }
+
+        template < typename Modifier >
+        void modify_value( const Index& index, Modifier&& modifier )
+        {
+            distance_map_.modify_value( grid_.cell_index( index ),
+                std::forward< Modifier >( modifier ) );
+        }
+
+        void squared_root_filter()
+        {
+            async::parallel_for(
+                async::irange( geode::index_t{ 0 }, grid_.nb_cells() ),
+                [this]( geode::index_t cell ) {
+                    distance_map_.modify_value( cell, []( double& value ) {
+                        value = std::sqrt( value );
+                    } );
+                } );
+        }
+
+        void flush() {}
+
+    private:
+        const geode::Grid< dimension >& grid_;
+        geode::VariableAttribute< double >& distance_map_;
+    };
+
+    template < geode::index_t dimension >
+    class BrickedDistanceStorage
+    {
+        using Index = typename geode::Grid< dimension >::CellIndices;
+
+    public:
+        BrickedDistanceStorage( const geode::Grid< dimension >& grid,
+            geode::VariableAttribute< double >& distance_map,
+            geode::index_t brick_size )
+            : distance_map_( distance_map ),
+              values_( geode::grid_cell_brick_layout( grid, brick_size ),
+                  distance_map.default_value() )
+        {
+            values_.import_values( distance_map_ );
+        }
+
+        double value( const Index& index ) const
+        {
+            return values_.value( index );
+        }
+
+        void set_value( const Index& index, double value )
+        {
+            values_.set_value( index, value );
+        }
+
+        template < typename Modifier >
+        void modify_value( const Index& index, Modifier&& modifier )
+        {
+            values_.modify_value( index, std::forward< Modifier >( modifier ) );
+        }
+
+        void squared_root_filter()
+        {
+            const auto& layout = values_.layout();
+            async::parallel_for(
+                async::irange( geode::index_t{ 0 }, layout.nb_bricks() ),
+                [this, &layout]( geode::index_t brick ) {
+                    layout.for_each_element_in_brick(
+                        brick, [this]( const Index& /*unused*/,
+                                   geode::index_t storage_index ) {
+                            values_.set_storage_value( storage_index,
+                                std::sqrt(
+                                    values_.storage_value( storage_index ) ) );
+                        } );
+                } );
+        }
+
+        void flush()
+        {
+            values_.export_values( distance_map_ );
+        }
+
+    private:
+        geode::VariableAttribute< double >& distance_map_;
+        geode::BrickedGridValues< double, dimension > values_;
+    };
+} // namespace
 
 namespace geode
 {
-    template < index_t dimension >
+    template < index_t dimension, typename Storage >
     class EuclideanDistanceTransform
     {
         using Index = typename Grid< dimension >::CellIndices;
 
     public:
+        template < typename... StorageArgs >
         EuclideanDistanceTransform( const Grid< dimension >& grid,
             absl::Span< const Index > grid_cell_id,
-            std::string_view distance_map_name )
+            std::string_view distance_map_name,
+            StorageArgs... storage_args )
             : grid_( grid ),
               squared_cell_length_{},
               distance_map_{ grid.cell_attribute_manager()
                       .template find_or_create_attribute< VariableAttribute,
                           double >( distance_map_name,
-                          std::numeric_limits< double >::max() ) }
+                          std::numeric_limits< double >::max() ) },
+              storage_{ grid, *distance_map_, storage_args... }
         {
             for( const auto d : LRange( dimension ) )
             {
@@ -55,332 +169,172 @@ namespace geode
             }
             for( const auto& cell_id : grid_cell_id )
             {
-                distance_map_->set_value( grid_.cell_index( cell_id ), 0. );
+                storage_.set_value( cell_id, 0. );
             }
         }
 
-        std::shared_ptr< VariableAttribute< double > > distance_map() const
+        std::shared_ptr< VariableAttribute< double > > distance_map()
         {
+            storage_.flush();
             return distance_map_;
         }
 
-        void compute_squared_distance_map();
-
-        void squared_root_filter()
+        void compute_squared_distance_map()
         {
-            async::parallel_for(
-                async::irange( index_t{ 0 }, grid_.nb_cells() ),
-                [this]( index_t cell ) {
-                    distance_map_->modify_value( cell, []( double& value ) {
-                        value = std::sqrt( value );
-                    } );
-                } );
-            return;
+            ProgressLogger logger{ Logger::LEVEL::info,
+                absl::StrCat(
+                    "Compute ", dimension, "D euclidian distance" ),
+                dimension };
+            propagate_directional_squared_distance( 0 );
+            logger.increment();
+            for( const auto d : LRange{ 1, dimension } )
+            {
+                combine_squared_distance_components( d );
+                logger.increment();
+            }
         }
 
-    private:
-        void propagate_directional_squared_distance( const index_t direction );
-
-        double propagate_directional_step_squared_distance(
-            const Index& from_index,
-            const Index& to_index,
-            const index_t direction,
-            const double last_step_squared_distance )
+        void squared_root_filter()
         {
-            const auto old_distance =
-                distance_map_->value( grid_.cell_index( from_index ) );
-            const auto step_squared_distance =
-                old_distance == 0 ? squared_cell_length_[direction]
-                                  : last_step_squared_distance
-                                        + 2 * squared_cell_length_[direction];
-            const auto new_distance = old_distance + step_squared_distance;
-            distance_map_->modify_value(
-                grid_.cell_index( to_index ), [new_distance]( double& value ) {
-                    value = std::min( value, new_distance );
-                } );
-            return step_squared_distance;
+            storage_.squared_root_filter();
         }
 
-        void combine_squared_distance_components( const index_t direction );
-
-        double directional_squared_distance( const index_t from,
-            const index_t to,
-            const index_t direction ) const
+    private:
+        index_t nb_lines( const index_t direction ) const
         {
-            const auto directional_distance =
-                static_cast< double >( from ) - static_cast< double >( to );
-            return directional_distance * directional_distance
-                   * squared_cell_length_[direction];
+            return grid_.nb_cells() / grid_.nb_cells_in_direction( direction );
         }
 
-    private:
-        const Grid< dimension >& grid_;
-        std::array< double, dimension > squared_cell_length_;
-        std::shared_ptr< VariableAttribute< double > > distance_map_;
-    };
-
-    template <>
-    void
-        EuclideanDistanceTransform< 2 >::propagate_directional_squared_distance(
-            const index_t d )
-    {
-        const auto d2 = d == 1 ? 0 : 1;
-        absl::FixedArray< async::task< void > > tasks(
-            grid_.nb_cells_in_direction( d2 ) );
-        index_t task_id{ 0 };
-        for( const auto c2 : Range{ grid_.nb_cells_in_direction( d2 ) } )
+        Index line_origin( index_t line, const index_t direction ) const
         {
-            tasks[task_id++] = async::spawn( [this, d, d2, c2] {
-                double step_squared_distance{ 0. };
-                for( const auto c :
-                    Range{ 1, grid_.nb_cells_in_direction( d ) } )
-                {
-                    Index index;
-                    index[d] = c;
-                    index[d2] = c2;
-                    auto prev_index = index;
-                    prev_index[d] = c - 1;
-                    step_squared_distance =
-                        propagate_directional_step_squared_distance(
-                            prev_index, index, d, step_squared_distance );
-                }
-                step_squared_distance = 0.;
-                for( const auto c :
-                    ReverseRange{ grid_.nb_cells_in_direction( d ) - 1 } )
+            Index index;
+            index[direction] = 0;
+            for( const auto d : LRange{ dimension } )
+            {
+                if( d == direction )
                 {
-                    Index index;
-                    index[d] = c;
-                    index[d2] = c2;
-                    auto prev_index = index;
-                    prev_index[d] = c + 1;
-                    step_squared_distance =
-                        propagate_directional_step_squared_distance(
-                            prev_index, index, d, step_squared_distance );
+                    continue;
                 }
-            } );
-        }
-        for( auto& task : async::when_all( tasks ).get() )
-        {
-            task.get();
+                const auto nb_cells = grid_.nb_cells_in_direction( d );
+                index[d] = line % nb_cells;
+                line /= nb_cells;
+            }
+            return index;
         }
-    }
-    template <>
-    void
-        EuclideanDistanceTransform< 3 >::propagate_directional_squared_distance(
-            const index_t d )
-    {
-        const auto d2 = d == 2 ? 0 : d + 1;
-        const auto d3 = d2 == 2 ? 0 : d2 + 1;
-        absl::FixedArray< async::task< void > > tasks(
-            grid_.nb_cells_in_direction( d2 )
-            * grid_.nb_cells_in_direction( d3 ) );
-        index_t task_id{ 0 };
-        for( const auto c3 : Range{ grid_.nb_cells_in_direction( d3 ) } )
+
+        void propagate_directional_squared_distance( const index_t direction )
         {
-            for( const auto c2 : Range{ grid_.nb_cells_in_direction( d2 ) } )
-            {
-                tasks[task_id++] = async::spawn( [this, d, d2, d3, c2, c3] {
-                    double step_squared_distance{ 0 };
-                    for( const auto c :
-                        Range{ 1, grid_.nb_cells_in_direction( d ) } )
+            async::parallel_for(
+                async::irange( index_t{ 0 }, nb_lines( direction ) ),
+                [this, direction]( index_t line ) {
+                    const auto nb_cells =
+                        grid_.nb_cells_in_direction( direction );
+                    auto index = line_origin( line, direction );
+                    auto prev_index = index;
+                    double step_squared_distance{ 0. };
+                    for( const auto c : Range{ 1, nb_cells } )
                     {
-                        Index index;
-                        index[d] = c;
-                        index[d2] = c2;
-                        index[d3] = c3;
-                        auto prev_index = index;
-                        prev_index[d] = c - 1;
+                        index[direction] = c;
+                        prev_index[direction] = c - 1;
                         step_squared_distance =
                             propagate_directional_step_squared_distance(
-                                prev_index, index, d, step_squared_distance );
+                                prev_index, index, direction,
+                                step_squared_distance );
                     }
-                    step_squared_distance = 0;
-                    for( const auto c :
-                        ReverseRange{ grid_.nb_cells_in_direction( d ) - 1 } )
+                    step_squared_distance = 0.;
+                    for( const auto c : ReverseRange{ nb_cells - 1 } )
                     {
-                        Index index;
-                        index[d] = c;
-                        index[d2] = c2;
-                        index[d3] = c3;
-                        auto prev_index = index;
-                        prev_index[d] = c + 1;
+                        index[direction] = c;
+                        prev_index[direction] = c + 1;
                         step_squared_distance =
                             propagate_directional_step_squared_distance(
-                                prev_index, index, d, step_squared_distance );
+                                prev_index, index, direction,
+                                step_squared_distance );
                     }
                 } );
-            }
         }
-        for( auto& task : async::when_all( tasks ).get() )
+
+        double propagate_directional_step_squared_distance(
+            const Index& from_index,
+            const Index& to_index,
+            const index_t direction,
+            const double last_step_squared_distance )
         {
-            task.get();
+            const auto old_distance = storage_.value( from_index );
+            const auto step_squared_distance =
+                old_distance == 0 ? squared_cell_length_[direction]
+                                  : last_step_squared_distance
+                                        + 2 * squared_cell_length_[direction];
+            const auto new_distance = old_distance + step_squared_distance;
+            storage_.modify_value( to_index, [new_distance]( double& value ) {
+                value = std::min( value, new_distance );
+            } );
+            return step_squared_distance;
         }
-    }
 
-    template <>
-    void EuclideanDistanceTransform< 2 >::combine_squared_distance_components(
-        const index_t d )
-    {
-        const auto d2 = d == 1 ? 0 : 1;
-        absl::FixedArray< async::task< void > > tasks(
-            grid_.nb_cells_in_direction( d2 ) );
-        index_t task_id{ 0 };
-        for( const auto c2 : Range{ grid_.nb_cells_in_direction( d2 ) } )
+        void combine_squared_distance_components( const index_t direction )
         {
-            tasks[task_id++] = async::spawn( [this, d, d2, c2] {
-                absl::FixedArray< double > temps_dist(
-                    grid_.nb_cells_in_direction( d ) );
-                for( const auto c :
-                    Range{ 0, grid_.nb_cells_in_direction( d ) } )
-                {
-                    auto min_dist = std::numeric_limits< double >::max();
-                    for( const auto cf :
-                        Range{ c, grid_.nb_cells_in_direction( d ) } )
+            async::parallel_for(
+                async::irange( index_t{ 0 }, nb_lines( direction ) ),
+                [this, direction]( index_t line ) {
+                    const auto nb_cells =
+                        grid_.nb_cells_in_direction( direction );
+                    auto index = line_origin( line, direction );
+                    absl::FixedArray< double > line_distances( nb_cells );
+                    for( const auto c : Range{ nb_cells } )
                     {
-                        const auto step_squared_distance =
-                            directional_squared_distance( c, cf, d );
-                        if( min_dist < step_squared_distance )
-                        {
-                            break;
-                        }
-                        Index index;
-                        index[d] = cf;
-                        index[d2] = c2;
-                        min_dist = std::min( min_dist,
-                            distance_map_->value( grid_.cell_index( index ) )
-                                + step_squared_distance );
+                        index[direction] = c;
+                        line_distances[c] = storage_.value( index );
                     }
-                    for( const auto cb : ReverseRange{ c, 0 } )
-                    {
-                        const auto step_squared_distance =
-                            directional_squared_distance( c, cb, d );
-                        if( min_dist < step_squared_distance )
-                        {
-                            break;
-                        }
-                        Index index;
-                        index[d] = cb;
-                        index[d2] = c2;
-                        min_dist = std::min( min_dist,
-                            distance_map_->value( grid_.cell_index( index ) )
-                                + step_squared_distance );
-                    }
-                    temps_dist[c] = min_dist;
-                }
-                for( const auto c :
-                    Range{ 0, grid_.nb_cells_in_direction( d ) } )
-                {
-                    Index index;
-                    index[d] = c;
-                    index[d2] = c2;
-                    distance_map_->set_value(
-                        grid_.cell_index( index ), temps_dist[c] );
-                }
-            } );
-        }
-        for( auto& task : async::when_all( tasks ).get() )
-        {
-            task.get();
-        }
-    }
-    template <>
-    void EuclideanDistanceTransform< 3 >::combine_squared_distance_components(
-        const index_t d )
-    {
-        const auto d2 = d == 2 ? 0 : d + 1;
-        const auto d3 = d2 == 2 ? 0 : d2 + 1;
-        absl::FixedArray< async::task< void > > tasks(
-            grid_.nb_cells_in_direction( d2 )
-            * grid_.nb_cells_in_direction( d3 ) );
-        index_t task_id{ 0 };
-        for( const auto c3 : Range{ grid_.nb_cells_in_direction( d3 ) } )
-        {
-            for( const auto c2 : Range{ grid_.nb_cells_in_direction( d2 ) } )
-            {
-                tasks[task_id++] = async::spawn( [this, d, d2, d3, c2, c3] {
-                    absl::FixedArray< double > temps_dist(
-                        grid_.nb_cells_in_direction( d ) );
-                    for( const auto c :
-                        Range{ 0, grid_.nb_cells_in_direction( d ) } )
+                    for( const auto c : Range{ nb_cells } )
                     {
                         auto min_dist = std::numeric_limits< double >::max();
-                        for( const auto cf :
-                            Range{ c, grid_.nb_cells_in_direction( d ) } )
+                        for( const auto cf : Range{ c, nb_cells } )
                         {
                             const auto step_squared_distance =
-                                directional_squared_distance( c, cf, d );
+                                directional_squared_distance(
+                                    c, cf, direction );
                             if( min_dist < step_squared_distance )
                             {
                                 break;
                             }
-                            Index index;
-                            index[d] = cf;
-                            index[d2] = c2;
-                            index[d3] = c3;
-                            min_dist = std::min(
-                                min_dist, distance_map_->value(
-                                              grid_.cell_index( index ) )
-                                              + step_squared_distance );
+                            min_dist = std::min( min_dist,
+                                line_distances[cf] + step_squared_distance );
                         }
                         for( const auto cb : ReverseRange{ c, 0 } )
                         {
                             const auto step_squared_distance =
-                                directional_squared_distance( c, cb, d );
+                                directional_squared_distance(
+                                    c, cb, direction );
                             if( min_dist < step_squared_distance )
                             {
                                 break;
                             }
-                            Index index;
-                            index[d] = cb;
-                            index[d2] = c2;
-                            index[d3] = c3;
-                            min_dist = std::min(
-                                min_dist, distance_map_->value(
-                                              grid_.cell_index( index ) )
-                                              + step_squared_distance );
+                            min_dist = std::min( min_dist,
+                                line_distances[cb] + step_squared_distance );
                         }
-                        temps_dist[c] = min_dist;
-                    }
-                    for( const auto c :
-                        Range{ 0, grid_.nb_cells_in_direction( d ) } )
-                    {
-                        Index index;
-                        index[d] = c;
-                        index[d2] = c2;
-                        index[d3] = c3;
-                        distance_map_->set_value(
-                            grid_.cell_index( index ), temps_dist[c] );
+                        index[direction] = c;
+                        storage_.set_value( index, min_dist );
                     }
                 } );
-            }
         }
-        for( auto& task : async::when_all( tasks ).get() )
+
+        double directional_squared_distance( const index_t from,
+            const index_t to,
+            const index_t direction ) const
         {
-            task.get();
+            const auto directional_distance =
+                static_cast< double >( from ) - static_cast< double >( to );
+            return directional_distance * directional_distance
+                   * squared_cell_length_[direction];
         }
-    }
-    template <>
-    void EuclideanDistanceTransform< 2 >::compute_squared_distance_map()
-    {
-        ProgressLogger logger{ Logger::LEVEL::info,
-            "Compute 2D euclidian distance", 2 };
-        propagate_directional_squared_distance( 0 );
-        logger.increment();
-        combine_squared_distance_components( 1 );
-        logger.increment();
-    }
-    template <>
-    void EuclideanDistanceTransform< 3 >::compute_squared_distance_map()
-    {
-        ProgressLogger logger{ Logger::LEVEL::info,
-            "Compute 3D euclidian distance", 3 };
-        propagate_directional_squared_distance( 0 );
-        logger.increment();
-        combine_squared_distance_components( 1 );
-        logger.increment();
-        combine_squared_distance_components( 2 );
-        logger.increment();
-    }
+
+    private:
+        const Grid< dimension >& grid_;
+        std::array< double, dimension > squared_cell_length_;
+        std::shared_ptr< VariableAttribute< double > > distance_map_;
+        Storage storage_;
+    };
 
     template < index_t dimension >
     std::shared_ptr< VariableAttribute< double > > euclidean_distance_transform(
@@ -389,8 +343,25 @@ namespace geode
             grid_cell_ids,
         std::string_view distance_map_name )
     {
-        EuclideanDistanceTransform< dimension > edt{ grid, grid_cell_ids,
-            distance_map_name };
+        EuclideanDistanceTransform< dimension,
+            LinearDistanceStorage< dimension > >
+            edt{ grid, grid_cell_ids, distance_map_name };
+        edt.compute_squared_distance_map();
+        edt.squared_root_filter();
+        return edt.distance_map();
+    }
+
+    template < index_t dimension >
+    std::shared_ptr< VariableAttribute< double > >
+        bricked_euclidean_distance_transform( const Grid< dimension >& grid,
+            absl::Span< const typename Grid< dimension >::CellIndices >
+                grid_cell_ids,
+            std::string_view distance_map_name,
+            index_t brick_size )
+    {
+        EuclideanDistanceTransform< dimension,
+            BrickedDistanceStorage< dimension > >
+            edt{ grid, grid_cell_ids, distance_map_name, brick_size };
         edt.compute_squared_distance_map();
         edt.squared_root_filter();
         return edt.distance_map();
@@ -404,4 +375,15 @@ namespace geode
         opengeode_mesh_api euclidean_distance_transform< 3 >( const Grid3D&,
             absl::Span< const Grid3D::CellIndices >,
             std::string_view );
+
+    template std::shared_ptr< VariableAttribute< double > > opengeode_mesh_api
+        bricked_euclidean_distance_transform< 2 >( const Grid2D&,
+            absl::Span< const Grid2D::CellIndices >,
+            std::string_view,
+            index_t );
+    template std::shared_ptr< VariableAttribute< double > > opengeode_mesh_api
+        bricked_euclidean_distance_transform< 3 >( const Grid3D&,
+            absl::Span< const Grid3D::CellIndices >,
+            std::string_view,
+            index_t );
 } // namespace geode
@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#include <geode/mesh/helpers/mesh_quality.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <async++.h>
+
+#include <absl/algorithm/container.h>
+#include <absl/container/fixed_array.h>
+
+#include <geode/basic/attribute_manager.hpp>
+#include <geode/basic/variable_attribute.hpp>
+
+#include <geode/geometry/basic_objects/tetrahedron.hpp>
+#include <geode/geometry/quality.hpp>
+
+#include <geode/mesh/core/solid_mesh.hpp>
+#include <geode/mesh/core/surface_mesh.hpp>
+
+namespace
+{
+    constexpr geode::index_t CHUNK_SIZE{ 4096 };
+    constexpr auto NO_VALUE = std::numeric_limits< double >::quiet_NaN();
+
+    using WorstElements = std::vector< std::pair< geode::index_t, double > >;
+
+    struct ChunkStatistics
+    {
+        geode::index_t nb_values{ 0 };
+        geode::index_t nb_degenerate_values{ 0 };
+        double min{ std::numeric_limits< double >::max() };
+        double max{ std::numeric_limits< double >::lowest() };
+        double sum{ 0 };
+        WorstElements worst;
+    };
+
+    /*!
+     * Metrics return std::numeric_limits< double >::max() for degenerate
+     * elements, such values would overflow the mean and the histogram.
+     */
+    bool is_degenerate( double value )
+    {
+        return !std::isfinite( value )
+               || std::fabs( value ) == std::numeric_limits< double >::max();
+    }
+
+    template < typename Action >
+    void for_each_chunk( geode::index_t nb_values, const Action& action )
+    {
+        const auto nb_chunks = ( nb_values + CHUNK_SIZE - 1 ) / CHUNK_SIZE;
+        async::parallel_for( async::irange( geode::index_t{ 0 }, nb_chunks ),
+            [nb_values, &action]( geode::index_t chunk ) {
+                const auto begin = chunk * CHUNK_SIZE;
+                const auto end = std::min( begin + CHUNK_SIZE, nb_values );
+                action( chunk, begin, end );
+            } );
+    }
+
+    void keep_worst( WorstElements& worst,
+        geode::index_t nb_worst,
+        bool lower_is_worse )
+    {
+        const auto nb_kept = std::min< std::size_t >( nb_worst, worst.size() );
+        std::partial_sort( worst.begin(), worst.begin() + nb_kept, worst.end(),
+            [lower_is_worse]( const auto& lhs, const auto& rhs ) {
+                if( lhs.second == rhs.second )
+                {
+                    return lhs.first < rhs.first;
+                }
+                return lower_is_worse == ( lhs.second < rhs.second );
+            } );
+        worst.resize( nb_kept );
+    }
+
+    double polyhedron_quality( const geode::SolidMesh3D& mesh,
+        geode::index_t polyhedron,
+        geode::QUALITY_METRIC metric )
+    {
+        if( metric == geode::QUALITY_METRIC::size )
+        {
+            return mesh.polyhedron_volume( polyhedron );
+        }
+        if( mesh.nb_polyhedron_vertices( polyhedron ) != 4 )
+        {
+            return NO_VALUE;
+        }
+        const auto vertices = mesh.polyhedron_vertices( polyhedron );
+        const geode::Tetrahedron tetrahedron{ mesh.point( vertices[0] ),
+            mesh.point( vertices[1] ), mesh.point( vertices[2] ),
+            mesh.point( vertices[3] ) };
+        if( metric == geode::QUALITY_METRIC::aspect_ratio )
+        {
+            return geode::tetrahedron_aspect_ratio( tetrahedron );
+        }
+        if( metric == geode::QUALITY_METRIC::volume_to_edge_ratio )
+        {
+            return geode::tetrahedron_volume_to_edge_ratio( tetrahedron );
+        }
+        return geode::tetrahedron_collapse_aspect_ratio( tetrahedron );
+    }
+
+    void store_values( geode::AttributeManager& manager,
+        absl::Span< const double > values,
+        const geode::QualityReportParameters& parameters )
+    {
+        if( parameters.attribute_name.empty() )
+        {
+            return;
+        }
+        auto attribute = manager.find_or_create_attribute<
+            geode::VariableAttribute, double >(
+            parameters.attribute_name, NO_VALUE );
+        for_each_chunk( geode::checked_index( values.size() ),
+            [&attribute, &values]( geode::index_t /*unused*/,
+                geode::index_t begin, geode::index_t end ) {
+                for( const auto e : geode::Range{ begin, end } )
+                {
+                    attribute->set_value( e, values[e] );
+                }
+            } );
+    }
+} // namespace
+
+namespace geode
+{
+    bool is_lower_quality_worse( QUALITY_METRIC metric )
+    {
+        return metric == QUALITY_METRIC::size
+               || metric == QUALITY_METRIC::volume_to_edge_ratio;
+    }
+
+    MeshQualityReport quality_report( absl::Span< const double > values,
+        bool lower_is_worse,
+        const QualityReportParameters& parameters )
+    {
+        const auto nb_values = checked_index( values.size() );
+        const auto nb_chunks = ( nb_values + CHUNK_SIZE - 1 ) / CHUNK_SIZE;
+        absl::FixedArray< ChunkStatistics > chunks( nb_chunks );
+        for_each_chunk( nb_values,
+            [&values, &chunks, &parameters, lower_is_worse](
+                index_t chunk, index_t begin, index_t end ) {
+                auto& statistics = chunks[chunk];
+                for( const auto e : Range{ begin, end } )
+                {
+                    const auto value = values[e];
+                    if( std::isnan( value ) )
+                    {
+                        continue;
+                    }
+                    statistics.worst.emplace_back( e, value );
+                    if( is_degenerate( value ) )
+                    {
+                        statistics.nb_degenerate_values++;
+                        continue;
+                    }
+                    statistics.nb_values++;
+                    statistics.min = std::min( statistics.min, value );
+                    statistics.max = std::max( statistics.max, value );
+                    statistics.sum += value;
+                }
+                keep_worst( statistics.worst, parameters.nb_worst_elements,
+                    lower_is_worse );
+            } );
+        MeshQualityReport report;
+        ChunkStatistics total;
+        for( auto& chunk : chunks )
+        {
+            total.nb_values += chunk.nb_values;
+            total.nb_degenerate_values += chunk.nb_degenerate_values;
+            total.min = std::min( total.min, chunk.min );
+            total.max = std::max( total.max, chunk.max );
+            total.sum += chunk.sum;
+            total.worst.insert(
+                total.worst.end(), chunk.worst.begin(), chunk.worst.end() );
+        }
+        report.nb_elements = total.nb_values;
+        report.nb_degenerate_elements = total.nb_degenerate_values;
+        keep_worst( total.worst, parameters.nb_worst_elements, lower_is_worse );
+        report.worst_elements = std::move( total.worst );
+        if( total.nb_values == 0 )
+        {
+            return report;
+        }
+        report.min = total.min;
+        report.max = total.max;
+        report.mean = total.sum / total.nb_values;
+
+        const auto nb_bins =
+            std::max( parameters.nb_histogram_bins, index_t{ 1 } );
+        const auto bin_size = ( report.max - report.min ) / nb_bins;
+        absl::FixedArray< std::vector< index_t > > histograms(
+            nb_chunks, std::vector< index_t >( nb_bins, 0 ) );
+        for_each_chunk( nb_values,
+            [&values, &histograms, &report, nb_bins, bin_size](
+                index_t chunk, index_t begin, index_t end ) {
+                auto& histogram = histograms[chunk];
+                for( const auto e : Range{ begin, end } )
+                {
+                    const auto value = values[e];
+                    if( std::isnan( value ) || is_degenerate( value ) )
+                    {
+                        continue;
+                    }
+                    const auto bin =
+                        bin_size > 0 ? static_cast< index_t >(
+                            ( value - report.min ) / bin_size )
+                                     : 0;
+                    histogram[std::min( bin, nb_bins - 1 )]++;
+                }
+            } );
+        report.histogram.assign( nb_bins, 0 );
+        for( const auto& histogram : histograms )
+        {
+            for( const auto b : Range{ nb_bins } )
+            {
+                report.histogram[b] += histogram[b];
+            }
+        }
+
+        if( parameters.percentiles.empty() )
+        {
+            return report;
+        }
+        std::vector< double > sorted;
+        sorted.reserve( total.nb_values );
+        for( const auto value : values )
+        {
+            if( !std::isnan( value ) && !is_degenerate( value ) )
+            {
+                sorted.push_back( value );
+            }
+        }
+        auto percentiles = parameters.percentiles;
+        absl::c_sort( percentiles );
+        auto first = sorted.begin();
+        for( const auto percentile : percentiles )
+        {
+            const auto rank = static_cast< std::size_t >( std::round(
+                std::clamp( percentile, 0., 1. ) * ( sorted.size() - 1 ) ) );
+            const auto nth = sorted.begin() + rank;
+            std::nth_element( first, nth, sorted.end() );
+            report.percentiles.emplace_back( percentile, *nth );
+            first = nth;
+        }
+        return report;
+    }
+
+    std::vector< double > solid_quality_values(
+        const SolidMesh3D& mesh, QUALITY_METRIC metric )
+    {
+        std::vector< double > values( mesh.nb_polyhedra() );
+        for_each_chunk( mesh.nb_polyhedra(),
+            [&mesh, &values, metric](
+                index_t /*unused*/, index_t begin, index_t end ) {
+                for( const auto p : Range{ begin, end } )
+                {
+                    values[p] = polyhedron_quality( mesh, p, metric );
+                }
+            } );
+        return values;
+    }
+
+    template < index_t dimension >
+    std::vector< double > surface_quality_values(
+        const SurfaceMesh< dimension >& mesh, QUALITY_METRIC metric )
+    {
+        OPENGEODE_EXCEPTION( metric == QUALITY_METRIC::size,
+            "[surface_quality_values] Only size metric is available on "
+            "surfaces" );
+        std::vector< double > values( mesh.nb_polygons() );
+        for_each_chunk( mesh.nb_polygons(),
+            [&mesh, &values]( index_t /*unused*/, index_t begin, index_t end ) {
+                for( const auto p : Range{ begin, end } )
+                {
+                    values[p] = mesh.polygon_area( p );
+                }
+            } );
+        return values;
+    }
+
+    MeshQualityReport solid_quality_report( const SolidMesh3D& mesh,
+        QUALITY_METRIC metric,
+        const QualityReportParameters& parameters )
+    {
+        const auto values = solid_quality_values( mesh, metric );
+        store_values(
+            mesh.polyhedron_attribute_manager(), values, parameters );
+        return quality_report(
+            values, is_lower_quality_worse( metric ), parameters );
+    }
+
+    template < index_t dimension >
+    MeshQualityReport surface_quality_report(
+        const SurfaceMesh< dimension >& mesh,
+        QUALITY_METRIC metric,
+        const QualityReportParameters& parameters )
+    {
+        const auto values = surface_quality_values( mesh, metric );
+        store_values( mesh.polygon_attribute_manager(), values, parameters );
+        return quality_report(
+            values, is_lower_quality_worse( metric ), parameters );
+    }
+
+    template opengeode_mesh_api std::vector< double > surface_quality_values(
+        const SurfaceMesh2D&, QUALITY_METRIC );
+    template opengeode_mesh_api std::vector< double > surface_quality_values(
+        const SurfaceMesh3D&, QUALITY_METRIC );
+
+    template opengeode_mesh_api MeshQualityReport surface_quality_report(
+        const SurfaceMesh2D&, QUALITY_METRIC, const QualityReportParameters& );
+    template opengeode_mesh_api MeshQualityReport surface_quality_report(
+        const SurfaceMesh3D&, QUALITY_METRIC, const QualityReportParameters& );
+} // namespace geode
@@ -24,12 +24,17 @@
 #include <geode/mesh/helpers/rasterize.hpp>
 
 #include <array>
+#include <atomic>
 #include <queue>
 
 #include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
+
+#include <async++.h>
 
 #include <geode/basic/algorithm.hpp>
 #include <geode/basic/attribute_manager.hpp>
+#include <geode/basic/variable_attribute.hpp>
 #include <geode/geometry/barycentric_coordinates.hpp>
 #include <geode/geometry/basic_objects/infinite_line.hpp>
 #include <geode/geometry/basic_objects/plane.hpp>
@@ -46,6 +51,7 @@
 
 #include <geode/mesh/core/detail/vertex_cycle.hpp>
 #include <geode/mesh/core/grid.hpp>
+#include <geode/mesh/core/tetrahedral_solid.hpp>
 #include <geode/mesh/core/triangulated_surface.hpp>
 
 namespace
@@ -181,10 +187,10 @@ namespace
             i, deltas, increments, start, end );
     }
 
-    std::vector< CellIndices< 2 > > conservative_voxelization_triangle(
-        const geode::Grid2D& grid,
+    void conservative_voxelization_triangle( const geode::Grid2D& grid,
         const geode::Triangle2D& triangle,
-        const std::array< geode::Grid2D::CellsAroundVertex, 3 > vertex_cells )
+        const std::array< geode::Grid2D::CellsAroundVertex, 3 >& vertex_cells,
+        std::vector< CellIndices< 2 > >& cells )
     {
         geode_unused( vertex_cells );
         absl::flat_hash_map< geode::index_t,
@@ -207,7 +213,6 @@ namespace
                 }
             }
         }
-        std::vector< CellIndices< 2 > > cells;
         for( const auto& it : min_max )
         {
             for( const auto i :
@@ -216,7 +221,6 @@ namespace
                 cells.emplace_back( CellIndices< 2 >{ i, it.first } );
             }
         }
-        return cells;
     }
 
     std::array< std::pair< geode::Vector2D, double >, 3 > get_edge_projection(
@@ -291,10 +295,10 @@ namespace
         return nb_cells;
     }
 
-    std::vector< CellIndices< 3 > > conservative_voxelization_triangle(
-        const geode::Grid3D& grid,
+    void conservative_voxelization_triangle( const geode::Grid3D& grid,
         const geode::Triangle3D& triangle,
-        const std::array< geode::Grid3D::CellsAroundVertex, 3 > vertex_cells )
+        const std::array< geode::Grid3D::CellsAroundVertex, 3 >& vertex_cells,
+        std::vector< CellIndices< 3 > >& cells )
     {
         auto min = grid.cell_indices( grid.nb_cells() - 1 );
         auto max = grid.cell_indices( 0 );
@@ -309,8 +313,7 @@ namespace
                 }
             }
         }
-        std::vector< CellIndices< 3 > > cells;
-        cells.reserve( max_number_cells( min, max ) );
+        cells.reserve( cells.size() + max_number_cells( min, max ) );
         const geode::OwnerTriangle3D triangle_in_grid{
             grid.grid_coordinate_system().coordinates( triangle.vertices()[0] ),
             grid.grid_coordinate_system().coordinates( triangle.vertices()[1] ),
@@ -330,7 +333,7 @@ namespace
                 add_cells( cells,
                     geode::rasterize_segment( grid, triangle_edges[e] ) );
             }
-            return cells;
+            return;
         }
         const auto triangle_edges_in_grid =
             get_triangle_edges( triangle_in_grid );
@@ -437,8 +440,6 @@ namespace
                 }
             }
         }
-
-        return cells;
     }
 
     absl::InlinedVector< CellIndices< 3 >, 6 > neighbors(
@@ -465,11 +466,11 @@ namespace
         const std::array< geode::Grid3D::CellsAroundVertex, 2 > /*unused*/ )
     {
         auto cells = geode::rasterize_segment( grid, segment );
-        std::vector< bool > tested_cells( grid.nb_cells(), false );
+        absl::flat_hash_set< geode::index_t > tested_cells;
         std::queue< CellIndices< 3 > > to_test;
         for( const auto& cell : cells )
         {
-            tested_cells[grid.cell_index( cell )] = true;
+            tested_cells.insert( grid.cell_index( cell ) );
             for( auto&& neighbor : neighbors( grid, cell ) )
             {
                 to_test.emplace( std::move( neighbor ) );
@@ -487,12 +488,10 @@ namespace
         {
             const auto cell = to_test.front();
             to_test.pop();
-            const auto cell_id = grid.cell_index( cell );
-            if( tested_cells[cell_id] )
+            if( !tested_cells.insert( grid.cell_index( cell ) ).second )
             {
                 continue;
             }
-            tested_cells[cell_id] = true;
             const auto center = grid.cell_barycenter( cell );
             if( geode::point_segment_distance( center, segment )
                 <= half_cell_size )
@@ -984,20 +983,20 @@ namespace
         return values;
     }
 
-    Values paint_surface(
-        const geode::Grid3D& grid, const geode::Tetrahedron& tetrahedron )
+    void paint_surface( const geode::Grid3D& grid,
+        const geode::Tetrahedron& tetrahedron,
+        Values& values,
+        PaintedVertices& painted_vertices,
+        PaintedEdges& painted_edges )
     {
-        Values values;
-        PaintedVertices painted_vertices;
-        PaintedEdges painted_edges;
         const auto& origin = grid.grid_coordinate_system().origin();
-        absl::FixedArray< geode::Point3D > points( 4 );
+        std::array< geode::Point3D, 4 > points;
         const auto& vertices = tetrahedron.vertices();
-        for( const auto v : geode::Range{ 4 } )
+        for( const auto v : geode::LRange{ 4 } )
         {
             points[v] = vertices[v].get() - origin;
         }
-        for( const auto f : geode::Range{ 4 } )
+        for( const auto f : geode::LRange{ 4 } )
         {
             const auto& vertices_order =
                 tetrahedron.tetrahedron_facet_vertex[f];
@@ -1005,38 +1004,212 @@ namespace
                 painted_vertices, painted_edges };
             painter.paint();
         }
+    }
+
+    Values paint_surface(
+        const geode::Grid3D& grid, const geode::Tetrahedron& tetrahedron )
+    {
+        Values values;
+        PaintedVertices painted_vertices;
+        PaintedEdges painted_edges;
+        paint_surface(
+            grid, tetrahedron, values, painted_vertices, painted_edges );
         return values;
     }
 
+    void paint_column( Values::value_type& column,
+        std::vector< typename geode::Grid3D::CellIndices >& cells )
+    {
+        const auto j = column.first.first;
+        const auto k = column.first.second;
+        auto& i_values = column.second;
+        absl::c_sort( i_values );
+        OPENGEODE_EXCEPTION( i_values.size() % 2 == 0,
+            "[rasterize_closed_surface] Wrong "
+            "number of intervals to paint" );
+        bool paint{ true };
+        for( geode::index_t it = 0; it < i_values.size();
+            it += 2, paint = !paint )
+        {
+            if( !paint )
+            {
+                continue;
+            }
+            for( const auto i : geode::Range{
+                     i_values[it].ids[0], i_values[it + 1].ids[1] + 1 } )
+            {
+                cells.emplace_back( geode::Grid3D::CellIndices{ i, j, k } );
+            }
+        }
+    }
+
     std::vector< typename geode::Grid3D::CellIndices > paint_interior(
         Values& values )
     {
-        std::vector< geode::Grid3D::CellIndices > cells;
+        std::vector< Values::pointer > columns;
+        columns.reserve( values.size() );
         for( auto& value : values )
         {
-            const auto j = value.first.first;
-            const auto k = value.first.second;
-            auto& i_values = value.second;
-            absl::c_sort( i_values );
-            OPENGEODE_EXCEPTION( i_values.size() % 2 == 0,
-                "[rasterize_closed_surface] Wrong "
-                "number of intervals to paint" );
-            bool paint{ true };
-            for( geode::index_t it = 0; it < i_values.size();
-                it += 2, paint = !paint )
+            columns.push_back( &value );
+        }
+        absl::FixedArray< std::vector< geode::Grid3D::CellIndices > >
+            column_cells( columns.size() );
+        async::parallel_for( async::irange( size_t{ 0 }, columns.size() ),
+            [&columns, &column_cells]( size_t column ) {
+                paint_column( *columns[column], column_cells[column] );
+            } );
+        std::vector< geode::Grid3D::CellIndices > cells;
+        for( auto& cells_in_column : column_cells )
+        {
+            cells.insert(
+                cells.end(), cells_in_column.begin(), cells_in_column.end() );
+        }
+        return cells;
+    }
+
+    template < geode::index_t dimension >
+    void conservative_rasterize_triangle_cells(
+        const geode::Grid< dimension >& grid,
+        const geode::Triangle< dimension >& triangle,
+        std::vector< CellIndices< dimension > >& cells )
+    {
+        std::array< typename geode::Grid< dimension >::CellsAroundVertex, 3 >
+            vertex_cells;
+        const auto& vertices = triangle.vertices();
+        for( const auto v : geode::LRange{ 3 } )
+        {
+            vertex_cells[v] = grid.cells( vertices[v].get() );
+            OPENGEODE_EXCEPTION( !vertex_cells[v].empty(),
+                "[conservative_rasterize_triangle] Triangle is not included in "
+                "the given Grid" );
+        }
+        if( vertex_cells[0] == vertex_cells[1]
+            && vertex_cells[1] == vertex_cells[2] )
+        {
+            cells.insert(
+                cells.end(), vertex_cells[0].begin(), vertex_cells[0].end() );
+            return;
+        }
+        conservative_voxelization_triangle(
+            grid, triangle, vertex_cells, cells );
+    }
+
+    /*!
+     * Bit per grid cell, safe to set concurrently.
+     */
+    class AtomicCellMask
+    {
+        static constexpr geode::index_t WORD_SIZE{ 64 };
+
+    public:
+        explicit AtomicCellMask( geode::index_t nb_cells )
+            : words_( ( nb_cells + WORD_SIZE - 1 ) / WORD_SIZE )
+        {
+        }
+
+        void set( geode::index_t cell_id )
+        {
+            words_[cell_id / WORD_SIZE].fetch_or(
+                std::uint64_t{ 1 } << ( cell_id % WORD_SIZE ),
+                std::memory_order_relaxed );
+        }
+
+        template < geode::index_t dimension >
+        std::vector< CellIndices< dimension > > cells(
+            const geode::Grid< dimension >& grid ) const
+        {
+            std::vector< CellIndices< dimension > > result;
+            for( const auto w : geode::Indices{ words_ } )
             {
-                if( !paint )
+                const auto word = words_[w].load( std::memory_order_relaxed );
+                if( word == 0 )
                 {
                     continue;
                 }
-                for( const auto i : geode::Range{
-                         i_values[it].ids[0], i_values[it + 1].ids[1] + 1 } )
+                for( const auto bit : geode::Range{ WORD_SIZE } )
                 {
-                    cells.emplace_back( geode::Grid3D::CellIndices{ i, j, k } );
+                    if( ( word >> bit ) & 1 )
+                    {
+                        result.push_back(
+                            grid.cell_indices( w * WORD_SIZE + bit ) );
+                    }
                 }
             }
+            return result;
         }
-        return cells;
+
+    private:
+        std::vector< std::atomic< std::uint64_t > > words_;
+    };
+
+    /*!
+     * Fill the cells covered by tetrahedra, one tetrahedron at a time.
+     * The painting buffers are reused from one tetrahedron to the next.
+     */
+    class TetrahedronFiller
+    {
+    public:
+        TetrahedronFiller( const geode::Grid3D& grid,
+            const geode::TetrahedralSolid3D& solid )
+            : grid_( grid ), solid_( solid )
+        {
+        }
+
+        void operator()( geode::index_t tetrahedron_id,
+            std::vector< geode::Grid3D::CellIndices >& cells )
+        {
+            values_.clear();
+            painted_vertices_.clear();
+            painted_edges_.clear();
+            paint_surface( grid_, solid_.tetrahedron( tetrahedron_id ),
+                values_, painted_vertices_, painted_edges_ );
+            for( auto& column : values_ )
+            {
+                paint_column( column, cells );
+            }
+        }
+
+    private:
+        const geode::Grid3D& grid_;
+        const geode::TetrahedralSolid3D& solid_;
+        Values values_;
+        PaintedVertices painted_vertices_;
+        PaintedEdges painted_edges_;
+    };
+
+    /*!
+     * Rasterize elements in parallel. Elements are processed by chunks,
+     * each chunk reusing the same scratch buffer for its elements.
+     * @param[in] rasterizer Function called as rasterize( element, cells ) to
+     * append the cells of the element to cells. It is copied once per chunk,
+     * so it may hold its own scratch buffers.
+     * @param[in] paint Function called as paint( element, cell_id ) for each
+     * rasterized cell.
+     */
+    template < geode::index_t dimension, typename Rasterizer, typename Painter >
+    void rasterize_in_parallel( const geode::Grid< dimension >& grid,
+        geode::index_t nb_elements,
+        const Rasterizer& rasterizer,
+        const Painter& paint )
+    {
+        static constexpr geode::index_t CHUNK_SIZE{ 256 };
+        const auto nb_chunks = ( nb_elements + CHUNK_SIZE - 1 ) / CHUNK_SIZE;
+        async::parallel_for( async::irange( geode::index_t{ 0 }, nb_chunks ),
+            [&grid, nb_elements, &rasterizer, &paint]( geode::index_t chunk ) {
+                auto rasterize = rasterizer;
+                std::vector< CellIndices< dimension > > cells;
+                const auto begin = chunk * CHUNK_SIZE;
+                const auto end = std::min( begin + CHUNK_SIZE, nb_elements );
+                for( const auto element : geode::Range{ begin, end } )
+                {
+                    cells.clear();
+                    rasterize( element, cells );
+                    for( const auto& cell : cells )
+                    {
+                        paint( element, grid.cell_index( cell ) );
+                    }
+                }
+            } );
     }
 
 } // namespace
@@ -1097,23 +1270,65 @@ namespace geode
     std::vector< CellIndices< dimension > > conservative_rasterize_triangle(
         const Grid< dimension >& grid, const Triangle< dimension >& triangle )
     {
-        std::array< typename Grid< dimension >::CellsAroundVertex, 3 >
-            vertex_cells;
-        const auto& vertices = triangle.vertices();
-        for( const auto v : LRange{ 3 } )
-        {
-            vertex_cells[v] = grid.cells( vertices[v].get() );
-            OPENGEODE_EXCEPTION( !vertex_cells[v].empty(),
-                "[conservative_rasterize_triangle] Triangle is not included in "
-                "the given Grid" );
-        }
-        if( vertex_cells[0] == vertex_cells[1]
-            && vertex_cells[1] == vertex_cells[2] )
-        {
-            return { vertex_cells[0].begin(), vertex_cells[0].end() };
-        }
-        return conservative_voxelization_triangle(
-            grid, triangle, vertex_cells );
+        std::vector< CellIndices< dimension > > cells;
+        conservative_rasterize_triangle_cells( grid, triangle, cells );
+        return cells;
+    }
+
+    template < index_t dimension >
+    std::vector< CellIndices< dimension > > conservative_rasterize_surface(
+        const Grid< dimension >& grid,
+        const TriangulatedSurface< dimension >& surface )
+    {
+        AtomicCellMask mask{ grid.nb_cells() };
+        rasterize_in_parallel( grid, surface.nb_polygons(),
+            [&grid, &surface]( index_t triangle_id,
+                std::vector< CellIndices< dimension > >& cells ) {
+                conservative_rasterize_triangle_cells(
+                    grid, surface.triangle( triangle_id ), cells );
+            },
+            [&mask]( index_t /*unused*/, index_t cell_id ) {
+                mask.set( cell_id );
+            } );
+        return mask.cells( grid );
+    }
+
+    template < index_t dimension >
+    std::shared_ptr< VariableAttribute< index_t > >
+        conservative_rasterize_surface_owners( const Grid< dimension >& grid,
+            const TriangulatedSurface< dimension >& surface,
+            std::string_view attribute_name )
+    {
+        std::vector< std::atomic< index_t > > owners( grid.nb_cells() );
+        async::parallel_for( async::irange( index_t{ 0 }, grid.nb_cells() ),
+            [&owners]( index_t cell_id ) {
+                owners[cell_id].store( NO_ID, std::memory_order_relaxed );
+            } );
+        rasterize_in_parallel( grid, surface.nb_polygons(),
+            [&grid, &surface]( index_t triangle_id,
+                std::vector< CellIndices< dimension > >& cells ) {
+                conservative_rasterize_triangle_cells(
+                    grid, surface.triangle( triangle_id ), cells );
+            },
+            [&owners]( index_t triangle_id, index_t cell_id ) {
+                auto& owner = owners[cell_id];
+                auto current = owner.load( std::memory_order_relaxed );
+                while( triangle_id < current
+                       && !owner.compare_exchange_weak(
+                           current, triangle_id, std::memory_order_relaxed ) )
+                {
+                }
+            } );
+        auto attribute =
+            grid.cell_attribute_manager()
+                .template find_or_create_attribute< VariableAttribute,
+                    index_t >( attribute_name, NO_ID );
+        async::parallel_for( async::irange( index_t{ 0 }, grid.nb_cells() ),
+            [&owners, &attribute]( index_t cell_id ) {
+                attribute->set_value( cell_id,
+                    owners[cell_id].load( std::memory_order_relaxed ) );
+            } );
+        return attribute;
     }
 
     std::vector< typename Grid3D::CellIndices > rasterize_tetrahedron(
@@ -1131,6 +1346,18 @@ namespace geode
         return paint_interior( values );
     }
 
+    std::vector< Grid3D::CellIndices > rasterize_solid(
+        const Grid3D& grid, const TetrahedralSolid3D& solid )
+    {
+        AtomicCellMask mask{ grid.nb_cells() };
+        rasterize_in_parallel( grid, solid.nb_polyhedra(),
+            TetrahedronFiller{ grid, solid },
+            [&mask]( index_t /*unused*/, index_t cell_id ) {
+                mask.set( cell_id );
+            } );
+        return mask.cells( grid );
+    }
+
     template std::vector< CellIndices< 2 > > opengeode_mesh_api
         rasterize_segment< 2 >( const Grid2D&, const Segment2D& );
 
@@ -1150,4 +1377,20 @@ namespace geode
     template std::vector< CellIndices< 3 > >
         opengeode_mesh_api conservative_rasterize_triangle< 3 >(
             const Grid3D&, const Triangle3D& );
+
+    template std::vector< CellIndices< 2 > >
+        opengeode_mesh_api conservative_rasterize_surface< 2 >(
+            const Grid2D&, const TriangulatedSurface2D& );
+
+    template std::vector< CellIndices< 3 > >
+        opengeode_mesh_api conservative_rasterize_surface< 3 >(
+            const Grid3D&, const TriangulatedSurface3D& );
+
+    template std::shared_ptr< VariableAttribute< index_t > >
+        opengeode_mesh_api conservative_rasterize_surface_owners< 2 >(
+            const Grid2D&, const TriangulatedSurface2D&, std::string_view );
+
+    template std::shared_ptr< VariableAttribute< index_t > >
+        opengeode_mesh_api conservative_rasterize_surface_owners< 3 >(
+            const Grid3D&, const TriangulatedSurface3D&, std::string_view );
 } // namespace geode
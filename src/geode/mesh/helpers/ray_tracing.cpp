@@ -206,7 +206,7 @@ namespace geode
             sort_results();
             std::optional< absl::FixedArray< RayTracing3D::PolygonDistance > >
                 closest_polygons{ std::min(
-                    size, static_cast< index_t >( results_.size() ) ) };
+                    size, checked_index( results_.size() ) ) };
             for( const auto i : Indices{ closest_polygons.value() } )
             {
                 closest_polygons->at( i ) = results_[i];
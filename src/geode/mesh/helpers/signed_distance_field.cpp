@@ -0,0 +1,397 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/mesh/helpers/signed_distance_field.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <async++.h>
+
+#include <absl/algorithm/container.h>
+#include <absl/container/fixed_array.h>
+#include <absl/container/inlined_vector.h>
+
+#include <geode/basic/attribute_manager.hpp>
+#include <geode/basic/logger.hpp>
+
+#include <geode/geometry/aabb.hpp>
+#include <geode/geometry/basic_objects/triangle.hpp>
+#include <geode/geometry/batch_distance.hpp>
+#include <geode/geometry/distance.hpp>
+#include <geode/geometry/point.hpp>
+#include <geode/geometry/vector.hpp>
+
+#include <geode/mesh/core/grid.hpp>
+#include <geode/mesh/core/triangulated_surface.hpp>
+#include <geode/mesh/helpers/aabb_surface_helpers.hpp>
+#include <geode/mesh/helpers/rasterize.hpp>
+
+namespace
+{
+    /*!
+     * Number of grid cells processed by a task of the jump flooding passes.
+     */
+    constexpr geode::index_t CELL_CHUNK_SIZE{ 1024 };
+
+    class SignedDistanceField
+    {
+        using Index = geode::Grid3D::CellIndices;
+
+    public:
+        SignedDistanceField( const geode::Grid3D& grid,
+            const geode::TriangulatedSurface3D& closed_surface )
+            : grid_( grid ),
+              surface_( closed_surface ),
+              on_surface_( grid.nb_cells(), false ),
+              in_band_( grid.nb_cells(), false ),
+              closest_triangles_( grid.nb_cells(), geode::NO_ID ),
+              distances_(
+                  grid.nb_cells(), std::numeric_limits< double >::max() )
+        {
+        }
+
+        void compute_narrow_band( geode::index_t narrow_band_width )
+        {
+            for( const auto& cell :
+                geode::conservative_rasterize_surface( grid_, surface_ ) )
+            {
+                const auto cell_id = grid_.cell_index( cell );
+                on_surface_[cell_id] = true;
+                in_band_[cell_id] = true;
+            }
+            for( const auto d : geode::LRange{ 3 } )
+            {
+                dilate_narrow_band( d, narrow_band_width );
+            }
+            const auto tree = geode::create_aabb_tree( surface_ );
+            const geode::DistanceToTriangle3D distance_action{ surface_ };
+            async::parallel_for(
+                async::irange( geode::index_t{ 0 }, grid_.nb_cells() ),
+                [this, &tree, &distance_action]( geode::index_t cell ) {
+                    if( !in_band_[cell] )
+                    {
+                        return;
+                    }
+                    const auto center =
+                        grid_.cell_barycenter( grid_.cell_indices( cell ) );
+                    std::tie( closest_triangles_[cell], distances_[cell] ) =
+                        tree.closest_element_box( center, distance_action );
+                } );
+        }
+
+        void propagate()
+        {
+            geode::index_t max_nb_cells{ 0 };
+            for( const auto d : geode::LRange{ 3 } )
+            {
+                max_nb_cells =
+                    std::max( max_nb_cells, grid_.nb_cells_in_direction( d ) );
+            }
+            geode::index_t step{ 1 };
+            while( 2 * step < max_nb_cells )
+            {
+                step *= 2;
+            }
+            auto next_closest_triangles = closest_triangles_;
+            auto next_distances = distances_;
+            for( ; step > 0; step /= 2 )
+            {
+                jump_flooding_pass(
+                    step, next_closest_triangles, next_distances );
+            }
+            jump_flooding_pass( 1, next_closest_triangles, next_distances );
+        }
+
+        std::shared_ptr< geode::VariableAttribute< double > > signed_distances(
+            std::string_view distance_map_name )
+        {
+            absl::FixedArray< bool > inside( grid_.nb_cells(), false );
+            for( const auto& cell :
+                geode::rasterize_closed_surface( grid_, surface_ ) )
+            {
+                inside[grid_.cell_index( cell )] = true;
+            }
+            auto distance_map =
+                grid_.cell_attribute_manager()
+                    .find_or_create_attribute< geode::VariableAttribute,
+                        double >( distance_map_name,
+                        std::numeric_limits< double >::max() );
+            async::parallel_for(
+                async::irange( geode::index_t{ 0 }, grid_.nb_cells() ),
+                [this, &inside, &distance_map]( geode::index_t cell ) {
+                    const auto is_inside =
+                        on_surface_[cell]
+                            ? is_inside_surface_cell( cell, inside[cell] )
+                            : inside[cell];
+                    const auto distance = distances_[cell];
+                    distance_map->set_value(
+                        cell, is_inside ? -distance : distance );
+                } );
+            return distance_map;
+        }
+
+    private:
+        /*!
+         * Cells crossed by the surface are all painted by the conservative
+         * rasterize_closed_surface, their side is given by the normal of
+         * their closest triangle instead.
+         */
+        bool is_inside_surface_cell(
+            geode::index_t cell, bool rasterized_inside ) const
+        {
+            const auto triangle =
+                surface_.triangle( closest_triangles_[cell] );
+            const auto normal = triangle.normal();
+            if( !normal )
+            {
+                return rasterized_inside;
+            }
+            const auto center =
+                grid_.cell_barycenter( grid_.cell_indices( cell ) );
+            const auto closest_point = std::get< 1 >(
+                geode::point_triangle_distance( center, triangle ) );
+            return geode::Vector3D{ closest_point, center }.dot(
+                       normal.value() )
+                   < 0;
+        }
+
+        geode::index_t nb_lines( geode::index_t direction ) const
+        {
+            return grid_.nb_cells() / grid_.nb_cells_in_direction( direction );
+        }
+
+        Index line_origin( geode::index_t line, geode::index_t direction ) const
+        {
+            Index index;
+            index[direction] = 0;
+            for( const auto d : geode::LRange{ 3 } )
+            {
+                if( d == direction )
+                {
+                    continue;
+                }
+                const auto nb_cells = grid_.nb_cells_in_direction( d );
+                index[d] = line % nb_cells;
+                line /= nb_cells;
+            }
+            return index;
+        }
+
+        void dilate_narrow_band(
+            geode::index_t direction, geode::index_t narrow_band_width )
+        {
+            if( narrow_band_width == 0 )
+            {
+                return;
+            }
+            async::parallel_for(
+                async::irange( geode::index_t{ 0 }, nb_lines( direction ) ),
+                [this, direction, narrow_band_width]( geode::index_t line ) {
+                    const auto nb_cells =
+                        grid_.nb_cells_in_direction( direction );
+                    auto index = line_origin( line, direction );
+                    absl::FixedArray< geode::index_t > cells( nb_cells );
+                    absl::FixedArray< geode::index_t > gaps(
+                        nb_cells, geode::NO_ID );
+                    geode::index_t gap{ geode::NO_ID };
+                    for( const auto c : geode::Range{ nb_cells } )
+                    {
+                        index[direction] = c;
+                        cells[c] = grid_.cell_index( index );
+                        gap = in_band_[cells[c]]
+                                  ? 0
+                                  : ( gap == geode::NO_ID ? gap : gap + 1 );
+                        gaps[c] = gap;
+                    }
+                    gap = geode::NO_ID;
+                    for( const auto c : geode::ReverseRange{ nb_cells } )
+                    {
+                        gap = in_band_[cells[c]]
+                                  ? 0
+                                  : ( gap == geode::NO_ID ? gap : gap + 1 );
+                        gaps[c] = std::min( gaps[c], gap );
+                    }
+                    for( const auto c : geode::Range{ nb_cells } )
+                    {
+                        if( gaps[c] <= narrow_band_width )
+                        {
+                            in_band_[cells[c]] = true;
+                        }
+                    }
+                } );
+        }
+
+        void jump_flooding_pass( geode::index_t step,
+            std::vector< geode::index_t >& next_closest_triangles,
+            std::vector< double >& next_distances )
+        {
+            const auto nb_cells = grid_.nb_cells();
+            const auto nb_chunks =
+                ( nb_cells + CELL_CHUNK_SIZE - 1 ) / CELL_CHUNK_SIZE;
+            async::parallel_for(
+                async::irange( geode::index_t{ 0 }, nb_chunks ),
+                [this, step, nb_cells, &next_closest_triangles,
+                    &next_distances]( geode::index_t chunk ) {
+                    const auto begin = chunk * CELL_CHUNK_SIZE;
+                    const auto end =
+                        std::min( begin + CELL_CHUNK_SIZE, nb_cells );
+                    Candidates candidates;
+                    for( const auto cell : geode::Range{ begin, end } )
+                    {
+                        if( in_band_[cell] )
+                        {
+                            continue;
+                        }
+                        jump_flooding_cell( cell, step, candidates,
+                            next_closest_triangles, next_distances );
+                    }
+                } );
+            closest_triangles_.swap( next_closest_triangles );
+            distances_.swap( next_distances );
+        }
+
+        /*!
+         * Buffers reused by all the cells of a chunk to avoid allocating
+         * them for each cell.
+         */
+        struct Candidates
+        {
+            void clear()
+            {
+                triangles.clear();
+                batch.clear();
+            }
+
+            absl::InlinedVector< geode::index_t, 26 > triangles;
+            geode::TriangleBatch3D batch;
+            std::vector< double > squared_distances;
+        };
+
+        void jump_flooding_cell( geode::index_t cell,
+            geode::index_t step,
+            Candidates& candidates,
+            std::vector< geode::index_t >& next_closest_triangles,
+            std::vector< double >& next_distances ) const
+        {
+            const auto index = grid_.cell_indices( cell );
+            const auto center = grid_.cell_barycenter( index );
+            auto closest_triangle = closest_triangles_[cell];
+            auto distance = distances_[cell];
+            candidates.clear();
+            for_each_jump_neighbor( index, step,
+                [this, &closest_triangle, &candidates](
+                    geode::index_t neighbor ) {
+                    const auto triangle = closest_triangles_[neighbor];
+                    if( triangle == geode::NO_ID
+                        || triangle == closest_triangle
+                        || absl::c_contains( candidates.triangles, triangle ) )
+                    {
+                        return;
+                    }
+                    candidates.triangles.push_back( triangle );
+                } );
+            for( const auto triangle : candidates.triangles )
+            {
+                candidates.batch.add_triangle( surface_.triangle( triangle ) );
+            }
+            candidates.squared_distances.resize( candidates.triangles.size() );
+            geode::point_triangles_squared_distances( center, candidates.batch,
+                absl::MakeSpan( candidates.squared_distances ) );
+            auto squared_distance = distance * distance;
+            for( const auto c : geode::Indices{ candidates.triangles } )
+            {
+                if( candidates.squared_distances[c] < squared_distance )
+                {
+                    squared_distance = candidates.squared_distances[c];
+                    closest_triangle = candidates.triangles[c];
+                    distance = std::sqrt( squared_distance );
+                }
+            }
+            next_closest_triangles[cell] = closest_triangle;
+            next_distances[cell] = distance;
+        }
+
+        template < typename Action >
+        void for_each_jump_neighbor(
+            const Index& index, geode::index_t step, Action&& action ) const
+        {
+            std::array< std::array< geode::index_t, 3 >, 3 > coordinates;
+            std::array< geode::local_index_t, 3 > nb_coordinates;
+            for( const auto d : geode::LRange{ 3 } )
+            {
+                nb_coordinates[d] = 0;
+                if( index[d] >= step )
+                {
+                    coordinates[d][nb_coordinates[d]++] = index[d] - step;
+                }
+                coordinates[d][nb_coordinates[d]++] = index[d];
+                if( index[d] + step < grid_.nb_cells_in_direction( d ) )
+                {
+                    coordinates[d][nb_coordinates[d]++] = index[d] + step;
+                }
+            }
+            for( const auto i : geode::LRange{ nb_coordinates[0] } )
+            {
+                for( const auto j : geode::LRange{ nb_coordinates[1] } )
+                {
+                    for( const auto k : geode::LRange{ nb_coordinates[2] } )
+                    {
+                        const Index neighbor{ coordinates[0][i],
+                            coordinates[1][j], coordinates[2][k] };
+                        if( neighbor != index )
+                        {
+                            action( grid_.cell_index( neighbor ) );
+                        }
+                    }
+                }
+            }
+        }
+
+    private:
+        const geode::Grid3D& grid_;
+        const geode::TriangulatedSurface3D& surface_;
+        absl::FixedArray< bool > on_surface_;
+        absl::FixedArray< bool > in_band_;
+        std::vector< geode::index_t > closest_triangles_;
+        std::vector< double > distances_;
+    };
+} // namespace
+
+namespace geode
+{
+    std::shared_ptr< VariableAttribute< double > > signed_distance_field(
+        const Grid3D& grid,
+        const TriangulatedSurface3D& closed_surface,
+        std::string_view distance_map_name,
+        index_t narrow_band_width )
+    {
+        OPENGEODE_EXCEPTION( closed_surface.nb_polygons() != 0,
+            "[signed_distance_field] Surface should not be empty" );
+        SignedDistanceField sdf{ grid, closed_surface };
+        sdf.compute_narrow_band( narrow_band_width );
+        sdf.propagate();
+        return sdf.signed_distances( distance_map_name );
+    }
+} // namespace geode
@@ -0,0 +1,426 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/mesh/helpers/texture_sampler.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include <async++.h>
+
+#include <geode/basic/pimpl_impl.hpp>
+#include <geode/basic/range.hpp>
+
+#include <geode/geometry/point.hpp>
+
+#include <geode/image/core/raster_image.hpp>
+#include <geode/image/core/rgb_color.hpp>
+#include <geode/image/core/tiled_raster_image.hpp>
+
+#include <geode/mesh/core/solid_mesh.hpp>
+#include <geode/mesh/core/surface_mesh.hpp>
+#include <geode/mesh/core/texture2d.hpp>
+#include <geode/mesh/core/texture3d.hpp>
+
+namespace
+{
+    constexpr geode::index_t NB_CHANNELS{ 3 };
+
+    template < geode::index_t dimension >
+    using ImageCellIndices = std::array< geode::index_t, dimension >;
+
+    /*!
+     * Cells and weights to blend for sampling at a texture coordinate.
+     * Only cells with a non null weight are kept.
+     */
+    template < geode::index_t dimension >
+    struct SamplingStencil
+    {
+        static constexpr geode::index_t MAX_NB_CELLS{ 1u << dimension };
+
+        std::array< ImageCellIndices< dimension >, MAX_NB_CELLS > cells;
+        std::array< double, MAX_NB_CELLS > weights;
+        geode::index_t nb_cells{ 0 };
+    };
+
+    geode::index_t clamped_cell( double position, geode::index_t nb_cells )
+    {
+        if( !( position > 0 ) )
+        {
+            return 0;
+        }
+        const auto last = nb_cells - 1;
+        if( position >= last )
+        {
+            return last;
+        }
+        return static_cast< geode::index_t >( position );
+    }
+
+    geode::local_index_t channel_value( double value )
+    {
+        return static_cast< geode::local_index_t >(
+            std::clamp( std::round( value ), 0., 255. ) );
+    }
+
+    template < geode::index_t dimension >
+    ImageCellIndices< dimension > nearest_cell(
+        const geode::Point< dimension >& coordinates,
+        const ImageCellIndices< dimension >& nb_cells )
+    {
+        ImageCellIndices< dimension > cell;
+        for( const auto d : geode::LRange{ dimension } )
+        {
+            cell[d] = clamped_cell(
+                std::floor( coordinates.value( d ) * nb_cells[d] ),
+                nb_cells[d] );
+        }
+        return cell;
+    }
+
+    template < geode::index_t dimension >
+    SamplingStencil< dimension > linear_stencil(
+        const geode::Point< dimension >& coordinates,
+        const ImageCellIndices< dimension >& nb_cells )
+    {
+        std::array< std::array< geode::index_t, 2 >, dimension > bounds;
+        std::array< double, dimension > fractions;
+        for( const auto d : geode::LRange{ dimension } )
+        {
+            const auto position = coordinates.value( d ) * nb_cells[d] - 0.5;
+            const auto lower = std::floor( position );
+            fractions[d] = position - lower;
+            bounds[d][0] = clamped_cell( lower, nb_cells[d] );
+            bounds[d][1] = clamped_cell( lower + 1, nb_cells[d] );
+        }
+        SamplingStencil< dimension > stencil;
+        for( const auto corner :
+            geode::Range{ SamplingStencil< dimension >::MAX_NB_CELLS } )
+        {
+            double weight{ 1 };
+            auto& cell = stencil.cells[stencil.nb_cells];
+            for( const auto d : geode::LRange{ dimension } )
+            {
+                const auto upper = ( corner >> d ) & 1;
+                weight *= upper ? fractions[d] : 1. - fractions[d];
+                cell[d] = bounds[d][upper];
+            }
+            if( weight != 0 )
+            {
+                stencil.weights[stencil.nb_cells++] = weight;
+            }
+        }
+        return stencil;
+    }
+
+    template < geode::index_t dimension >
+    geode::RGBColor blend( const SamplingStencil< dimension >& stencil,
+        absl::Span< const geode::RGBColor > colors )
+    {
+        std::array< double, NB_CHANNELS > channels{ 0, 0, 0 };
+        for( const auto c : geode::Range{ stencil.nb_cells } )
+        {
+            const auto weight = stencil.weights[c];
+            channels[0] += weight * colors[c].red();
+            channels[1] += weight * colors[c].green();
+            channels[2] += weight * colors[c].blue();
+        }
+        return { channel_value( channels[0] ), channel_value( channels[1] ),
+            channel_value( channels[2] ) };
+    }
+
+    template < typename Sampler, typename CoordinatesGetter >
+    std::vector< geode::RGBColor > sample_all( const Sampler& sampler,
+        size_t nb_samples,
+        geode::TEXTURE_FILTER filter,
+        const CoordinatesGetter& coordinates )
+    {
+        std::vector< geode::RGBColor > colors( nb_samples );
+        async::parallel_for( async::irange( size_t{ 0 }, nb_samples ),
+            [&sampler, filter, &coordinates, &colors]( size_t s ) {
+                colors[s] = sampler.sample( coordinates( s ), filter );
+            } );
+        return colors;
+    }
+} // namespace
+
+namespace geode
+{
+    template < index_t dimension >
+    class TextureSampler< dimension >::Impl
+    {
+    public:
+        Impl( const RasterImage< dimension >& image,
+            TEXTURE_CHANNEL_LAYOUT layout )
+            : layout_( layout ), values_( NB_CHANNELS * image.nb_cells() )
+        {
+            index_t stride{ 1 };
+            for( const auto d : LRange{ dimension } )
+            {
+                nb_cells_[d] = image.nb_cells_in_direction( d );
+                OPENGEODE_EXCEPTION( nb_cells_[d] != 0,
+                    "[TextureSampler] Cannot sample an empty image" );
+                cell_strides_[d] = stride;
+                stride *= nb_cells_[d];
+            }
+            const auto nb_cells = image.nb_cells();
+            if( layout_ == TEXTURE_CHANNEL_LAYOUT::interleaved )
+            {
+                cell_stride_ = NB_CHANNELS;
+                channel_stride_ = 1;
+            }
+            else
+            {
+                cell_stride_ = 1;
+                channel_stride_ = nb_cells;
+            }
+            async::parallel_for( async::irange( index_t{ 0 }, nb_cells ),
+                [this, &image]( index_t cell ) {
+                    const auto& color = image.color( cell );
+                    const auto base = cell * cell_stride_;
+                    values_[base] = color.red();
+                    values_[base + channel_stride_] = color.green();
+                    values_[base + 2 * channel_stride_] = color.blue();
+                } );
+        }
+
+        TEXTURE_CHANNEL_LAYOUT channel_layout() const
+        {
+            return layout_;
+        }
+
+        RGBColor sample(
+            const Point< dimension >& coordinates, TEXTURE_FILTER filter ) const
+        {
+            if( filter == TEXTURE_FILTER::nearest )
+            {
+                return cell_color(
+                    nearest_cell< dimension >( coordinates, nb_cells_ ) );
+            }
+            const auto stencil =
+                linear_stencil< dimension >( coordinates, nb_cells_ );
+            std::array< RGBColor, SamplingStencil< dimension >::MAX_NB_CELLS >
+                colors;
+            for( const auto c : Range{ stencil.nb_cells } )
+            {
+                colors[c] = cell_color( stencil.cells[c] );
+            }
+            return blend( stencil, colors );
+        }
+
+    private:
+        RGBColor cell_color( const ImageCellIndices< dimension >& cell ) const
+        {
+            index_t index{ 0 };
+            for( const auto d : LRange{ dimension } )
+            {
+                index += cell[d] * cell_strides_[d];
+            }
+            const auto base = index * cell_stride_;
+            return { values_[base], values_[base + channel_stride_],
+                values_[base + 2 * channel_stride_] };
+        }
+
+    private:
+        TEXTURE_CHANNEL_LAYOUT layout_;
+        ImageCellIndices< dimension > nb_cells_;
+        ImageCellIndices< dimension > cell_strides_;
+        index_t cell_stride_;
+        index_t channel_stride_;
+        std::vector< local_index_t > values_;
+    };
+
+    template < index_t dimension >
+    TextureSampler< dimension >::TextureSampler(
+        const RasterImage< dimension >& image, TEXTURE_CHANNEL_LAYOUT layout )
+        : impl_{ image, layout }
+    {
+    }
+
+    template < index_t dimension >
+    TextureSampler< dimension >::TextureSampler(
+        TextureSampler&& ) noexcept = default;
+
+    template < index_t dimension >
+    TextureSampler< dimension >::~TextureSampler() = default;
+
+    template < index_t dimension >
+    TEXTURE_CHANNEL_LAYOUT TextureSampler< dimension >::channel_layout() const
+    {
+        return impl_->channel_layout();
+    }
+
+    template < index_t dimension >
+    RGBColor TextureSampler< dimension >::sample(
+        const Point< dimension >& coordinates, TEXTURE_FILTER filter ) const
+    {
+        return impl_->sample( coordinates, filter );
+    }
+
+    template < index_t dimension >
+    std::vector< RGBColor > TextureSampler< dimension >::sample(
+        absl::Span< const Point< dimension > > coordinates,
+        TEXTURE_FILTER filter ) const
+    {
+        return sample_all( *this, coordinates.size(), filter,
+            [&coordinates]( size_t s ) -> const Point< dimension >& {
+                return coordinates[s];
+            } );
+    }
+
+    template < index_t dimension >
+    class TiledTextureSampler< dimension >::Impl
+    {
+    public:
+        Impl( const TiledRasterImage< dimension >& image, index_t level )
+            : image_( image ), level_( level )
+        {
+            OPENGEODE_EXCEPTION( level_ < image_.nb_levels(),
+                "[TiledTextureSampler] Invalid image level" );
+            for( const auto d : LRange{ dimension } )
+            {
+                nb_cells_[d] = image_.nb_cells_in_direction( level_, d );
+            }
+        }
+
+        RGBColor sample(
+            const Point< dimension >& coordinates, TEXTURE_FILTER filter ) const
+        {
+            if( filter == TEXTURE_FILTER::nearest )
+            {
+                return image_.color( level_,
+                    nearest_cell< dimension >( coordinates, nb_cells_ ) );
+            }
+            const auto stencil =
+                linear_stencil< dimension >( coordinates, nb_cells_ );
+            std::array< RGBColor, SamplingStencil< dimension >::MAX_NB_CELLS >
+                colors;
+            image_.colors( level_,
+                absl::MakeConstSpan( stencil.cells.data(), stencil.nb_cells ),
+                absl::MakeSpan( colors.data(), stencil.nb_cells ) );
+            return blend( stencil, colors );
+        }
+
+    private:
+        const TiledRasterImage< dimension >& image_;
+        index_t level_;
+        ImageCellIndices< dimension > nb_cells_;
+    };
+
+    template < index_t dimension >
+    TiledTextureSampler< dimension >::TiledTextureSampler(
+        const TiledRasterImage< dimension >& image, index_t level )
+        : impl_{ image, level }
+    {
+    }
+
+    template < index_t dimension >
+    TiledTextureSampler< dimension >::TiledTextureSampler(
+        TiledTextureSampler&& ) noexcept = default;
+
+    template < index_t dimension >
+    TiledTextureSampler< dimension >::~TiledTextureSampler() = default;
+
+    template < index_t dimension >
+    RGBColor TiledTextureSampler< dimension >::sample(
+        const Point< dimension >& coordinates, TEXTURE_FILTER filter ) const
+    {
+        return impl_->sample( coordinates, filter );
+    }
+
+    template < index_t dimension >
+    std::vector< RGBColor > TiledTextureSampler< dimension >::sample(
+        absl::Span< const Point< dimension > > coordinates,
+        TEXTURE_FILTER filter ) const
+    {
+        return sample_all( *this, coordinates.size(), filter,
+            [&coordinates]( size_t s ) -> const Point< dimension >& {
+                return coordinates[s];
+            } );
+    }
+
+    std::vector< RGBColor > sample_texture( const Texture2D& texture,
+        const TextureSampler2D& sampler,
+        absl::Span< const PolygonVertex > vertices,
+        TEXTURE_FILTER filter )
+    {
+        return sample_all( sampler, vertices.size(), filter,
+            [&texture, &vertices]( size_t s ) -> const Point2D& {
+                return texture.texture_coordinates( vertices[s] );
+            } );
+    }
+
+    std::vector< RGBColor > sample_texture( const Texture2D& texture,
+        const TextureSampler2D& sampler,
+        absl::Span< const TexturePolygonPosition > positions,
+        TEXTURE_FILTER filter )
+    {
+        return sample_all( sampler, positions.size(), filter,
+            [&texture, &positions]( size_t s ) {
+                const auto& position = positions[s];
+                Point2D coordinates;
+                for( const auto v : LRange{ 3 } )
+                {
+                    coordinates += texture.texture_coordinates(
+                                       { position.polygon_id, v } )
+                                   * position.barycentric_coordinates[v];
+                }
+                return coordinates;
+            } );
+    }
+
+    std::vector< RGBColor > sample_texture( const Texture3D& texture,
+        const TextureSampler3D& sampler,
+        absl::Span< const PolyhedronVertex > vertices,
+        TEXTURE_FILTER filter )
+    {
+        return sample_all( sampler, vertices.size(), filter,
+            [&texture, &vertices]( size_t s ) -> const Point3D& {
+                return texture.texture_coordinates( vertices[s] );
+            } );
+    }
+
+    std::vector< RGBColor > sample_texture( const Texture3D& texture,
+        const TextureSampler3D& sampler,
+        absl::Span< const TexturePolyhedronPosition > positions,
+        TEXTURE_FILTER filter )
+    {
+        return sample_all( sampler, positions.size(), filter,
+            [&texture, &positions]( size_t s ) {
+                const auto& position = positions[s];
+                Point3D coordinates;
+                for( const auto v : LRange{ 4 } )
+                {
+                    coordinates += texture.texture_coordinates(
+                                       { position.polyhedron_id, v } )
+                                   * position.barycentric_coordinates[v];
+                }
+                return coordinates;
+            } );
+    }
+
+    template class opengeode_mesh_api TextureSampler< 2 >;
+    template class opengeode_mesh_api TextureSampler< 3 >;
+    template class opengeode_mesh_api TiledTextureSampler< 2 >;
+    template class opengeode_mesh_api TiledTextureSampler< 3 >;
+} // namespace geode
@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/model/helpers/brep_incidence_index.hpp>
+
+#include <async++.h>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <geode/basic/pimpl_impl.hpp>
+
+#include <geode/mesh/core/edged_curve.hpp>
+#include <geode/mesh/core/mesh_revisions.hpp>
+#include <geode/mesh/core/solid_mesh.hpp>
+#include <geode/mesh/core/surface_mesh.hpp>
+
+#include <geode/model/mixin/core/block.hpp>
+#include <geode/model/mixin/core/line.hpp>
+#include <geode/model/mixin/core/surface.hpp>
+#include <geode/model/representation/core/brep.hpp>
+
+namespace geode
+{
+    class BRepIncidenceIndex::Impl
+    {
+        template < typename Incidence >
+        using Incidences = absl::flat_hash_map< std::pair< uuid, uuid >,
+            std::vector< absl::InlinedVector< Incidence, 2 > > >;
+
+    public:
+        explicit Impl( const BRep& brep )
+            : brep_( brep ), revisions_( brep.mesh_revisions() )
+        {
+            compute_vertex_caches();
+            compute_block_facets();
+            compute_surface_edges();
+        }
+
+        bool is_up_to_date() const
+        {
+            const auto revisions = brep_.mesh_revisions();
+            return revisions.nb_meshes == revisions_.nb_meshes
+                   && revisions.connectivity == revisions_.connectivity;
+        }
+
+        const absl::InlinedVector< BlockPolyhedronFacet, 2 >&
+            block_vertices_from_surface_polygon( const Block3D& block,
+                const Surface3D& surface,
+                index_t polygon_id ) const
+        {
+            OPENGEODE_ASSERT( is_up_to_date(),
+                "[BRepIncidenceIndex::block_vertices_from_surface_polygon] "
+                "The index is outdated, it should be built again" );
+            const auto it = block_facets_.find( { block.id(), surface.id() } );
+            OPENGEODE_EXCEPTION( it != block_facets_.end(),
+                "[BRepIncidenceIndex::block_vertices_from_surface_polygon] "
+                "The given surface is neither boundary nor internal to the "
+                "given block in the indexed model." );
+            OPENGEODE_ASSERT( polygon_id < it->second.size(),
+                "[BRepIncidenceIndex::block_vertices_from_surface_polygon] "
+                "Invalid polygon index" );
+            return it->second[polygon_id];
+        }
+
+        const absl::InlinedVector< SurfacePolygonEdge, 2 >&
+            surface_vertices_from_line_edge( const Surface3D& surface,
+                const Line3D& line,
+                index_t edge_id ) const
+        {
+            OPENGEODE_ASSERT( is_up_to_date(),
+                "[BRepIncidenceIndex::surface_vertices_from_line_edge] "
+                "The index is outdated, it should be built again" );
+            const auto it = surface_edges_.find( { surface.id(), line.id() } );
+            OPENGEODE_EXCEPTION( it != surface_edges_.end(),
+                "[BRepIncidenceIndex::surface_vertices_from_line_edge] The "
+                "given line is neither boundary nor internal to the given "
+                "surface in the indexed model." );
+            OPENGEODE_ASSERT( edge_id < it->second.size(),
+                "[BRepIncidenceIndex::surface_vertices_from_line_edge] "
+                "Invalid edge index" );
+            return it->second[edge_id];
+        }
+
+    private:
+        /*!
+         * Fill the polyhedra and polygons around vertex caches beforehand:
+         * these caches are lazily computed on first access, filling them
+         * once per vertex allows concurrent read-only queries afterwards.
+         */
+        void compute_vertex_caches() const
+        {
+            for( const auto& block : brep_.blocks() )
+            {
+                const auto& mesh = block.mesh();
+                async::parallel_for(
+                    async::irange( index_t{ 0 }, mesh.nb_vertices() ),
+                    [&mesh]( index_t v ) {
+                        geode_unused( mesh.polyhedra_around_vertex( v ) );
+                    } );
+            }
+            for( const auto& surface : brep_.surfaces() )
+            {
+                const auto& mesh = surface.mesh();
+                async::parallel_for(
+                    async::irange( index_t{ 0 }, mesh.nb_vertices() ),
+                    [&mesh]( index_t v ) {
+                        geode_unused( mesh.polygons_around_vertex( v ) );
+                    } );
+            }
+        }
+
+        void compute_block_facets()
+        {
+            for( const auto& block : brep_.blocks() )
+            {
+                for( const auto& surface : brep_.boundaries( block ) )
+                {
+                    compute_block_facets( block, surface );
+                }
+                for( const auto& surface : brep_.internal_surfaces( block ) )
+                {
+                    compute_block_facets( block, surface );
+                }
+            }
+        }
+
+        void compute_block_facets(
+            const Block3D& block, const Surface3D& surface )
+        {
+            auto [it, inserted] =
+                block_facets_.try_emplace( { block.id(), surface.id() } );
+            if( !inserted )
+            {
+                return;
+            }
+            auto& facets = it->second;
+            facets.resize( surface.mesh().nb_polygons() );
+            async::parallel_for(
+                async::irange( index_t{ 0 }, surface.mesh().nb_polygons() ),
+                [this, &block, &surface, &facets]( index_t p ) {
+                    facets[p] = geode::block_vertices_from_surface_polygon(
+                        brep_, block, surface, p );
+                } );
+        }
+
+        void compute_surface_edges()
+        {
+            for( const auto& surface : brep_.surfaces() )
+            {
+                for( const auto& line : brep_.boundaries( surface ) )
+                {
+                    compute_surface_edges( surface, line );
+                }
+                for( const auto& line : brep_.internal_lines( surface ) )
+                {
+                    compute_surface_edges( surface, line );
+                }
+            }
+        }
+
+        void compute_surface_edges(
+            const Surface3D& surface, const Line3D& line )
+        {
+            auto [it, inserted] =
+                surface_edges_.try_emplace( { surface.id(), line.id() } );
+            if( !inserted )
+            {
+                return;
+            }
+            auto& edges = it->second;
+            edges.resize( line.mesh().nb_edges() );
+            async::parallel_for(
+                async::irange( index_t{ 0 }, line.mesh().nb_edges() ),
+                [this, &surface, &line, &edges]( index_t e ) {
+                    edges[e] = geode::surface_vertices_from_line_edge(
+                        brep_, surface, line, e );
+                } );
+        }
+
+    private:
+        const BRep& brep_;
+        MeshRevisions revisions_;
+        Incidences< BlockPolyhedronFacet > block_facets_;
+        Incidences< SurfacePolygonEdge > surface_edges_;
+    };
+
+    BRepIncidenceIndex::BRepIncidenceIndex( const BRep& brep ) : impl_{ brep }
+    {
+    }
+
+    BRepIncidenceIndex::BRepIncidenceIndex(
+        BRepIncidenceIndex&& ) noexcept = default;
+
+    BRepIncidenceIndex::~BRepIncidenceIndex() = default;
+
+    bool BRepIncidenceIndex::is_up_to_date() const
+    {
+        return impl_->is_up_to_date();
+    }
+
+    const absl::InlinedVector< BlockPolyhedronFacet, 2 >&
+        BRepIncidenceIndex::block_vertices_from_surface_polygon(
+            const Block3D& block,
+            const Surface3D& surface,
+            index_t polygon_id ) const
+    {
+        return impl_->block_vertices_from_surface_polygon(
+            block, surface, polygon_id );
+    }
+
+    PolyhedraAroundFacet
+        BRepIncidenceIndex::block_mesh_polyhedra_from_surface_polygon(
+            const Block3D& block,
+            const Surface3D& surface,
+            index_t polygon_id ) const
+    {
+        PolyhedraAroundFacet polyhedra;
+        for( const auto& facet : impl_->block_vertices_from_surface_polygon(
+                 block, surface, polygon_id ) )
+        {
+            polyhedra.emplace_back( facet.facet );
+        }
+        return polyhedra;
+    }
+
+    const absl::InlinedVector< SurfacePolygonEdge, 2 >&
+        BRepIncidenceIndex::surface_vertices_from_line_edge(
+            const Surface3D& surface,
+            const Line3D& line,
+            index_t edge_id ) const
+    {
+        return impl_->surface_vertices_from_line_edge( surface, line, edge_id );
+    }
+} // namespace geode
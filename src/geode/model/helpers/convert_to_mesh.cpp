@@ -21,11 +21,17 @@
  *
  */
 
+#include <atomic>
 #include <memory>
+#include <numeric>
 
 #include <geode/model/helpers/convert_to_mesh.hpp>
 
-#include <absl/container/flat_hash_map.h>
+#include <async++.h>
+
+#include <absl/algorithm/container.h>
+#include <absl/container/fixed_array.h>
+#include <absl/types/span.h>
 
 #include <geode/basic/attribute.hpp>
 #include <geode/basic/attribute_manager.hpp>
@@ -64,6 +70,309 @@
 
 namespace
 {
+    template < geode::index_t dimension >
+    geode::index_t nb_elements( const geode::EdgedCurve< dimension >& mesh )
+    {
+        return mesh.nb_edges();
+    }
+
+    template < geode::index_t dimension >
+    geode::index_t nb_elements( const geode::SurfaceMesh< dimension >& mesh )
+    {
+        return mesh.nb_polygons();
+    }
+
+    geode::index_t nb_elements( const geode::SolidMesh3D& mesh )
+    {
+        return mesh.nb_polyhedra();
+    }
+
+    template < geode::index_t dimension >
+    geode::local_index_t nb_element_vertices(
+        const geode::EdgedCurve< dimension >& /*unused*/,
+        geode::index_t /*unused*/ )
+    {
+        return 2;
+    }
+
+    template < geode::index_t dimension >
+    geode::local_index_t nb_element_vertices(
+        const geode::SurfaceMesh< dimension >& mesh, geode::index_t element )
+    {
+        return mesh.nb_polygon_vertices( element );
+    }
+
+    geode::local_index_t nb_element_vertices(
+        const geode::SolidMesh3D& mesh, geode::index_t element )
+    {
+        return mesh.nb_polyhedron_vertices( element );
+    }
+
+    template < geode::index_t dimension >
+    geode::index_t element_vertex( const geode::EdgedCurve< dimension >& mesh,
+        geode::index_t element,
+        geode::local_index_t vertex )
+    {
+        return mesh.edge_vertex( { element, vertex } );
+    }
+
+    template < geode::index_t dimension >
+    geode::index_t element_vertex( const geode::SurfaceMesh< dimension >& mesh,
+        geode::index_t element,
+        geode::local_index_t vertex )
+    {
+        return mesh.polygon_vertex( { element, vertex } );
+    }
+
+    geode::index_t element_vertex( const geode::SolidMesh3D& mesh,
+        geode::index_t element,
+        geode::local_index_t vertex )
+    {
+        return mesh.polyhedron_vertex( { element, vertex } );
+    }
+
+    template < typename Model, typename Component >
+    absl::FixedArray< geode::index_t > component_unique_vertices(
+        const Model& model, const Component& component )
+    {
+        const auto& mesh = component.mesh();
+        const auto component_id = component.component_id();
+        absl::FixedArray< geode::index_t > unique_vertices(
+            mesh.nb_vertices() );
+        async::parallel_for(
+            async::irange( geode::index_t{ 0 }, mesh.nb_vertices() ),
+            [&model, &component_id, &unique_vertices]( geode::index_t vertex ) {
+                unique_vertices[vertex] =
+                    model.unique_vertex( { component_id, vertex } );
+            } );
+        return unique_vertices;
+    }
+
+    /*!
+     * Dense mapping from the model unique vertices to the output mesh
+     * vertices. Each mesh vertex keeps the component mesh vertex used to
+     * set its coordinates.
+     */
+    class UniqueVerticesMapper
+    {
+    public:
+        struct Source
+        {
+            geode::index_t component{ geode::NO_ID };
+            geode::index_t vertex{ geode::NO_ID };
+        };
+
+        explicit UniqueVerticesMapper( geode::index_t nb_unique_vertices )
+            : mesh_vertices_( nb_unique_vertices, geode::NO_ID )
+        {
+        }
+
+        void map_all_unique_vertices()
+        {
+            absl::c_iota( mesh_vertices_, 0 );
+            sources_.resize( mesh_vertices_.size() );
+        }
+
+        geode::index_t mesh_vertex( geode::index_t unique_vertex ) const
+        {
+            return mesh_vertices_[unique_vertex];
+        }
+
+        template < typename SourceGetter >
+        geode::index_t map(
+            geode::index_t unique_vertex, const SourceGetter& source )
+        {
+            OPENGEODE_ASSERT( unique_vertex < mesh_vertices_.size(),
+                "[UniqueVerticesMapper::map] Component mesh vertex without "
+                "unique vertex" );
+            auto& mesh_vertex = mesh_vertices_[unique_vertex];
+            if( mesh_vertex == geode::NO_ID )
+            {
+                mesh_vertex = geode::checked_index( sources_.size() );
+                sources_.push_back( source() );
+            }
+            else if( sources_[mesh_vertex].component == geode::NO_ID )
+            {
+                sources_[mesh_vertex] = source();
+            }
+            return mesh_vertex;
+        }
+
+        template < typename Component, typename Builder >
+        void create_points(
+            absl::Span< const std::reference_wrapper< const Component > >
+                components,
+            Builder& builder ) const
+        {
+            const auto nb_vertices = geode::checked_index( sources_.size() );
+            builder.create_vertices( nb_vertices );
+            async::parallel_for(
+                async::irange( geode::index_t{ 0 }, nb_vertices ),
+                [this, &components, &builder]( geode::index_t vertex ) {
+                    const auto& source = sources_[vertex];
+                    if( source.component == geode::NO_ID )
+                    {
+                        return;
+                    }
+                    builder.set_point( vertex,
+                        components[source.component].get().mesh().point(
+                            source.vertex ) );
+                } );
+        }
+
+        void fill_mapping(
+            geode::BijectiveMapping< geode::index_t >& mapping ) const
+        {
+            mapping.reserve( sources_.size() );
+            for( const auto unique_vertex : geode::Indices{ mesh_vertices_ } )
+            {
+                const auto mesh_vertex = mesh_vertices_[unique_vertex];
+                if( mesh_vertex != geode::NO_ID )
+                {
+                    mapping.map( unique_vertex, mesh_vertex );
+                }
+            }
+        }
+
+    private:
+        absl::FixedArray< geode::index_t > mesh_vertices_;
+        std::vector< Source > sources_;
+    };
+
+    /*!
+     * Output mesh vertices of the elements of model components, stored
+     * contiguously in the output element order: the elements of each
+     * component are appended after those of the previous components.
+     * Element sizes and unique vertices are gathered in parallel at
+     * precomputed offsets, only the numbering of the new mesh vertices is
+     * sequential to keep a deterministic order.
+     */
+    template < typename Component >
+    class ModelElements
+    {
+    public:
+        template < typename Model, typename ComponentRange >
+        ModelElements( const Model& model,
+            ComponentRange range,
+            UniqueVerticesMapper& mapper )
+        {
+            for( const auto& component : range )
+            {
+                components_.emplace_back( component );
+            }
+            count_elements();
+            fill_element_vertices( model );
+            map_element_vertices( mapper );
+        }
+
+        absl::Span< const std::reference_wrapper< const Component > >
+            components() const
+        {
+            return components_;
+        }
+
+        geode::index_t nb_elements() const
+        {
+            return first_elements_.back();
+        }
+
+        geode::index_t first_element( geode::index_t component ) const
+        {
+            return first_elements_[component];
+        }
+
+        absl::Span< const geode::index_t > element_vertices(
+            geode::index_t element ) const
+        {
+            const auto offset = vertex_offsets_[element];
+            return absl::MakeConstSpan( vertices_ )
+                .subspan( offset, vertex_offsets_[element + 1] - offset );
+        }
+
+    private:
+        void count_elements()
+        {
+            first_elements_.reserve( components_.size() + 1 );
+            first_elements_.push_back( 0 );
+            for( const auto& component : components_ )
+            {
+                first_elements_.push_back( first_elements_.back()
+                                           + ::nb_elements(
+                                               component.get().mesh() ) );
+            }
+            vertex_offsets_.resize( nb_elements() + 1, 0 );
+            for( const auto c : geode::Indices{ components_ } )
+            {
+                const auto& mesh = components_[c].get().mesh();
+                const auto first = first_elements_[c];
+                async::parallel_for(
+                    async::irange( geode::index_t{ 0 }, ::nb_elements( mesh ) ),
+                    [this, &mesh, first]( geode::index_t element ) {
+                        vertex_offsets_[first + element + 1] =
+                            nb_element_vertices( mesh, element );
+                    } );
+            }
+            std::partial_sum( vertex_offsets_.begin(), vertex_offsets_.end(),
+                vertex_offsets_.begin() );
+            vertices_.resize( vertex_offsets_.back() );
+        }
+
+        template < typename Model >
+        void fill_element_vertices( const Model& model )
+        {
+            for( const auto c : geode::Indices{ components_ } )
+            {
+                const auto& component = components_[c].get();
+                const auto& mesh = component.mesh();
+                const auto unique_vertices =
+                    component_unique_vertices( model, component );
+                const auto first = first_elements_[c];
+                async::parallel_for(
+                    async::irange( geode::index_t{ 0 }, ::nb_elements( mesh ) ),
+                    [this, &mesh, &unique_vertices, first](
+                        geode::index_t element ) {
+                        auto offset = vertex_offsets_[first + element];
+                        for( const auto v : geode::LRange{
+                                 nb_element_vertices( mesh, element ) } )
+                        {
+                            vertices_[offset++] =
+                                unique_vertices[element_vertex(
+                                    mesh, element, v )];
+                        }
+                    } );
+            }
+        }
+
+        void map_element_vertices( UniqueVerticesMapper& mapper )
+        {
+            for( const auto c : geode::Indices{ components_ } )
+            {
+                const auto& mesh = components_[c].get().mesh();
+                const auto first = first_elements_[c];
+                for( const auto element :
+                    geode::Range{ ::nb_elements( mesh ) } )
+                {
+                    const auto offset = vertex_offsets_[first + element];
+                    for( const auto v :
+                        geode::LRange{ nb_element_vertices( mesh, element ) } )
+                    {
+                        auto& vertex = vertices_[offset + v];
+                        vertex = mapper.map( vertex, [&mesh, c, element, v] {
+                            return UniqueVerticesMapper::Source{ c,
+                                element_vertex( mesh, element, v ) };
+                        } );
+                    }
+                }
+            }
+        }
+
+    private:
+        std::vector< std::reference_wrapper< const Component > > components_;
+        std::vector< geode::index_t > first_elements_;
+        std::vector< geode::index_t > vertex_offsets_;
+        std::vector< geode::index_t > vertices_;
+    };
+
     template < typename Model >
     void map_corner_vertices(
         Model& model, geode::ModelToMeshMappings& model2mesh )
@@ -84,38 +393,26 @@ namespace
         geode::ModelToMeshMappings& model2mesh,
         geode::EdgedCurveBuilder< Model::dim >& mesh_builder )
     {
-        for( const auto& line : model.lines() )
+        UniqueVerticesMapper mapper{ model.nb_unique_vertices() };
+        const ModelElements< geode::Line< Model::dim > > lines{ model,
+            model.lines(), mapper };
+        mapper.create_points( lines.components(), mesh_builder );
+        model2mesh.line_edges_mapping.reserve( lines.nb_elements() );
+        for( const auto l : geode::Indices{ lines.components() } )
         {
-            const auto& line_mesh = line.mesh();
-            for( const auto& edge_id : geode::Range{ line_mesh.nb_edges() } )
+            const auto& line = lines.components()[l].get();
+            const auto first_edge = lines.first_element( l );
+            for( const auto edge_id : geode::Range{ line.mesh().nb_edges() } )
             {
-                std::array< geode::index_t, 2 > vertices;
-                for( const auto edge_vertex_id : geode::LRange{ 2 } )
-                {
-                    const auto vertex =
-                        line_mesh.edge_vertex( { edge_id, edge_vertex_id } );
-                    const auto unique_vertex =
-                        model.unique_vertex( { line.component_id(), vertex } );
-                    if( model2mesh.unique_vertices_mapping.has_mapping_input(
-                            unique_vertex ) )
-                    {
-                        vertices[edge_vertex_id] =
-                            model2mesh.unique_vertices_mapping.in2out(
-                                unique_vertex );
-                        continue;
-                    }
-                    const auto new_vertex_index =
-                        mesh_builder.create_point( line_mesh.point( vertex ) );
-                    vertices[edge_vertex_id] = new_vertex_index;
-                    model2mesh.unique_vertices_mapping.map(
-                        unique_vertex, new_vertex_index );
-                }
+                const auto vertices =
+                    lines.element_vertices( first_edge + edge_id );
                 const auto edge_index =
                     mesh_builder.create_edge( vertices[0], vertices[1] );
                 model2mesh.line_edges_mapping.map(
                     { line.id(), edge_id }, edge_index );
             }
         }
+        mapper.fill_mapping( model2mesh.unique_vertices_mapping );
     }
 
     template < typename Model >
@@ -143,8 +440,7 @@ namespace
     }
 
     template < geode::index_t dim >
-    void set_polygons_surface_adjacencies(
-        const absl::FixedArray< geode::index_t >& polygons,
+    void set_polygons_surface_adjacencies( geode::index_t first_polygon,
         const geode::SurfaceMesh< dim >& surface_mesh,
         geode::SurfaceMeshBuilder< dim >& mesh_builder )
     {
@@ -158,8 +454,8 @@ namespace
                         { polygon_id, edge_id } ) )
                 {
                     mesh_builder.set_polygon_adjacent(
-                        { polygons[polygon_id], edge_id },
-                        polygons[adj.value()] );
+                        { first_polygon + polygon_id, edge_id },
+                        first_polygon + adj.value() );
                 }
             }
         }
@@ -167,74 +463,66 @@ namespace
 
     template < typename Model >
     void build_polygons_from_model( const Model& model,
+        UniqueVerticesMapper& mapper,
         geode::SurfaceMeshBuilder< Model::dim >& mesh_builder,
         geode::ModelToMeshMappings& model2mesh )
     {
-        for( const auto& surface : model.surfaces() )
+        const ModelElements< geode::Surface< Model::dim > > surfaces{ model,
+            model.surfaces(), mapper };
+        mapper.create_points( surfaces.components(), mesh_builder );
+        model2mesh.surface_polygons_mapping.reserve( surfaces.nb_elements() );
+        for( const auto s : geode::Indices{ surfaces.components() } )
         {
+            const auto& surface = surfaces.components()[s].get();
             const auto& surface_mesh = surface.mesh();
-            absl::FixedArray< geode::index_t > polygons(
-                surface_mesh.nb_polygons() );
+            const auto first_polygon = surfaces.first_element( s );
             for( const auto polygon_id :
                 geode::Range{ surface_mesh.nb_polygons() } )
             {
-                absl::FixedArray< geode::index_t > polygon_vertices(
-                    surface_mesh.nb_polygon_vertices( polygon_id ) );
-                for( const auto polygon_vertex :
-                    geode::LIndices{ polygon_vertices } )
-                {
-                    const auto vertex = surface_mesh.polygon_vertex(
-                        { polygon_id, polygon_vertex } );
-                    const auto unique_vertex = model.unique_vertex(
-                        { surface.component_id(), vertex } );
-                    if( model2mesh.unique_vertices_mapping.has_mapping_input(
-                            unique_vertex ) )
-                    {
-                        polygon_vertices[polygon_vertex] =
-                            model2mesh.unique_vertices_mapping.in2out(
-                                unique_vertex );
-                        continue;
-                    }
-
-                    const auto new_vertex_index = mesh_builder.create_point(
-                        surface_mesh.point( vertex ) );
-                    polygon_vertices[polygon_vertex] = new_vertex_index;
-                    model2mesh.unique_vertices_mapping.map(
-                        unique_vertex, new_vertex_index );
-                }
-                polygons[polygon_id] =
-                    mesh_builder.create_polygon( polygon_vertices );
+                const auto polygon = mesh_builder.create_polygon(
+                    surfaces.element_vertices( first_polygon + polygon_id ) );
                 model2mesh.surface_polygons_mapping.map(
-                    { surface.id(), polygon_id }, polygons[polygon_id] );
+                    { surface.id(), polygon_id }, polygon );
             }
             set_polygons_surface_adjacencies< Model::dim >(
-                polygons, surface_mesh, mesh_builder );
+                first_polygon, surface_mesh, mesh_builder );
         }
+        mapper.fill_mapping( model2mesh.unique_vertices_mapping );
     }
 
     template < typename Model, typename MeshType >
-    void map_line_edges(
-        Model& model, geode::ModelToMeshMappings& model2mesh, MeshType& mesh )
+    void map_line_edges( const Model& model,
+        const UniqueVerticesMapper& mapper,
+        geode::ModelToMeshMappings& model2mesh,
+        MeshType& mesh )
     {
         mesh.enable_edges();
+        const auto& edges = mesh.edges();
         for( const auto& line : model.lines() )
         {
             const auto& line_mesh = line.mesh();
+            const auto unique_vertices =
+                component_unique_vertices( model, line );
+            absl::FixedArray< geode::index_t > mesh_edges(
+                line_mesh.nb_edges() );
+            async::parallel_for(
+                async::irange( geode::index_t{ 0 }, line_mesh.nb_edges() ),
+                [&]( geode::index_t line_edge ) {
+                    std::array< geode::index_t, 2 > vertices;
+                    for( const auto v : geode::LRange{ 2 } )
+                    {
+                        const auto vertex =
+                            line_mesh.edge_vertex( { line_edge, v } );
+                        vertices[v] =
+                            mapper.mesh_vertex( unique_vertices[vertex] );
+                    }
+                    mesh_edges[line_edge] =
+                        edges.edge_from_vertices( vertices ).value();
+                } );
             for( const auto line_edge : geode::Range{ line_mesh.nb_edges() } )
             {
-                auto unique_vertices =
-                    geode::edge_unique_vertices( model, line, line_edge );
-                for( const auto edge_vertex_id :
-                    geode::LRange{ unique_vertices.size() } )
-                {
-                    unique_vertices[edge_vertex_id] =
-                        model2mesh.unique_vertices_mapping.in2out(
-                            unique_vertices[edge_vertex_id] );
-                }
-                const auto solid_edge =
-                    mesh.edges().edge_from_vertices( unique_vertices ).value();
                 model2mesh.line_edges_mapping.map(
-                    { line.id(), line_edge }, solid_edge );
+                    { line.id(), line_edge }, mesh_edges[line_edge] );
             }
         }
     }
@@ -258,15 +546,15 @@ namespace
         auto mesh_builder =
             geode::SurfaceMeshBuilder< Model::dim >::create( *mesh );
         geode::ModelToMeshMappings model2mesh;
-        build_polygons_from_model( model, *mesh_builder, model2mesh );
+        UniqueVerticesMapper mapper{ model.nb_unique_vertices() };
+        build_polygons_from_model( model, mapper, *mesh_builder, model2mesh );
         mesh_builder->compute_polygon_adjacencies();
-        map_line_edges( model, model2mesh, *mesh );
+        map_line_edges( model, mapper, model2mesh, *mesh );
         map_corner_vertices( model, model2mesh );
         return std::make_pair( std::move( mesh ), std::move( model2mesh ) );
     }
 
-    void set_block_polyhedra_adjacencies(
-        const absl::FixedArray< geode::index_t >& polyhedra,
+    void set_block_polyhedra_adjacencies( geode::index_t first_polyhedron,
         const geode::SolidMesh3D& block_mesh,
         geode::SolidMeshBuilder3D& mesh_builder )
     {
@@ -280,111 +568,105 @@ namespace
                         { polyhedron_id, polyhedron_facet } ) )
                 {
                     mesh_builder.set_polyhedron_adjacent(
-                        { polyhedra[polyhedron_id], polyhedron_facet },
-                        polyhedra[adj.value()] );
+                        { first_polyhedron + polyhedron_id, polyhedron_facet },
+                        first_polyhedron + adj.value() );
                 }
             }
         }
     }
 
+    absl::FixedArray< std::vector< geode::local_index_t > >
+        polyhedron_facet_vertices(
+            const geode::SolidMesh3D& block_mesh, geode::index_t polyhedron_id )
+    {
+        absl::FixedArray< std::vector< geode::local_index_t > >
+            facet_vertices( block_mesh.nb_polyhedron_facets( polyhedron_id ) );
+        for( const auto polyhedron_facet :
+            geode::LRange{ block_mesh.nb_polyhedron_facets( polyhedron_id ) } )
+        {
+            auto& vertices = facet_vertices[polyhedron_facet];
+            vertices.resize( block_mesh.nb_polyhedron_facet_vertices(
+                { polyhedron_id, polyhedron_facet } ) );
+            for( const auto polyhedron_facet_vertex :
+                geode::LRange{ block_mesh.nb_polyhedron_facet_vertices(
+                    { polyhedron_id, polyhedron_facet } ) } )
+            {
+                const auto vertex = block_mesh.polyhedron_facet_vertex(
+                    { { polyhedron_id, polyhedron_facet },
+                        polyhedron_facet_vertex } );
+                vertices[polyhedron_facet_vertex] =
+                    block_mesh.vertex_in_polyhedron( polyhedron_id, vertex )
+                        .value();
+            }
+        }
+        return facet_vertices;
+    }
+
     void build_polyhedra_from_model( const geode::BRep& brep,
+        UniqueVerticesMapper& mapper,
         geode::SolidMeshBuilder3D& mesh_builder,
         geode::ModelToMeshMappings& brep2mesh )
     {
-        for( const auto& block : brep.blocks() )
+        mapper.map_all_unique_vertices();
+        const ModelElements< geode::Block3D > blocks{ brep, brep.blocks(),
+            mapper };
+        mapper.create_points( blocks.components(), mesh_builder );
+        brep2mesh.solid_polyhedra_mapping.reserve( blocks.nb_elements() );
+        for( const auto b : geode::Indices{ blocks.components() } )
         {
+            const auto& block = blocks.components()[b].get();
             const auto& block_mesh = block.mesh();
-            absl::FixedArray< geode::index_t > polyhedra(
-                block_mesh.nb_polyhedra() );
+            const auto first_polyhedron = blocks.first_element( b );
             for( const auto polyhedron_id :
                 geode::Range{ block_mesh.nb_polyhedra() } )
             {
-                absl::FixedArray< geode::index_t > polyhedron_vertices(
-                    block_mesh.nb_polyhedron_vertices( polyhedron_id ) );
-                for( const auto polyhedron_vertex : geode::LRange{
-                         block_mesh.nb_polyhedron_vertices( polyhedron_id ) } )
-                {
-                    const auto vertex = block_mesh.polyhedron_vertex(
-                        { polyhedron_id, polyhedron_vertex } );
-                    const auto unique_vertex =
-                        brep.unique_vertex( { block.component_id(), vertex } );
-                    if( brep2mesh.unique_vertices_mapping.has_mapping_input(
-                            unique_vertex ) )
-                    {
-                        polyhedron_vertices[polyhedron_vertex] =
-                            brep2mesh.unique_vertices_mapping.in2out(
-                                unique_vertex );
-                        mesh_builder.set_point(
-                            polyhedron_vertices[polyhedron_vertex],
-                            block_mesh.point( vertex ) );
-                        continue;
-                    }
-                    auto new_vertex_index =
-                        mesh_builder.create_point( block_mesh.point( vertex ) );
-                    polyhedron_vertices[polyhedron_vertex] = new_vertex_index;
-                    brep2mesh.unique_vertices_mapping.map(
-                        unique_vertex, new_vertex_index );
-                }
-                absl::FixedArray< std::vector< geode::local_index_t > >
-                    polyhedron_facet_vertices(
-                        block_mesh.nb_polyhedron_facets( polyhedron_id ) );
-                for( const auto polyhedron_facet : geode::LRange{
-                         block_mesh.nb_polyhedron_facets( polyhedron_id ) } )
-                {
-                    auto& facet_vertices =
-                        polyhedron_facet_vertices[polyhedron_facet];
-                    facet_vertices.resize(
-                        block_mesh.nb_polyhedron_facet_vertices(
-                            { polyhedron_id, polyhedron_facet } ) );
-                    for( const auto polyhedron_facet_vertex :
-                        geode::LRange{ block_mesh.nb_polyhedron_facet_vertices(
-                            { polyhedron_id, polyhedron_facet } ) } )
-                    {
-                        const auto vertex = block_mesh.polyhedron_facet_vertex(
-                            { { polyhedron_id, polyhedron_facet },
-                                polyhedron_facet_vertex } );
-                        facet_vertices[polyhedron_facet_vertex] =
-                            block_mesh
-                                .vertex_in_polyhedron( polyhedron_id, vertex )
-                                .value();
-                    }
-                }
-                polyhedra[polyhedron_id] = mesh_builder.create_polyhedron(
-                    polyhedron_vertices, polyhedron_facet_vertices );
+                const auto polyhedron = mesh_builder.create_polyhedron(
+                    blocks.element_vertices( first_polyhedron + polyhedron_id ),
+                    polyhedron_facet_vertices( block_mesh, polyhedron_id ) );
                 brep2mesh.solid_polyhedra_mapping.map(
-                    { block.id(), polyhedron_id }, polyhedra[polyhedron_id] );
+                    { block.id(), polyhedron_id }, polyhedron );
             }
             set_block_polyhedra_adjacencies(
-                polyhedra, block_mesh, mesh_builder );
+                first_polyhedron, block_mesh, mesh_builder );
         }
+        mapper.fill_mapping( brep2mesh.unique_vertices_mapping );
     }
 
     void map_polygons_to_solid_facets( const geode::BRep& brep,
+        const UniqueVerticesMapper& mapper,
         geode::ModelToMeshMappings& brep2mesh,
         geode::SolidMesh3D& mesh )
     {
         mesh.enable_facets();
+        const auto& facets = mesh.facets();
         for( const auto& surface : brep.surfaces() )
         {
             const auto& surface_mesh = surface.mesh();
+            const auto unique_vertices =
+                component_unique_vertices( brep, surface );
+            absl::FixedArray< geode::index_t > solid_facets(
+                surface_mesh.nb_polygons() );
+            async::parallel_for( async::irange( geode::index_t{ 0 },
+                                     surface_mesh.nb_polygons() ),
+                [&]( geode::index_t polygon ) {
+                    geode::PolyhedronFacetVertices vertices(
+                        surface_mesh.nb_polygon_vertices( polygon ) );
+                    for( const auto v : geode::LIndices{ vertices } )
+                    {
+                        const auto vertex =
+                            surface_mesh.polygon_vertex( { polygon, v } );
+                        vertices[v] =
+                            mapper.mesh_vertex( unique_vertices[vertex] );
+                    }
+                    solid_facets[polygon] =
+                        facets.facet_from_vertices( vertices ).value();
+                } );
             for( const auto surface_polygon :
                 geode::Range{ surface_mesh.nb_polygons() } )
             {
-                auto unique_vertices = geode::polygon_unique_vertices(
-                    brep, surface, surface_polygon );
-                for( const auto polygon_vertex_id :
-                    geode::LRange{ unique_vertices.size() } )
-                {
-                    unique_vertices[polygon_vertex_id] =
-                        brep2mesh.unique_vertices_mapping.in2out(
-                            unique_vertices[polygon_vertex_id] );
-                }
-                const auto solid_facet =
-                    mesh.facets()
-                        .facet_from_vertices( unique_vertices )
-                        .value();
                 brep2mesh.surface_polygons_mapping.map(
-                    { surface.id(), surface_polygon }, solid_facet );
+                    { surface.id(), surface_polygon },
+                    solid_facets[surface_polygon] );
             }
         }
     }
@@ -429,27 +711,25 @@ namespace geode
         auto mesh = geode::detail::create_mesh< SolidMesh3D >( meshes );
         auto mesh_builder = geode::SolidMeshBuilder< 3 >::create( *mesh );
         ModelToMeshMappings brep2mesh;
-        for( const auto unique_vertex :
-            geode::Range{ brep.nb_unique_vertices() } )
-        {
-            OPENGEODE_EXCEPTION(
-                brep.has_component_mesh_vertices(
-                    unique_vertex, geode::Block3D::component_type_static() ),
-                "The model contains a vertex not in a block." );
-        }
-        for( const auto unique_vertex :
-            geode::Range{ brep.nb_unique_vertices() } )
-        {
-            const auto new_vertex_index = mesh_builder->create_vertex();
-            brep2mesh.unique_vertices_mapping.map(
-                unique_vertex, new_vertex_index );
-        }
-        build_polyhedra_from_model( brep, *mesh_builder, brep2mesh );
+        std::atomic< bool > vertex_outside_blocks{ false };
+        async::parallel_for(
+            async::irange( geode::index_t{ 0 }, brep.nb_unique_vertices() ),
+            [&brep, &vertex_outside_blocks]( geode::index_t unique_vertex ) {
+                if( !brep.has_component_mesh_vertices( unique_vertex,
+                        geode::Block3D::component_type_static() ) )
+                {
+                    vertex_outside_blocks = true;
+                }
+            } );
+        OPENGEODE_EXCEPTION( !vertex_outside_blocks,
+            "The model contains a vertex not in a block." );
+        UniqueVerticesMapper mapper{ brep.nb_unique_vertices() };
+        build_polyhedra_from_model( brep, mapper, *mesh_builder, brep2mesh );
         if( mesh->nb_polyhedra() != 0 )
         {
             mesh_builder->compute_polyhedron_adjacencies();
-            map_polygons_to_solid_facets( brep, brep2mesh, *mesh );
-            map_line_edges( brep, brep2mesh, *mesh );
+            map_polygons_to_solid_facets( brep, mapper, brep2mesh, *mesh );
+            map_line_edges( brep, mapper, brep2mesh, *mesh );
             map_corner_vertices( brep, brep2mesh );
         }
         return std::make_pair( std::move( mesh ), std::move( brep2mesh ) );
@@ -66,6 +66,34 @@ namespace
         const auto& boundary = model.model_boundary( model_boundary_id );
         return boundary;
     }
+
+    void add_line_in_model_boundary( const geode::Section& model,
+        geode::SectionBuilder& builder,
+        const geode::Line2D& line )
+    {
+        if( model.nb_incidences( line.id() ) != 1
+            || is_part_of_a_model_boundary( model, line.id() ) )
+        {
+            return;
+        }
+        const auto& boundary =
+            find_or_create_boundary( model, builder, line.name() );
+        builder.add_line_in_model_boundary( line, boundary );
+    }
+
+    void add_surface_in_model_boundary( const geode::BRep& model,
+        geode::BRepBuilder& builder,
+        const geode::Surface3D& surface )
+    {
+        if( model.nb_incidences( surface.id() ) != 1
+            || is_part_of_a_model_boundary( model, surface.id() ) )
+        {
+            return;
+        }
+        const auto& boundary =
+            find_or_create_boundary( model, builder, surface.name() );
+        builder.add_surface_in_model_boundary( surface, boundary );
+    }
 } // namespace
 
 namespace geode
@@ -77,14 +105,18 @@ namespace geode
         {
             for( const auto& line : model.lines() )
             {
-                if( model.nb_incidences( line.id() ) != 1
-                    || ::is_part_of_a_model_boundary( model, line.id() ) )
-                {
-                    continue;
-                }
-                const auto& boundary =
-                    ::find_or_create_boundary( model, builder, line.name() );
-                builder.add_line_in_model_boundary( line, boundary );
+                ::add_line_in_model_boundary( model, builder, line );
+            }
+        }
+
+        void build_model_boundaries( const Section& model,
+            SectionBuilder& builder,
+            absl::Span< const uuid > lines )
+        {
+            for( const auto& line_id : lines )
+            {
+                ::add_line_in_model_boundary(
+                    model, builder, model.line( line_id ) );
             }
         }
 
@@ -92,14 +124,18 @@ namespace geode
         {
             for( const auto& surface : model.surfaces() )
             {
-                if( model.nb_incidences( surface.id() ) != 1
-                    || ::is_part_of_a_model_boundary( model, surface.id() ) )
-                {
-                    continue;
-                }
-                const auto& boundary =
-                    ::find_or_create_boundary( model, builder, surface.name() );
-                builder.add_surface_in_model_boundary( surface, boundary );
+                ::add_surface_in_model_boundary( model, builder, surface );
+            }
+        }
+
+        void build_model_boundaries( const BRep& model,
+            BRepBuilder& builder,
+            absl::Span< const uuid > surfaces )
+        {
+            for( const auto& surface_id : surfaces )
+            {
+                ::add_surface_in_model_boundary(
+                    model, builder, model.surface( surface_id ) );
             }
         }
     } // namespace detail
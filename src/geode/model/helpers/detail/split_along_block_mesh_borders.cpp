@@ -50,6 +50,13 @@ namespace geode
             using CMVmapping =
                 std::pair< ComponentMeshVertex, ComponentMeshVertex >;
             using CMVmappings = std::vector< CMVmapping >;
+            using UniqueVertices =
+                std::vector< std::pair< ComponentMeshVertex, index_t > >;
+            struct BlockSplit
+            {
+                CMVmappings mapping;
+                UniqueVertices unique_vertices;
+            };
 
         public:
             Impl( const BRep& model, BRepBuilder& builder )
@@ -59,63 +66,52 @@ namespace geode
 
             CMVmappings split()
             {
-                using Task =
-                    async::task< std::pair< uuid, MeshesElementsMapping > >;
-                absl::FixedArray< Task > tasks( model_.nb_blocks() );
-                index_t count{ 0 };
+                std::vector< const Block3D* > blocks;
+                blocks.reserve( model_.nb_blocks() );
                 for( const auto& block : model_.blocks() )
                 {
-                    tasks[count++] = async::spawn( [this, &block] {
-                        const auto& mesh = block.mesh();
-                        auto builder =
-                            builder_.block_mesh_builder( block.id() );
-                        const auto facets_list = mesh_border_facets( block );
-                        SplitAlongSolidFacets block_splitter{ mesh, *builder };
-                        return std::make_pair(
-                            block.id(), block_splitter.split_solid_along_facets(
-                                            facets_list ) );
-                    } );
+                    blocks.push_back( &block );
                 }
-                CMVmappings mapping;
-                async::when_all( tasks )
-                    .then( [this, &mapping]( std::vector< Task > all_task ) {
-                        for( auto& task : all_task )
-                        {
-                            const auto result = task.get();
-                            auto cmv_mapping = update_unique_vertices(
-                                model_.block( result.first ),
-                                result.second.vertices );
-                            if( !cmv_mapping.empty() )
-                            {
-                                mapping.insert( mapping.end(),
-                                    std::make_move_iterator(
-                                        cmv_mapping.begin() ),
-                                    std::make_move_iterator(
-                                        cmv_mapping.end() ) );
-                            }
-                        }
-                    } )
-                    .get();
-                return mapping;
+                std::vector< std::vector< PolyhedronFacet > > facets(
+                    blocks.size() );
+                async::parallel_for(
+                    async::irange( size_t{ 0 }, blocks.size() ),
+                    [this, &blocks, &facets]( size_t b ) {
+                        facets[b] = mesh_border_facets( *blocks[b] );
+                    } );
+                std::vector< BlockSplit > splits( blocks.size() );
+                async::parallel_for(
+                    async::irange( size_t{ 0 }, blocks.size() ),
+                    [this, &blocks, &facets, &splits]( size_t b ) {
+                        splits[b] = split_block_mesh( *blocks[b], facets[b] );
+                    } );
+                return update_unique_vertices( splits );
             }
 
             CMVmappings split_block( const Block3D& block )
             {
-                const auto& mesh = block.mesh();
-                auto builder = builder_.block_mesh_builder( block.id() );
-                const auto facets_list = mesh_border_facets( block );
-                SplitAlongSolidFacets block_splitter{ mesh, *builder };
-                auto mapping =
-                    block_splitter.split_solid_along_facets( facets_list );
-                return update_unique_vertices( block, mapping.vertices );
+                std::vector< BlockSplit > splits;
+                splits.emplace_back(
+                    split_block_mesh( block, mesh_border_facets( block ) ) );
+                return update_unique_vertices( splits );
             }
 
         private:
-            CMVmappings update_unique_vertices(
-                const Block3D& block, const ElementsMapping& mapping )
+            /*!
+             * Split the Block mesh and plan the unique vertices of the created
+             * vertices. Only the given Block is modified, the unique vertices
+             * are updated later for all the Blocks at once.
+             */
+            BlockSplit split_block_mesh( const Block3D& block,
+                absl::Span< const PolyhedronFacet > facets ) const
             {
-                CMVmappings cmv_mapping;
-                for( const auto& vertex_mapping : mapping.in2out_map() )
+                auto builder = builder_.block_mesh_builder( block.id() );
+                SplitAlongSolidFacets block_splitter{ block.mesh(), *builder };
+                const auto mapping =
+                    block_splitter.split_solid_along_facets( facets );
+                BlockSplit split;
+                for( const auto& vertex_mapping :
+                    mapping.vertices.in2out_map() )
                 {
                     ComponentMeshVertex original_cmv{ block.component_id(),
                         vertex_mapping.first };
@@ -129,11 +125,32 @@ namespace geode
                         }
                         ComponentMeshVertex cmv_out{ block.component_id(),
                             vertex_out };
-                        cmv_mapping.emplace_back( original_cmv, cmv_out );
-                        builder_.set_unique_vertex( cmv_out, unique_vertex_id );
+                        split.mapping.emplace_back( original_cmv, cmv_out );
+                        split.unique_vertices.emplace_back(
+                            std::move( cmv_out ), unique_vertex_id );
                     }
                 }
-                return cmv_mapping;
+                return split;
+            }
+
+            CMVmappings update_unique_vertices(
+                std::vector< BlockSplit >& splits )
+            {
+                CMVmappings mapping;
+                UniqueVertices unique_vertices;
+                for( auto& split : splits )
+                {
+                    mapping.insert( mapping.end(),
+                        std::make_move_iterator( split.mapping.begin() ),
+                        std::make_move_iterator( split.mapping.end() ) );
+                    unique_vertices.insert( unique_vertices.end(),
+                        std::make_move_iterator(
+                            split.unique_vertices.begin() ),
+                        std::make_move_iterator(
+                            split.unique_vertices.end() ) );
+                }
+                builder_.set_unique_vertices( unique_vertices );
+                return mapping;
             }
 
             std::vector< PolyhedronFacet > mesh_border_facets(
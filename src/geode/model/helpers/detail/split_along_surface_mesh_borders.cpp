@@ -36,7 +36,10 @@
 #include <geode/mesh/core/edged_curve.hpp>
 #include <geode/mesh/core/surface_mesh.hpp>
 
+#include <geode/basic/algorithm.hpp>
+
 #include <geode/model/helpers/component_mesh_edges.hpp>
+#include <geode/model/helpers/component_mesh_vertices.hpp>
 #include <geode/model/mixin/core/line.hpp>
 #include <geode/model/mixin/core/surface.hpp>
 #include <geode/model/representation/builder/brep_builder.hpp>
@@ -54,7 +57,8 @@ namespace geode
             using CMVmapping =
                 std::pair< ComponentMeshVertex, ComponentMeshVertex >;
             using CMVmappings = std::vector< CMVmapping >;
-            using Task = async::task< CMVmappings >;
+            using UniqueVertices =
+                std::vector< std::pair< ComponentMeshVertex, index_t > >;
             using ModelBuilder = typename Model::Builder;
             static constexpr auto dimension = Model::dim;
             struct SurfaceInfo
@@ -66,6 +70,11 @@ namespace geode
                 absl::FixedArray< PolygonsAroundVertex > polygon_vertices;
                 std::vector< index_t > vertices_to_check;
             };
+            struct SurfaceSplit
+            {
+                CMVmappings mapping;
+                UniqueVertices unique_vertices;
+            };
 
         public:
             Impl( Model& model )
@@ -82,54 +91,82 @@ namespace geode
 
             CMVmappings split()
             {
-                absl::FixedArray< Task > tasks( model_.nb_surfaces() );
-                index_t count{ 0 };
+                std::vector< const Surface< dimension >* > surfaces;
+                surfaces.reserve( model_.nb_surfaces() );
                 for( const auto& surface : model_.surfaces() )
                 {
-                    tasks[count++] = async::spawn( [this, &surface] {
-                        return split_points( surface );
-                    } );
+                    surfaces.push_back( &surface );
                 }
-                CMVmappings mapping;
-                async::when_all( tasks )
-                    .then( [this, &mapping]( std::vector< Task > all_task ) {
-                        for( auto& task : all_task )
-                        {
-                            auto cmv_mappings = task.get();
-                            update_unique_vertices( cmv_mappings );
-                            mapping.insert( mapping.end(),
-                                std::make_move_iterator( cmv_mappings.begin() ),
-                                std::make_move_iterator( cmv_mappings.end() ) );
-                        }
-                    } )
-                    .get();
-                return mapping;
+                std::vector< std::vector< PolygonEdge > > internal_edges(
+                    surfaces.size() );
+                async::parallel_for(
+                    async::irange( size_t{ 0 }, surfaces.size() ),
+                    [this, &surfaces, &internal_edges]( size_t s ) {
+                        internal_edges[s] =
+                            edges_along_internal_lines( *surfaces[s] );
+                    } );
+                std::vector< SurfaceSplit > splits( surfaces.size() );
+                async::parallel_for(
+                    async::irange( size_t{ 0 }, surfaces.size() ),
+                    [this, &surfaces, &internal_edges, &splits]( size_t s ) {
+                        splits[s] = split_surface_mesh(
+                            *surfaces[s], internal_edges[s] );
+                    } );
+                return update_unique_vertices( splits );
             }
 
             CMVmappings split_surface( const Surface< dimension >& surface )
             {
-                const auto mapping = split_points( surface );
-                update_unique_vertices( mapping );
-                return mapping;
+                std::vector< SurfaceSplit > splits;
+                splits.emplace_back( split_surface_mesh(
+                    surface, edges_along_internal_lines( surface ) ) );
+                return update_unique_vertices( splits );
             }
 
         private:
-            void update_unique_vertices( const CMVmappings& mapping )
+            CMVmappings update_unique_vertices(
+                std::vector< SurfaceSplit >& splits )
             {
-                for( const auto& cmv_mapping : mapping )
+                CMVmappings mapping;
+                UniqueVertices unique_vertices;
+                for( auto& split : splits )
                 {
-                    const auto unique_vertex_id =
-                        model_.unique_vertex( cmv_mapping.first );
-                    builder_.set_unique_vertex(
-                        cmv_mapping.second, unique_vertex_id );
+                    mapping.insert( mapping.end(),
+                        std::make_move_iterator( split.mapping.begin() ),
+                        std::make_move_iterator( split.mapping.end() ) );
+                    unique_vertices.insert( unique_vertices.end(),
+                        std::make_move_iterator(
+                            split.unique_vertices.begin() ),
+                        std::make_move_iterator(
+                            split.unique_vertices.end() ) );
                 }
+                builder_.set_unique_vertices( unique_vertices );
+                return mapping;
             }
 
-            CMVmappings split_points( const Surface< dimension >& surface )
+            /*!
+             * Split the Surface mesh and plan the unique vertices of the
+             * created vertices. Only the given Surface is modified, the unique
+             * vertices are updated later for all the Surfaces at once.
+             */
+            SurfaceSplit split_surface_mesh(
+                const Surface< dimension >& surface,
+                absl::Span< const PolygonEdge > internal_edges )
             {
                 auto builder = builder_.surface_mesh_builder( surface.id() );
-                remove_adjacencies_along_internal_lines( surface, *builder );
-                return duplicate_points( surface, *builder );
+                for( const auto& edge : internal_edges )
+                {
+                    builder->unset_polygon_adjacent( edge );
+                }
+                SurfaceSplit split;
+                split.mapping = duplicate_points( surface, *builder );
+                split.unique_vertices.reserve( split.mapping.size() );
+                for( const auto& cmv_mapping : split.mapping )
+                {
+                    split.unique_vertices.emplace_back( cmv_mapping.second,
+                        model_.unique_vertex( cmv_mapping.first ) );
+                }
+                return split;
             }
 
             CMVmappings duplicate_points( const Surface< dimension >& surface,
@@ -199,40 +236,74 @@ namespace geode
                 return info;
             }
 
-            void remove_adjacencies_along_internal_lines(
-                const Surface< dimension >& surface,
-                SurfaceMeshBuilder< dimension >& builder )
+            /*!
+             * Return the polygon edges of the Surface along its internal
+             * Lines, and their adjacent edges. Only the given Surface mesh is
+             * queried, so Surfaces can be processed concurrently.
+             */
+            std::vector< PolygonEdge > edges_along_internal_lines(
+                const Surface< dimension >& surface ) const
             {
+                const auto& surface_mesh = surface.mesh();
                 std::vector< PolygonEdge > edges;
                 for( const auto& line : model_.internal_lines( surface ) )
                 {
-                    const auto& mesh = line.mesh();
-                    for( const auto edge_id : Range{ mesh.nb_edges() } )
+                    for( const auto edge_id : Range{ line.mesh().nb_edges() } )
                     {
-                        const auto model_edges =
-                            component_mesh_edges( model_, line, edge_id );
-                        const auto& surface_edges = model_edges.surface_edges;
-                        const auto it = surface_edges.find( surface.id() );
-                        if( it == surface_edges.end() )
+                        const auto unique_vertices =
+                            edge_unique_vertices( model_, line, edge_id );
+                        if( unique_vertices[0] == NO_ID
+                            || unique_vertices[1] == NO_ID )
                         {
                             continue;
                         }
-                        for( auto& edge : it->second )
+                        for( const auto& edge :
+                            surface_edges( surface, unique_vertices ) )
                         {
                             edges.push_back( edge );
                             if( const auto adj_edge =
-                                    surface.mesh().polygon_adjacent_edge(
-                                        edge ) )
+                                    surface_mesh.polygon_adjacent_edge( edge ) )
                             {
                                 edges.push_back( adj_edge.value() );
                             }
                         }
                     }
                 }
-                for( const auto& edge : edges )
+                return edges;
+            }
+
+            std::vector< PolygonEdge > surface_edges(
+                const Surface< dimension >& surface,
+                const std::array< index_t, 2 >& unique_vertices ) const
+            {
+                const auto& mesh = surface.mesh();
+                std::vector< PolygonEdge > edges;
+                for( const auto& surface_pair : component_mesh_vertex_pairs(
+                         model_.component_mesh_vertices( unique_vertices[0] ),
+                         model_.component_mesh_vertices( unique_vertices[1] ),
+                         Surface< dimension >::component_type_static() ) )
                 {
-                    builder.unset_polygon_adjacent( edge );
+                    if( surface_pair.first.id() != surface.id() )
+                    {
+                        continue;
+                    }
+                    for( const auto& pair : surface_pair.second )
+                    {
+                        if( auto edge = mesh.polygon_edge_from_vertices(
+                                pair[0], pair[1] ) )
+                        {
+                            edges.emplace_back( std::move( edge.value() ) );
+                            continue;
+                        }
+                        if( auto edge = mesh.polygon_edge_from_vertices(
+                                pair[1], pair[0] ) )
+                        {
+                            edges.emplace_back( std::move( edge.value() ) );
+                        }
+                    }
                 }
+                sort_unique( edges );
+                return edges;
             }
 
             CMVmapping process_component( const Surface< dimension >& surface,
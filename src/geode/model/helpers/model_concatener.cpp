@@ -23,196 +23,152 @@
 
 #include <geode/model/helpers/model_concatener.hpp>
 
+#include <array>
+
+#include <absl/container/fixed_array.h>
+
+#include <async++.h>
+
 #include <geode/basic/pimpl_impl.hpp>
 
+#include <geode/mesh/core/edged_curve.hpp>
+#include <geode/mesh/core/point_set.hpp>
+#include <geode/mesh/core/solid_mesh.hpp>
+#include <geode/mesh/core/surface_mesh.hpp>
+
 #include <geode/model/mixin/core/block.hpp>
 #include <geode/model/mixin/core/corner.hpp>
 #include <geode/model/mixin/core/line.hpp>
-#include <geode/model/mixin/core/model_boundary.hpp>
 #include <geode/model/mixin/core/surface.hpp>
 #include <geode/model/representation/builder/brep_builder.hpp>
-#include <geode/model/representation/builder/detail/copy.hpp>
 #include <geode/model/representation/builder/section_builder.hpp>
 #include <geode/model/representation/core/brep.hpp>
 #include <geode/model/representation/core/section.hpp>
 
-namespace
-{
-    void copy_model_boundaries_relationships2d( geode::Section& model,
-        geode::SectionBuilder& builder,
-        const geode::Section& other_model,
-        const geode::ModelCopyMapping& mapping )
-    {
-        const auto& line_mapping =
-            mapping.at( geode::Line2D::component_type_static() );
-        const auto& boundary_mapping =
-            mapping.at( geode::ModelBoundary2D::component_type_static() );
-        for( const auto& model_boundary : other_model.model_boundaries() )
-        {
-            const auto& boundary_copy = model.model_boundary(
-                boundary_mapping.in2out( model_boundary.id() ) );
-            for( const auto& item :
-                other_model.model_boundary_items( model_boundary ) )
-            {
-                const auto& item_copy =
-                    model.line( line_mapping.in2out( item.id() ) );
-                builder.add_line_in_model_boundary( item_copy, boundary_copy );
-            }
-        }
-    }
-
-    void copy_model_boundaries_relationships3d( geode::BRep& model,
-        geode::BRepBuilder& builder,
-        const geode::BRep& other_model,
-        const geode::ModelCopyMapping& mapping )
-    {
-        const auto& surface_mapping =
-            mapping.at( geode::Surface3D::component_type_static() );
-        const auto& boundary_mapping =
-            mapping.at( geode::ModelBoundary2D::component_type_static() );
-        for( const auto& model_boundary : other_model.model_boundaries() )
-        {
-            const auto& boundary_copy = model.model_boundary(
-                boundary_mapping.in2out( model_boundary.id() ) );
-            for( const auto& item :
-                other_model.model_boundary_items( model_boundary ) )
-            {
-                const auto& item_copy =
-                    model.surface( surface_mapping.in2out( item.id() ) );
-                builder.add_surface_in_model_boundary(
-                    item_copy, boundary_copy );
-            }
-        }
-    }
-
-    void copy_block_relationships( geode::BRep& model,
-        geode::BRepBuilder& builder,
-        const geode::BRep& other_model,
-        const geode::ModelCopyMapping& mapping )
-    {
-        const auto& corner_mapping =
-            mapping.at( geode::Corner3D::component_type_static() );
-        const auto& line_mapping =
-            mapping.at( geode::Line3D::component_type_static() );
-        const auto& surface_mapping =
-            mapping.at( geode::Surface3D::component_type_static() );
-        const auto& block_mapping =
-            mapping.at( geode::Block3D::component_type_static() );
-        for( const auto& block : other_model.blocks() )
-        {
-            const auto& block_copy =
-                model.block( block_mapping.in2out( block.id() ) );
-            for( const auto& surface : other_model.boundaries( block ) )
-            {
-                const auto& surface_copy =
-                    model.surface( surface_mapping.in2out( surface.id() ) );
-                builder.add_surface_block_boundary_relationship(
-                    surface_copy, block_copy );
-            }
-            for( const auto& surface : other_model.internal_surfaces( block ) )
-            {
-                const auto& surface_copy =
-                    model.surface( surface_mapping.in2out( surface.id() ) );
-                builder.add_surface_block_internal_relationship(
-                    surface_copy, block_copy );
-            }
-            for( const auto& line : other_model.internal_lines( block ) )
-            {
-                const auto& line_copy =
-                    model.line( line_mapping.in2out( line.id() ) );
-                builder.add_line_block_internal_relationship(
-                    line_copy, block_copy );
-            }
-            for( const auto& corner : other_model.internal_corners( block ) )
-            {
-                const auto& corner_copy =
-                    model.corner( corner_mapping.in2out( corner.id() ) );
-                builder.add_corner_block_internal_relationship(
-                    corner_copy, block_copy );
-            }
-        }
-    }
-} // namespace
-
 namespace geode
 {
     template < typename Model >
     class ModelConcatener< Model >::Impl
     {
         using ModelBuilder = typename Model::Builder;
+        using Models =
+            absl::Span< const std::reference_wrapper< const Model > >;
         static constexpr auto dimension = Model::dim;
 
     public:
         Impl( Model& model ) : model_( model ), builder_{ model } {}
 
-        ModelCopyMapping concatenate( const Model& other_model )
+        std::vector< ModelCopyMapping > concatenate( Models other_models )
         {
-            auto mapping = builder_.copy_components( other_model );
-            builder_.copy_component_geometry( mapping, other_model );
-            copy_relationships( other_model, mapping );
-            return mapping;
+            std::vector< ModelCopyMapping > mappings;
+            mappings.reserve( other_models.size() );
+            for( const auto& other_model : other_models )
+            {
+                mappings.emplace_back(
+                    builder_.copy_components( other_model.get() ) );
+            }
+            copy_meshes( other_models, mappings );
+            copy_unique_vertices( other_models, mappings );
+            for( const auto m : Indices{ other_models } )
+            {
+                builder_.append_relationships(
+                    mappings[m], other_models[m].get() );
+            }
+            return mappings;
         }
 
     private:
-        void copy_relationships(
-            const Model& other_model, const ModelCopyMapping& mapping );
-
-        void copy_line_relationships(
-            const Model& other_model, const ModelCopyMapping& mapping )
+        /*!
+         * Clone the meshes of a component type from all the models at once
+         * and give them to their copied components.
+         */
+        template < typename Component,
+            typename ComponentsGetter,
+            typename MeshUpdater >
+        void copy_component_meshes( Models other_models,
+            absl::Span< const ModelCopyMapping > mappings,
+            const ComponentsGetter& components,
+            const MeshUpdater& update_mesh )
         {
-            const auto& corner_mapping =
-                mapping.at( Corner< dimension >::component_type_static() );
-            const auto& line_mapping =
-                mapping.at( Line< dimension >::component_type_static() );
-            for( const auto& line : other_model.lines() )
+            using Mesh = std::remove_const_t< std::remove_reference_t<
+                decltype( std::declval< const Component& >().mesh() ) > >;
+            std::vector< std::pair< const Component*, const uuid* > > sources;
+            for( const auto m : Indices{ other_models } )
             {
-                const auto& line_copy =
-                    model_.line( line_mapping.in2out( line.id() ) );
-                for( const auto& corner : other_model.boundaries( line ) )
+                const auto& mapping =
+                    mappings[m].at( Component::component_type_static() );
+                for( const auto& component :
+                    components( other_models[m].get() ) )
                 {
-                    const auto& corner_copy =
-                        model_.corner( corner_mapping.in2out( corner.id() ) );
-                    builder_.add_corner_line_boundary_relationship(
-                        corner_copy, line_copy );
+                    sources.emplace_back(
+                        &component, &mapping.in2out( component.id() ) );
                 }
             }
+            absl::FixedArray< std::unique_ptr< Mesh > > meshes(
+                sources.size() );
+            async::parallel_for(
+                async::irange( size_t{ 0 }, sources.size() ),
+                [&sources, &meshes]( size_t s ) {
+                    meshes[s] = sources[s].first->mesh().clone();
+                } );
+            for( const auto s : Indices{ sources } )
+            {
+                update_mesh( *sources[s].second, std::move( meshes[s] ) );
+            }
         }
 
-        void copy_surface_relationships(
-            const Model& other_model, const ModelCopyMapping& mapping )
+        void copy_meshes( Models other_models,
+            absl::Span< const ModelCopyMapping > mappings )
         {
-            const auto& corner_mapping =
-                mapping.at( Corner< dimension >::component_type_static() );
-            const auto& line_mapping =
-                mapping.at( Line< dimension >::component_type_static() );
-            const auto& surface_mapping =
-                mapping.at( Surface< dimension >::component_type_static() );
-            for( const auto& surface : other_model.surfaces() )
+            copy_component_meshes< Corner< dimension > >(
+                other_models, mappings,
+                []( const Model& model ) {
+                    return model.corners();
+                },
+                [this]( const uuid& id, auto mesh ) {
+                    builder_.update_corner_mesh(
+                        model_.corner( id ), std::move( mesh ) );
+                } );
+            copy_component_meshes< Line< dimension > >(
+                other_models, mappings,
+                []( const Model& model ) {
+                    return model.lines();
+                },
+                [this]( const uuid& id, auto mesh ) {
+                    builder_.update_line_mesh(
+                        model_.line( id ), std::move( mesh ) );
+                } );
+            copy_component_meshes< Surface< dimension > >(
+                other_models, mappings,
+                []( const Model& model ) {
+                    return model.surfaces();
+                },
+                [this]( const uuid& id, auto mesh ) {
+                    builder_.update_surface_mesh(
+                        model_.surface( id ), std::move( mesh ) );
+                } );
+            copy_block_meshes( other_models, mappings );
+        }
+
+        void copy_block_meshes( Models other_models,
+            absl::Span< const ModelCopyMapping > mappings );
+
+        void copy_unique_vertices( Models other_models,
+            absl::Span< const ModelCopyMapping > mappings )
+        {
+            index_t nb_unique_vertices{ 0 };
+            for( const auto& other_model : other_models )
             {
-                const auto& surface_copy =
-                    model_.surface( surface_mapping.in2out( surface.id() ) );
-                for( const auto& line : other_model.boundaries( surface ) )
-                {
-                    const auto& line_copy =
-                        model_.line( line_mapping.in2out( line.id() ) );
-                    builder_.add_line_surface_boundary_relationship(
-                        line_copy, surface_copy );
-                }
-                for( const auto& line : other_model.internal_lines( surface ) )
-                {
-                    const auto& line_copy =
-                        model_.line( line_mapping.in2out( line.id() ) );
-                    builder_.add_line_surface_internal_relationship(
-                        line_copy, surface_copy );
-                }
-                for( const auto& corner :
-                    other_model.internal_corners( surface ) )
-                {
-                    const auto& corner_copy =
-                        model_.corner( corner_mapping.in2out( corner.id() ) );
-                    builder_.add_corner_surface_internal_relationship(
-                        corner_copy, surface_copy );
-                }
+                nb_unique_vertices += other_model.get().nb_unique_vertices();
+            }
+            auto first_unique_vertex =
+                builder_.create_unique_vertices( nb_unique_vertices );
+            for( const auto m : Indices{ other_models } )
+            {
+                const auto& other_model = other_models[m].get();
+                builder_.copy_unique_vertices(
+                    other_model, first_unique_vertex, mappings[m] );
+                first_unique_vertex += other_model.nb_unique_vertices();
             }
         }
 
@@ -222,24 +178,24 @@ namespace geode
     };
 
     template <>
-    void ModelConcatener< Section >::Impl::copy_relationships(
-        const Section& other_model, const ModelCopyMapping& mapping )
+    void ModelConcatener< Section >::Impl::copy_block_meshes(
+        Models /*unused*/, absl::Span< const ModelCopyMapping > /*unused*/ )
     {
-        copy_line_relationships( other_model, mapping );
-        copy_surface_relationships( other_model, mapping );
-        copy_model_boundaries_relationships2d(
-            model_, builder_, other_model, mapping );
     }
 
     template <>
-    void ModelConcatener< BRep >::Impl::copy_relationships(
-        const BRep& other_model, const ModelCopyMapping& mapping )
+    void ModelConcatener< BRep >::Impl::copy_block_meshes( Models other_models,
+        absl::Span< const ModelCopyMapping > mappings )
     {
-        copy_line_relationships( other_model, mapping );
-        copy_surface_relationships( other_model, mapping );
-        copy_block_relationships( model_, builder_, other_model, mapping );
-        copy_model_boundaries_relationships3d(
-            model_, builder_, other_model, mapping );
+        copy_component_meshes< Block3D >(
+            other_models, mappings,
+            []( const BRep& model ) {
+                return model.blocks();
+            },
+            [this]( const uuid& id, std::unique_ptr< SolidMesh3D > mesh ) {
+                builder_.update_block_mesh(
+                    model_.block( id ), std::move( mesh ) );
+            } );
     }
 
     template < typename Model >
@@ -256,9 +212,18 @@ namespace geode
     ModelCopyMapping ModelConcatener< Model >::concatenate(
         const Model& other_model )
     {
-        return impl_->concatenate( other_model );
+        const std::array< std::reference_wrapper< const Model >, 1 >
+            other_models{ { std::cref( other_model ) } };
+        return std::move( impl_->concatenate( other_models ).front() );
+    }
+
+    template < typename Model >
+    std::vector< ModelCopyMapping > ModelConcatener< Model >::concatenate(
+        absl::Span< const std::reference_wrapper< const Model > > other_models )
+    {
+        return impl_->concatenate( other_models );
     }
 
     template class opengeode_model_api ModelConcatener< BRep >;
     template class opengeode_model_api ModelConcatener< Section >;
-} // namespace geode
\ No newline at end of file
+} // namespace geode
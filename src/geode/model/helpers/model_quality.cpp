@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#include <geode/model/helpers/model_quality.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include <async++.h>
+
+#include <absl/algorithm/container.h>
+#include <absl/container/fixed_array.h>
+
+#include <geode/basic/attribute_manager.hpp>
+#include <geode/basic/range.hpp>
+#include <geode/basic/variable_attribute.hpp>
+
+#include <geode/mesh/core/solid_mesh.hpp>
+#include <geode/mesh/core/surface_mesh.hpp>
+
+#include <geode/model/mixin/core/block.hpp>
+#include <geode/model/mixin/core/surface.hpp>
+#include <geode/model/representation/core/brep.hpp>
+#include <geode/model/representation/core/section.hpp>
+
+namespace
+{
+    template < typename Component,
+        typename ValuesComputer,
+        typename ManagerGetter >
+    geode::ModelQualityReport components_quality_report(
+        absl::Span< const Component* const > components,
+        geode::QUALITY_METRIC metric,
+        const geode::QualityReportParameters& parameters,
+        const ValuesComputer& compute_values,
+        const ManagerGetter& attribute_manager )
+    {
+        absl::FixedArray< std::vector< double > > values( components.size() );
+        async::parallel_for( async::irange( size_t{ 0 }, components.size() ),
+            [&components, &values, &parameters, &compute_values,
+                &attribute_manager]( size_t c ) {
+                values[c] = compute_values( *components[c] );
+                if( parameters.attribute_name.empty() )
+                {
+                    return;
+                }
+                auto attribute =
+                    attribute_manager( *components[c] )
+                        .template find_or_create_attribute<
+                            geode::VariableAttribute, double >(
+                            parameters.attribute_name, std::nan( "" ) );
+                for( const auto e : geode::Indices{ values[c] } )
+                {
+                    attribute->set_value( e, values[c][e] );
+                }
+            } );
+        std::vector< geode::index_t > offsets( components.size() + 1, 0 );
+        for( const auto c : geode::Indices{ components } )
+        {
+            offsets[c + 1] =
+                offsets[c] + geode::checked_index( values[c].size() );
+        }
+        std::vector< double > all_values( offsets.back() );
+        async::parallel_for( async::irange( size_t{ 0 }, components.size() ),
+            [&values, &offsets, &all_values]( size_t c ) {
+                absl::c_copy( values[c], all_values.begin() + offsets[c] );
+            } );
+        const auto mesh_report = geode::quality_report(
+            all_values, geode::is_lower_quality_worse( metric ), parameters );
+        geode::ModelQualityReport report;
+        report.nb_elements = mesh_report.nb_elements;
+        report.nb_degenerate_elements = mesh_report.nb_degenerate_elements;
+        report.min = mesh_report.min;
+        report.max = mesh_report.max;
+        report.mean = mesh_report.mean;
+        report.percentiles = mesh_report.percentiles;
+        report.histogram = mesh_report.histogram;
+        report.worst_elements.reserve( mesh_report.worst_elements.size() );
+        for( const auto& [element, value] : mesh_report.worst_elements )
+        {
+            const auto component = geode::checked_index(
+                std::upper_bound( offsets.begin(), offsets.end(), element )
+                - offsets.begin() - 1 );
+            report.worst_elements.emplace_back(
+                geode::ComponentMeshElement{
+                    components[component]->component_id(),
+                    element - offsets[component] },
+                value );
+        }
+        return report;
+    }
+
+    template < typename Range >
+    auto component_pointers( Range&& range )
+    {
+        std::vector< const std::remove_const_t<
+            std::remove_reference_t< decltype( *range.begin() ) > >* >
+            result;
+        for( const auto& component : range )
+        {
+            result.push_back( &component );
+        }
+        return result;
+    }
+
+    template < typename Model >
+    geode::ModelQualityReport model_surfaces_quality_report(
+        const Model& model,
+        geode::QUALITY_METRIC metric,
+        const geode::QualityReportParameters& parameters )
+    {
+        const auto surfaces = component_pointers( model.surfaces() );
+        return components_quality_report(
+            absl::MakeConstSpan( surfaces ), metric, parameters,
+            [metric]( const auto& surface ) {
+                return geode::surface_quality_values( surface.mesh(), metric );
+            },
+            []( const auto& surface ) -> geode::AttributeManager& {
+                return surface.mesh().polygon_attribute_manager();
+            } );
+    }
+} // namespace
+
+namespace geode
+{
+    ModelQualityReport blocks_quality_report( const BRep& brep,
+        QUALITY_METRIC metric,
+        const QualityReportParameters& parameters )
+    {
+        const auto blocks = component_pointers( brep.blocks() );
+        return components_quality_report( absl::MakeConstSpan( blocks ),
+            metric, parameters, [metric]( const Block3D& block ) {
+                return solid_quality_values( block.mesh(), metric );
+            },
+            []( const Block3D& block ) -> AttributeManager& {
+                return block.mesh().polyhedron_attribute_manager();
+            } );
+    }
+
+    ModelQualityReport surfaces_quality_report( const BRep& brep,
+        QUALITY_METRIC metric,
+        const QualityReportParameters& parameters )
+    {
+        return model_surfaces_quality_report( brep, metric, parameters );
+    }
+
+    ModelQualityReport surfaces_quality_report( const Section& section,
+        QUALITY_METRIC metric,
+        const QualityReportParameters& parameters )
+    {
+        return model_surfaces_quality_report( section, metric, parameters );
+    }
+} // namespace geode
@@ -0,0 +1,614 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/model/helpers/model_validity.hpp>
+
+#include <algorithm>
+
+#include <async++.h>
+
+#include <absl/algorithm/container.h>
+#include <absl/container/fixed_array.h>
+#include <absl/container/flat_hash_map.h>
+#include <absl/strings/str_cat.h>
+#include <absl/types/span.h>
+
+#include <geode/basic/range.hpp>
+
+#include <geode/mesh/core/edged_curve.hpp>
+#include <geode/mesh/core/point_set.hpp>
+#include <geode/mesh/core/solid_mesh.hpp>
+#include <geode/mesh/core/surface_mesh.hpp>
+
+#include <geode/model/helpers/brep_incidence_index.hpp>
+#include <geode/model/helpers/component_mesh_polygons.hpp>
+#include <geode/model/mixin/core/block.hpp>
+#include <geode/model/mixin/core/corner.hpp>
+#include <geode/model/mixin/core/line.hpp>
+#include <geode/model/mixin/core/surface.hpp>
+#include <geode/model/representation/core/brep.hpp>
+#include <geode/model/representation/core/section.hpp>
+
+namespace
+{
+    constexpr geode::index_t UNIQUE_VERTEX_CHUNK_SIZE{ 4096 };
+
+    using RelationRules =
+        std::vector< std::pair< geode::ComponentType, geode::ComponentType > >;
+
+    template < typename Issue >
+    void concatenate( absl::Span< std::vector< Issue > > issues,
+        std::vector< Issue >& output )
+    {
+        for( auto& component_issues : issues )
+        {
+            for( auto& issue : component_issues )
+            {
+                output.emplace_back( std::move( issue ) );
+            }
+        }
+    }
+
+    /*!
+     * Data shared by all the checks, computed once per model.
+     */
+    struct ModelIndex
+    {
+        template < typename Model >
+        explicit ModelIndex( const Model& model )
+        {
+            add_components( model.corners() );
+            add_components( model.lines() );
+            add_components( model.surfaces() );
+            if constexpr( Model::dim == 3 )
+            {
+                add_components( model.blocks() );
+            }
+        }
+
+        template < typename Range >
+        void add_components( Range&& range )
+        {
+            for( const auto& component : range )
+            {
+                nb_vertices.emplace(
+                    component.id(), component.mesh().nb_vertices() );
+                components.emplace_back( component.component_id() );
+            }
+        }
+
+        std::vector< geode::ComponentID > components;
+        absl::flat_hash_map< geode::uuid, geode::index_t > nb_vertices;
+    };
+
+    template < typename Model >
+    void check_component_vertices( const Model& model,
+        const ModelIndex& index,
+        geode::ModelValidityReport& report )
+    {
+        absl::FixedArray< std::vector< geode::ComponentMeshVertex > > issues(
+            index.components.size() );
+        async::parallel_for(
+            async::irange( size_t{ 0 }, index.components.size() ),
+            [&model, &index, &issues]( size_t c ) {
+                const auto& component_id = index.components[c];
+                for( const auto v :
+                    geode::Range{ index.nb_vertices.at( component_id.id() ) } )
+                {
+                    geode::ComponentMeshVertex cmv{ component_id, v };
+                    const auto unique_vertex = model.unique_vertex( cmv );
+                    if( unique_vertex >= model.nb_unique_vertices() )
+                    {
+                        issues[c].emplace_back( std::move( cmv ) );
+                        continue;
+                    }
+                    const auto& cmvs =
+                        model.component_mesh_vertices( unique_vertex );
+                    if( absl::c_find( cmvs, cmv ) == cmvs.end() )
+                    {
+                        issues[c].emplace_back( std::move( cmv ) );
+                    }
+                }
+            } );
+        concatenate( absl::MakeSpan( issues ),
+            report.inconsistent_component_vertices );
+    }
+
+    template < typename Model >
+    void check_unique_vertices( const Model& model,
+        const ModelIndex& index,
+        geode::ModelValidityReport& report )
+    {
+        const auto nb_unique_vertices = model.nb_unique_vertices();
+        const auto nb_chunks =
+            ( nb_unique_vertices + UNIQUE_VERTEX_CHUNK_SIZE - 1 )
+            / UNIQUE_VERTEX_CHUNK_SIZE;
+        absl::FixedArray< std::vector< geode::index_t > > issues( nb_chunks );
+        async::parallel_for( async::irange( geode::index_t{ 0 }, nb_chunks ),
+            [&model, &index, &issues, nb_unique_vertices]( geode::index_t c ) {
+                const auto begin = c * UNIQUE_VERTEX_CHUNK_SIZE;
+                const auto end = std::min(
+                    begin + UNIQUE_VERTEX_CHUNK_SIZE, nb_unique_vertices );
+                for( const auto unique_vertex : geode::Range{ begin, end } )
+                {
+                    for( const auto& cmv :
+                        model.component_mesh_vertices( unique_vertex ) )
+                    {
+                        const auto nb_vertices =
+                            index.nb_vertices.find( cmv.component_id.id() );
+                        if( nb_vertices == index.nb_vertices.end()
+                            || cmv.vertex >= nb_vertices->second
+                            || model.unique_vertex( cmv ) != unique_vertex )
+                        {
+                            issues[c].push_back( unique_vertex );
+                            break;
+                        }
+                    }
+                }
+            } );
+        concatenate(
+            absl::MakeSpan( issues ), report.inconsistent_unique_vertices );
+    }
+
+    template < typename Relations >
+    bool contains( Relations&& relations, const geode::ComponentID& id )
+    {
+        for( const auto& relation : relations )
+        {
+            if( relation == id )
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool is_allowed( const RelationRules& rules,
+        const geode::ComponentID& parent,
+        const geode::ComponentID& child )
+    {
+        return absl::c_find( rules, std::make_pair( parent.type(),
+                                        child.type() ) )
+               != rules.end();
+    }
+
+    void check_relations( const geode::Relationships& relationships,
+        const ModelIndex& index,
+        const RelationRules& boundary_rules,
+        const RelationRules& internal_rules,
+        geode::ModelValidityReport& report )
+    {
+        using Relation = std::pair< geode::ComponentID, geode::ComponentID >;
+        absl::FixedArray< std::vector< Relation > > issues(
+            index.components.size() );
+        async::parallel_for(
+            async::irange( size_t{ 0 }, index.components.size() ),
+            [&relationships, &index, &boundary_rules, &internal_rules,
+                &issues]( size_t c ) {
+                const auto& component_id = index.components[c];
+                const auto& id = component_id.id();
+                for( const auto& boundary : relationships.boundaries( id ) )
+                {
+                    if( !is_allowed( boundary_rules, component_id, boundary )
+                        || !contains( relationships.incidences( boundary.id() ),
+                            component_id ) )
+                    {
+                        issues[c].emplace_back( boundary, component_id );
+                    }
+                }
+                for( const auto& internal : relationships.internals( id ) )
+                {
+                    if( !is_allowed( internal_rules, component_id, internal )
+                        || !contains( relationships.embeddings( internal.id() ),
+                            component_id ) )
+                    {
+                        issues[c].emplace_back( internal, component_id );
+                    }
+                }
+            } );
+        concatenate( absl::MakeSpan( issues ), report.invalid_relations );
+    }
+
+    struct MeshIssues
+    {
+        std::vector< geode::ComponentMeshElement > adjacencies;
+        std::vector< geode::ComponentMeshVertex > vertices;
+    };
+
+    template < geode::index_t dimension >
+    void check_surface_mesh(
+        const geode::Surface< dimension >& surface, MeshIssues& issues )
+    {
+        const auto& mesh = surface.mesh();
+        std::vector< geode::index_t > nb_incident_polygons(
+            mesh.nb_vertices(), 0 );
+        for( const auto p : geode::Range{ mesh.nb_polygons() } )
+        {
+            bool reciprocal{ true };
+            for( const auto e : geode::LRange{ mesh.nb_polygon_edges( p ) } )
+            {
+                nb_incident_polygons[mesh.polygon_vertex( { p, e } )]++;
+                const geode::PolygonEdge edge{ p, e };
+                if( const auto adjacent = mesh.polygon_adjacent_edge( edge ) )
+                {
+                    reciprocal = reciprocal
+                                 && mesh.polygon_adjacent_edge( *adjacent )
+                                        == std::optional{ edge };
+                }
+            }
+            if( !reciprocal )
+            {
+                issues.adjacencies.emplace_back( surface.component_id(), p );
+            }
+        }
+        if( !issues.adjacencies.empty() )
+        {
+            return;
+        }
+        for( const auto v : geode::Range{ mesh.nb_vertices() } )
+        {
+            if( mesh.polygons_around_vertex( v ).size()
+                != nb_incident_polygons[v] )
+            {
+                issues.vertices.emplace_back( surface.component_id(), v );
+            }
+        }
+    }
+
+    void check_block_mesh( const geode::Block3D& block, MeshIssues& issues )
+    {
+        const auto& mesh = block.mesh();
+        std::vector< geode::index_t > nb_incident_polyhedra(
+            mesh.nb_vertices(), 0 );
+        for( const auto p : geode::Range{ mesh.nb_polyhedra() } )
+        {
+            for( const auto v :
+                geode::LRange{ mesh.nb_polyhedron_vertices( p ) } )
+            {
+                nb_incident_polyhedra[mesh.polyhedron_vertex( { p, v } )]++;
+            }
+            bool reciprocal{ true };
+            for( const auto f :
+                geode::LRange{ mesh.nb_polyhedron_facets( p ) } )
+            {
+                const geode::PolyhedronFacet facet{ p, f };
+                if( const auto adjacent =
+                        mesh.polyhedron_adjacent_facet( facet ) )
+                {
+                    reciprocal = reciprocal
+                                 && mesh.polyhedron_adjacent_facet( *adjacent )
+                                        == std::optional{ facet };
+                }
+            }
+            if( !reciprocal )
+            {
+                issues.adjacencies.emplace_back( block.component_id(), p );
+            }
+        }
+        if( !issues.adjacencies.empty() )
+        {
+            return;
+        }
+        for( const auto v : geode::Range{ mesh.nb_vertices() } )
+        {
+            if( mesh.polyhedra_around_vertex( v ).size()
+                != nb_incident_polyhedra[v] )
+            {
+                issues.vertices.emplace_back( block.component_id(), v );
+            }
+        }
+    }
+
+    template < typename Component, typename Checker >
+    void check_meshes( absl::Span< const Component* const > components,
+        const Checker& checker,
+        geode::ModelValidityReport& report )
+    {
+        absl::FixedArray< MeshIssues > issues( components.size() );
+        async::parallel_for( async::irange( size_t{ 0 }, components.size() ),
+            [&components, &checker, &issues]( size_t c ) {
+                checker( *components[c], issues[c] );
+            } );
+        for( auto& component_issues : issues )
+        {
+            for( auto& adjacency : component_issues.adjacencies )
+            {
+                report.non_reciprocal_adjacencies.emplace_back(
+                    std::move( adjacency ) );
+            }
+            for( auto& vertex : component_issues.vertices )
+            {
+                report.non_manifold_vertices.emplace_back(
+                    std::move( vertex ) );
+            }
+        }
+    }
+
+    template < typename Range >
+    auto component_pointers( Range&& range )
+    {
+        std::vector< std::decay_t< decltype( &*range.begin() ) > > pointers;
+        for( const auto& component : range )
+        {
+            pointers.push_back( &component );
+        }
+        return pointers;
+    }
+
+    using ConformityIssue =
+        std::pair< geode::ComponentMeshElement, geode::ComponentID >;
+
+    /*!
+     * Check the line edges of a Surface, lines are processed sequentially
+     * since they all query the Surface mesh.
+     */
+    template < typename Model, typename EdgesGetter >
+    void check_surface_lines( const Model& model,
+        const geode::Surface< Model::dim >& surface,
+        const EdgesGetter& surface_edges,
+        std::vector< ConformityIssue >& issues )
+    {
+        const auto check_line = [&surface, &surface_edges, &issues](
+                                    const geode::Line< Model::dim >& line,
+                                    size_t expected_nb_edges ) {
+            for( const auto e : geode::Range{ line.mesh().nb_edges() } )
+            {
+                if( surface_edges( surface, line, e ).size()
+                    != expected_nb_edges )
+                {
+                    issues.emplace_back(
+                        geode::ComponentMeshElement{ line.component_id(), e },
+                        surface.component_id() );
+                }
+            }
+        };
+        for( const auto& line : model.boundaries( surface ) )
+        {
+            check_line( line, 1 );
+        }
+        for( const auto& line : model.internal_lines( surface ) )
+        {
+            check_line( line, 2 );
+        }
+    }
+
+    template < typename Model, typename EdgesGetter >
+    void check_line_conformity( const Model& model,
+        const EdgesGetter& surface_edges,
+        geode::ModelValidityReport& report )
+    {
+        const auto surfaces = component_pointers( model.surfaces() );
+        absl::FixedArray< std::vector< ConformityIssue > > issues(
+            surfaces.size() );
+        async::parallel_for( async::irange( size_t{ 0 }, surfaces.size() ),
+            [&model, &surface_edges, &surfaces, &issues]( size_t s ) {
+                check_surface_lines(
+                    model, *surfaces[s], surface_edges, issues[s] );
+            } );
+        concatenate(
+            absl::MakeSpan( issues ), report.non_conformal_line_edges );
+    }
+
+    void check_surface_conformity( const geode::BRep& brep,
+        const geode::BRepIncidenceIndex& incidences,
+        geode::BRepValidityReport& report )
+    {
+        const auto blocks = component_pointers( brep.blocks() );
+        absl::FixedArray< std::vector< ConformityIssue > > issues(
+            blocks.size() );
+        async::parallel_for( async::irange( size_t{ 0 }, blocks.size() ),
+            [&brep, &incidences, &blocks, &issues]( size_t b ) {
+                const auto& block = *blocks[b];
+                const auto check_surface = [&block, &incidences,
+                                               &block_issues = issues[b]](
+                                               const geode::Surface3D& surface,
+                                               size_t expected_nb_facets ) {
+                    for( const auto p :
+                        geode::Range{ surface.mesh().nb_polygons() } )
+                    {
+                        if( incidences
+                                .block_vertices_from_surface_polygon(
+                                    block, surface, p )
+                                .size()
+                            != expected_nb_facets )
+                        {
+                            block_issues.emplace_back(
+                                geode::ComponentMeshElement{
+                                    surface.component_id(), p },
+                                block.component_id() );
+                        }
+                    }
+                };
+                for( const auto& surface : brep.boundaries( block ) )
+                {
+                    check_surface( surface, 1 );
+                }
+                for( const auto& surface : brep.internal_surfaces( block ) )
+                {
+                    check_surface( surface, 2 );
+                }
+            } );
+        concatenate(
+            absl::MakeSpan( issues ), report.non_conformal_surface_polygons );
+    }
+
+    template < typename Model >
+    void check_model( const Model& model,
+        const ModelIndex& index,
+        const RelationRules& boundary_rules,
+        const RelationRules& internal_rules,
+        geode::ModelValidityReport& report )
+    {
+        check_component_vertices( model, index, report );
+        check_unique_vertices( model, index, report );
+        check_relations( model, index, boundary_rules, internal_rules, report );
+        check_meshes< geode::Surface< Model::dim > >(
+            component_pointers( model.surfaces() ),
+            []( const geode::Surface< Model::dim >& surface,
+                MeshIssues& issues ) { check_surface_mesh( surface, issues ); },
+            report );
+    }
+
+    template < typename Issues >
+    std::string issues_string( std::string_view name, const Issues& issues )
+    {
+        if( issues.empty() )
+        {
+            return {};
+        }
+        return absl::StrCat( "\n", issues.size(), " ", name );
+    }
+
+    std::string model_issues_string( const geode::ModelValidityReport& report )
+    {
+        return absl::StrCat(
+            issues_string( "inconsistent component mesh vertices",
+                report.inconsistent_component_vertices ),
+            issues_string( "inconsistent unique vertices",
+                report.inconsistent_unique_vertices ),
+            issues_string( "invalid relations", report.invalid_relations ),
+            issues_string( "non reciprocal mesh adjacencies",
+                report.non_reciprocal_adjacencies ),
+            issues_string(
+                "non manifold vertices", report.non_manifold_vertices ),
+            issues_string(
+                "non conformal line edges", report.non_conformal_line_edges ) );
+    }
+} // namespace
+
+namespace geode
+{
+    bool ModelValidityReport::is_valid() const
+    {
+        return inconsistent_component_vertices.empty()
+               && inconsistent_unique_vertices.empty()
+               && invalid_relations.empty()
+               && non_reciprocal_adjacencies.empty()
+               && non_manifold_vertices.empty()
+               && non_conformal_line_edges.empty();
+    }
+
+    std::string ModelValidityReport::string() const
+    {
+        if( is_valid() )
+        {
+            return "Model is valid";
+        }
+        return absl::StrCat(
+            "Model is invalid:", model_issues_string( *this ) );
+    }
+
+    bool BRepValidityReport::is_valid() const
+    {
+        return ModelValidityReport::is_valid()
+               && non_conformal_surface_polygons.empty();
+    }
+
+    std::string BRepValidityReport::string() const
+    {
+        if( is_valid() )
+        {
+            return "Model is valid";
+        }
+        return absl::StrCat( "Model is invalid:", model_issues_string( *this ),
+            issues_string( "non conformal surface polygons",
+                non_conformal_surface_polygons ) );
+    }
+
+    SectionValidityReport section_validity_report( const Section& section )
+    {
+        const ModelIndex index{ section };
+        const RelationRules boundary_rules{
+            { Surface2D::component_type_static(),
+                Line2D::component_type_static() },
+            { Line2D::component_type_static(),
+                Corner2D::component_type_static() }
+        };
+        const RelationRules internal_rules{
+            { Surface2D::component_type_static(),
+                Line2D::component_type_static() },
+            { Surface2D::component_type_static(),
+                Corner2D::component_type_static() }
+        };
+        SectionValidityReport report;
+        check_model( section, index, boundary_rules, internal_rules, report );
+        if( report.inconsistent_component_vertices.empty()
+            && report.inconsistent_unique_vertices.empty() )
+        {
+            check_line_conformity( section,
+                [&section]( const Surface2D& surface, const Line2D& line,
+                    index_t edge ) {
+                    return surface_vertices_from_line_edge(
+                        section, surface, line, edge );
+                },
+                report );
+        }
+        return report;
+    }
+
+    BRepValidityReport brep_validity_report( const BRep& brep )
+    {
+        const ModelIndex index{ brep };
+        const RelationRules boundary_rules{
+            { Block3D::component_type_static(),
+                Surface3D::component_type_static() },
+            { Surface3D::component_type_static(),
+                Line3D::component_type_static() },
+            { Line3D::component_type_static(),
+                Corner3D::component_type_static() }
+        };
+        const RelationRules internal_rules{
+            { Block3D::component_type_static(),
+                Surface3D::component_type_static() },
+            { Block3D::component_type_static(),
+                Line3D::component_type_static() },
+            { Block3D::component_type_static(),
+                Corner3D::component_type_static() },
+            { Surface3D::component_type_static(),
+                Line3D::component_type_static() },
+            { Surface3D::component_type_static(),
+                Corner3D::component_type_static() }
+        };
+        BRepValidityReport report;
+        check_model( brep, index, boundary_rules, internal_rules, report );
+        check_meshes< Block3D >( component_pointers( brep.blocks() ),
+            []( const Block3D& block, MeshIssues& issues ) {
+                check_block_mesh( block, issues );
+            },
+            report );
+        if( report.inconsistent_component_vertices.empty()
+            && report.inconsistent_unique_vertices.empty() )
+        {
+            const BRepIncidenceIndex incidences{ brep };
+            check_line_conformity( brep,
+                [&incidences]( const Surface3D& surface, const Line3D& line,
+                    index_t edge ) -> const auto& {
+                    return incidences.surface_vertices_from_line_edge(
+                        surface, line, edge );
+                },
+                report );
+            check_surface_conformity( brep, incidences, report );
+        }
+        return report;
+    }
+} // namespace geode
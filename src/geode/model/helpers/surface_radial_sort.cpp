@@ -23,8 +23,14 @@
 
 #include <geode/model/helpers/surface_radial_sort.hpp>
 
+#include <async++.h>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
+
 #include <geode/basic/algorithm.hpp>
 #include <geode/basic/logger.hpp>
+#include <geode/basic/pimpl_impl.hpp>
 
 #include <geode/geometry/basic_objects/infinite_line.hpp>
 #include <geode/geometry/basic_objects/segment.hpp>
@@ -32,6 +38,7 @@
 #include <geode/geometry/radial_sort.hpp>
 
 #include <geode/mesh/core/edged_curve.hpp>
+#include <geode/mesh/core/mesh_revisions.hpp>
 #include <geode/mesh/core/surface_mesh.hpp>
 
 #include <geode/model/helpers/component_mesh_vertices.hpp>
@@ -51,15 +58,22 @@ namespace
         return mesh.point( vertex );
     }
 
+    struct BorderEdge
+    {
+        geode::PolygonEdge edge;
+        bool degenerated;
+        geode::Point3D opposite_point;
+    };
+
     struct BorderPolygon
     {
-        BorderPolygon( const geode::Surface3D& surface_in,
+        BorderPolygon( const geode::uuid& surface_in,
             bool same_orientation_in,
-            geode::PolygonEdge edge_in )
-            : surface( surface_in.id() ),
+            const BorderEdge& border_edge )
+            : surface( surface_in ),
               same_orientation( same_orientation_in ),
-              edge( std::move( edge_in ) ),
-              opposite_point{ opposite( surface_in, edge_in ) }
+              edge( border_edge.edge ),
+              opposite_point{ border_edge.opposite_point }
         {
         }
 
@@ -89,11 +103,124 @@ namespace
         geode::Point3D opposite_point;
     };
 
+    /*!
+     * Find the polygon edges of the Surface meshes going from one mesh vertex
+     * to another, and computing their degeneracy and opposite point, directly
+     * from the Surface meshes.
+     */
+    class MeshBorderEdgeFinder
+    {
+    public:
+        explicit MeshBorderEdgeFinder( const geode::BRep& brep ) : brep_( brep )
+        {
+        }
+
+        std::optional< BorderEdge > operator()( const geode::uuid& surface_id,
+            geode::index_t from_vertex,
+            geode::index_t to_vertex ) const
+        {
+            const auto& surface = brep_.surface( surface_id );
+            const auto& mesh = surface.mesh();
+            auto edge =
+                mesh.polygon_edge_from_vertices( from_vertex, to_vertex );
+            if( !edge )
+            {
+                return std::nullopt;
+            }
+            return BorderEdge{ edge.value(),
+                mesh.is_polygon_degenerated( edge->polygon_id ),
+                opposite( surface, edge.value() ) };
+        }
+
+    private:
+        const geode::BRep& brep_;
+    };
+
+    /*!
+     * Polygon edges of a Surface mesh whose both vertices are on Lines,
+     * indexed by their mesh vertices, from first to second.
+     */
+    using SurfaceBorderEdges = absl::flat_hash_map<
+        std::pair< geode::index_t, geode::index_t >,
+        BorderEdge >;
+
+    SurfaceBorderEdges surface_border_edges(
+        const geode::BRep& brep, const geode::Surface3D& surface )
+    {
+        const auto& mesh = surface.mesh();
+        std::vector< bool > on_line( mesh.nb_vertices(), false );
+        for( const auto v : geode::Range{ mesh.nb_vertices() } )
+        {
+            const auto unique_vertex =
+                brep.unique_vertex( { surface.component_id(), v } );
+            on_line[v] = unique_vertex != geode::NO_ID
+                         && brep.has_component_mesh_vertices( unique_vertex,
+                             geode::Line3D::component_type_static() );
+        }
+        SurfaceBorderEdges edges;
+        for( const auto p : geode::Range{ mesh.nb_polygons() } )
+        {
+            std::optional< bool > degenerated;
+            for( const auto e : geode::LRange{ mesh.nb_polygon_edges( p ) } )
+            {
+                const geode::PolygonEdge edge{ p, e };
+                const auto vertices = mesh.polygon_edge_vertices( edge );
+                if( !on_line[vertices[0]] || !on_line[vertices[1]] )
+                {
+                    continue;
+                }
+                if( !degenerated )
+                {
+                    degenerated = mesh.is_polygon_degenerated( p );
+                }
+                edges.try_emplace( std::make_pair( vertices[0], vertices[1] ),
+                    BorderEdge{ edge, degenerated.value(),
+                        opposite( surface, edge ) } );
+            }
+        }
+        return edges;
+    }
+
+    /*!
+     * Find the polygon edges going from one Surface mesh vertex to another
+     * among precomputed SurfaceBorderEdges.
+     */
+    class IndexedBorderEdgeFinder
+    {
+    public:
+        explicit IndexedBorderEdgeFinder(
+            const absl::flat_hash_map< geode::uuid, SurfaceBorderEdges >&
+                border_edges )
+            : border_edges_( border_edges )
+        {
+        }
+
+        std::optional< BorderEdge > operator()( const geode::uuid& surface_id,
+            geode::index_t from_vertex,
+            geode::index_t to_vertex ) const
+        {
+            const auto& surface_edges = border_edges_.at( surface_id );
+            const auto it =
+                surface_edges.find( std::make_pair( from_vertex, to_vertex ) );
+            if( it == surface_edges.end() )
+            {
+                return std::nullopt;
+            }
+            return it->second;
+        }
+
+    private:
+        const absl::flat_hash_map< geode::uuid, SurfaceBorderEdges >&
+            border_edges_;
+    };
+
+    template < typename BorderEdgeFinder >
     std::pair< bool, std::vector< BorderPolygon > > border_polygons(
         const geode::BRep& brep,
         const geode::Line3D& line,
         geode::index_t e0,
-        geode::index_t e1 )
+        geode::index_t e1,
+        const BorderEdgeFinder& find_border_edge )
     {
         const auto line_v0 = brep.unique_vertex( { line.component_id(), e0 } );
         const auto line_v1 = brep.unique_vertex( { line.component_id(), e1 } );
@@ -106,27 +233,21 @@ namespace
                 geode::Surface3D::component_type_static() ) )
         {
             const auto& surface_id = vertex_pairs.first.id();
-            const auto& surface = brep.surface( surface_id );
-            const auto& surface_mesh = surface.mesh();
             for( const auto& pair : vertex_pairs.second )
             {
-                if( auto edge0 = surface_mesh.polygon_edge_from_vertices(
-                        pair[0], pair[1] ) )
+                if( const auto edge0 =
+                        find_border_edge( surface_id, pair[0], pair[1] ) )
                 {
-                    polygons.emplace_back(
-                        surface, true, std::move( edge0.value() ) );
-                    degenerate_polygon = degenerate_polygon
-                                         || surface_mesh.is_polygon_degenerated(
-                                             edge0->polygon_id );
+                    polygons.emplace_back( surface_id, true, edge0.value() );
+                    degenerate_polygon =
+                        degenerate_polygon || edge0->degenerated;
                 }
-                if( auto edge1 = surface_mesh.polygon_edge_from_vertices(
-                        pair[1], pair[0] ) )
+                if( const auto edge1 =
+                        find_border_edge( surface_id, pair[1], pair[0] ) )
                 {
-                    polygons.emplace_back(
-                        surface, false, std::move( edge1.value() ) );
-                    degenerate_polygon = degenerate_polygon
-                                         || surface_mesh.is_polygon_degenerated(
-                                             edge1->polygon_id );
+                    polygons.emplace_back( surface_id, false, edge1.value() );
+                    degenerate_polygon =
+                        degenerate_polygon || edge1->degenerated;
                 }
             }
         }
@@ -154,6 +275,43 @@ namespace
         }
         return sorted_surfaces;
     }
+
+    template < typename BorderEdgeFinder >
+    geode::SortedSurfaces line_radial_sort( const geode::BRep& brep,
+        const geode::Line3D& line,
+        const BorderEdgeFinder& find_border_edge )
+    {
+        const auto& mesh = line.mesh();
+        for( const auto edge_id : geode::Range{ mesh.nb_edges() } )
+        {
+            const auto e0 = mesh.edge_vertex( { edge_id, 0 } );
+            const auto e1 = mesh.edge_vertex( { edge_id, 1 } );
+            auto polygons =
+                border_polygons( brep, line, e0, e1, find_border_edge );
+            if( !polygons.first )
+            {
+                if( edge_id == mesh.nb_edges() - 1 )
+                {
+                    geode::Logger::warn(
+                        "[surface_radial_sort] Degenerated polygons "
+                        "has been found on all the edges of Line ",
+                        line.id().string(),
+                        ". The result of surface_radial_sort is not "
+                        "guaranteed." );
+                }
+                else
+                {
+                    continue;
+                }
+            }
+            const auto& p0 = mesh.point( e0 );
+            const auto& p1 = mesh.point( e1 );
+            return sort( { p0, p1 }, polygons.second );
+        }
+        OPENGEODE_ASSERT_NOT_REACHED(
+            "[surface_radial_sort] Cannot find sorted surfaces on a Line" );
+        return geode::SortedSurfaces{ 0 };
+    }
 } // namespace
 
 namespace geode
@@ -201,34 +359,331 @@ namespace geode
 
     SortedSurfaces surface_radial_sort( const BRep& brep, const Line3D& line )
     {
-        const auto& mesh = line.mesh();
-        for( const auto edge_id : Range{ mesh.nb_edges() } )
+        return line_radial_sort( brep, line, MeshBorderEdgeFinder{ brep } );
+    }
+
+    class BRepSurfaceRadialSorts::Impl
+    {
+    public:
+        explicit Impl( const BRep& brep )
+            : brep_( brep ), revisions_( brep.mesh_revisions() )
         {
-            const auto e0 = mesh.edge_vertex( { edge_id, 0 } );
-            const auto e1 = mesh.edge_vertex( { edge_id, 1 } );
-            auto polygons = border_polygons( brep, line, e0, e1 );
-            if( !polygons.first )
+            std::vector< uuid > surfaces;
+            surfaces.reserve( brep_.nb_surfaces() );
+            for( const auto& surface : brep_.surfaces() )
             {
-                if( edge_id == mesh.nb_edges() - 1 )
+                surfaces.push_back( surface.id() );
+            }
+            compute_border_edges( surfaces );
+            compute_sorted_surfaces( []( const uuid& ) {
+                return true;
+            } );
+        }
+
+        bool is_up_to_date() const
+        {
+            const auto revisions = brep_.mesh_revisions();
+            return revisions.nb_meshes == revisions_.nb_meshes
+                   && revisions.connectivity == revisions_.connectivity;
+        }
+
+        index_t nb_lines() const
+        {
+            return checked_index( line_indices_.size() );
+        }
+
+        absl::Span< const SidedSurface > sorted_surfaces(
+            const uuid& line_id ) const
+        {
+            const auto it = line_indices_.find( line_id );
+            OPENGEODE_EXCEPTION( it != line_indices_.end(),
+                "[BRepSurfaceRadialSorts::sorted_surfaces] The given line is "
+                "not in the sorted model." );
+            return line_range( it->second );
+        }
+
+        void update( absl::Span< const uuid > surfaces,
+            absl::Span< const uuid > lines )
+        {
+            absl::flat_hash_set< uuid > changed_surfaces{ surfaces.begin(),
+                surfaces.end() };
+            for( const auto& border_edges : border_edges_ )
+            {
+                if( !brep_.has_surface( border_edges.first ) )
                 {
-                    Logger::warn( "[surface_radial_sort] Degenerated polygons "
-                                  "has been found on all the edges of Line ",
-                        line.id().string(),
-                        ". The result of surface_radial_sort is not "
-                        "guaranteed." );
+                    changed_surfaces.insert( border_edges.first );
+                }
+            }
+            for( const auto& surface : brep_.surfaces() )
+            {
+                if( !border_edges_.contains( surface.id() ) )
+                {
+                    changed_surfaces.insert( surface.id() );
+                }
+            }
+            absl::flat_hash_set< uuid > changed_lines{ lines.begin(),
+                lines.end() };
+            for( const auto& line : brep_.lines() )
+            {
+                if( !line_indices_.contains( line.id() ) )
+                {
+                    changed_lines.insert( line.id() );
+                }
+            }
+            // Polygon edges of any Surface may now lie on (or leave) the
+            // modified or added Lines, even if this Surface mesh is not
+            // modified
+            absl::flat_hash_set< uuid > surfaces_around_lines;
+            for( const auto& line_id : changed_lines )
+            {
+                if( brep_.has_line( line_id ) )
+                {
+                    add_surfaces_around_line(
+                        brep_.line( line_id ), surfaces_around_lines );
+                }
+                const auto it = line_indices_.find( line_id );
+                if( it == line_indices_.end() )
+                {
+                    continue;
+                }
+                for( const auto& surface : line_range( it->second ) )
+                {
+                    if( brep_.has_surface( surface.id ) )
+                    {
+                        surfaces_around_lines.insert( surface.id );
+                    }
+                }
+            }
+            for( const auto& line : line_indices_ )
+            {
+                for( const auto& surface : line_range( line.second ) )
+                {
+                    if( changed_surfaces.contains( surface.id ) )
+                    {
+                        changed_lines.insert( line.first );
+                        break;
+                    }
+                }
+            }
+            std::vector< uuid > recomputed_surfaces;
+            for( const auto& surface_id : changed_surfaces )
+            {
+                if( brep_.has_surface( surface_id ) )
+                {
+                    recomputed_surfaces.push_back( surface_id );
                 }
                 else
+                {
+                    border_edges_.erase( surface_id );
+                }
+            }
+            const auto nb_changed_surfaces = recomputed_surfaces.size();
+            for( const auto& surface_id : surfaces_around_lines )
+            {
+                if( !changed_surfaces.contains( surface_id ) )
+                {
+                    recomputed_surfaces.push_back( surface_id );
+                }
+            }
+            compute_border_edges( recomputed_surfaces );
+            for( const auto s : Range{ nb_changed_surfaces } )
+            {
+                add_lines_around_surface(
+                    recomputed_surfaces[s], changed_lines );
+            }
+            compute_sorted_surfaces(
+                [&changed_lines]( const uuid& line_id ) {
+                    return changed_lines.contains( line_id );
+                } );
+            revisions_ = brep_.mesh_revisions();
+        }
+
+    private:
+        absl::Span< const SidedSurface > line_range( index_t line ) const
+        {
+            const auto begin = offsets_[line];
+            const auto end = offsets_[line + 1];
+            return absl::MakeConstSpan( surfaces_ ).subspan(
+                begin, end - begin );
+        }
+
+        void compute_border_edges( absl::Span< const uuid > surface_ids )
+        {
+            std::vector< std::pair< const Surface3D*, SurfaceBorderEdges* > >
+                surfaces;
+            surfaces.reserve( surface_ids.size() );
+            for( const auto& surface_id : surface_ids )
+            {
+                border_edges_.try_emplace( surface_id );
+            }
+            for( const auto& surface_id : surface_ids )
+            {
+                surfaces.emplace_back(
+                    &brep_.surface( surface_id ), &border_edges_[surface_id] );
+            }
+            async::parallel_for(
+                async::irange( size_t{ 0 }, surfaces.size() ),
+                [this, &surfaces]( size_t s ) {
+                    *surfaces[s].second =
+                        surface_border_edges( brep_, *surfaces[s].first );
+                } );
+        }
+
+        void add_surfaces_around_line( const Line3D& line,
+            absl::flat_hash_set< uuid >& surfaces ) const
+        {
+            for( const auto v : Range{ line.mesh().nb_vertices() } )
+            {
+                const auto unique_vertex =
+                    brep_.unique_vertex( { line.component_id(), v } );
+                if( unique_vertex == NO_ID )
                 {
                     continue;
                 }
+                for( const auto& vertex :
+                    brep_.component_mesh_vertices( unique_vertex ) )
+                {
+                    if( vertex.component_id.type()
+                        == Surface3D::component_type_static() )
+                    {
+                        surfaces.insert( vertex.component_id.id() );
+                    }
+                }
             }
-            const auto& p0 = line.mesh().point( e0 );
-            const auto& p1 = line.mesh().point( e1 );
-            return sort( { p0, p1 }, polygons.second );
         }
-        OPENGEODE_ASSERT_NOT_REACHED(
-            "[surface_radial_sort] Cannot find sorted surfaces on a Line" );
-        return SortedSurfaces{ 0 };
+
+        void add_lines_around_surface(
+            const uuid& surface_id, absl::flat_hash_set< uuid >& lines ) const
+        {
+            const auto& surface = brep_.surface( surface_id );
+            for( const auto& border_edge : border_edges_.at( surface_id ) )
+            {
+                const auto unique_vertex = brep_.unique_vertex(
+                    { surface.component_id(), border_edge.first.first } );
+                for( const auto& vertex :
+                    brep_.component_mesh_vertices( unique_vertex ) )
+                {
+                    if( vertex.component_id.type()
+                        == Line3D::component_type_static() )
+                    {
+                        lines.insert( vertex.component_id.id() );
+                    }
+                }
+            }
+        }
+
+        /*!
+         * Rebuild the table, sorting again the Lines for which is_changed
+         * returns true, and Lines not yet in the table. The other Lines reuse
+         * their previous sorted Surfaces.
+         */
+        template < typename LineFilter >
+        void compute_sorted_surfaces( const LineFilter& is_changed )
+        {
+            std::vector< const Line3D* > lines;
+            std::vector< std::vector< SidedSurface > > line_surfaces;
+            std::vector< index_t > sorted_lines;
+            for( const auto& line : brep_.lines() )
+            {
+                const auto it = line_indices_.find( line.id() );
+                if( it == line_indices_.end() || is_changed( line.id() ) )
+                {
+                    sorted_lines.push_back( checked_index( lines.size() ) );
+                    line_surfaces.emplace_back();
+                }
+                else
+                {
+                    const auto previous = line_range( it->second );
+                    line_surfaces.emplace_back(
+                        previous.begin(), previous.end() );
+                }
+                lines.push_back( &line );
+            }
+            const IndexedBorderEdgeFinder finder{ border_edges_ };
+            async::parallel_for(
+                async::irange( size_t{ 0 }, sorted_lines.size() ),
+                [this, &lines, &sorted_lines, &line_surfaces, &finder](
+                    size_t l ) {
+                    const auto line_id = sorted_lines[l];
+                    const auto& line = *lines[line_id];
+                    if( line.mesh().nb_edges() == 0 )
+                    {
+                        return;
+                    }
+                    const auto sorted =
+                        line_radial_sort( brep_, line, finder );
+                    line_surfaces[line_id].assign(
+                        sorted.surfaces.begin(), sorted.surfaces.end() );
+                } );
+            line_indices_.clear();
+            offsets_.clear();
+            offsets_.reserve( lines.size() + 1 );
+            offsets_.push_back( 0 );
+            for( const auto l : Indices{ lines } )
+            {
+                line_indices_.emplace( lines[l]->id(), l );
+                offsets_.push_back(
+                    offsets_.back()
+                    + checked_index( line_surfaces[l].size() ) );
+            }
+            surfaces_.clear();
+            surfaces_.reserve( offsets_.back() );
+            for( auto& sorted : line_surfaces )
+            {
+                surfaces_.insert( surfaces_.end(),
+                    std::make_move_iterator( sorted.begin() ),
+                    std::make_move_iterator( sorted.end() ) );
+            }
+        }
+
+    private:
+        const BRep& brep_;
+        MeshRevisions revisions_;
+        absl::flat_hash_map< uuid, SurfaceBorderEdges > border_edges_;
+        absl::flat_hash_map< uuid, index_t > line_indices_;
+        std::vector< index_t > offsets_;
+        std::vector< SidedSurface > surfaces_;
+    };
+
+    BRepSurfaceRadialSorts::BRepSurfaceRadialSorts( const BRep& brep )
+        : impl_{ brep }
+    {
+    }
+
+    BRepSurfaceRadialSorts::BRepSurfaceRadialSorts(
+        BRepSurfaceRadialSorts&& ) noexcept = default;
+
+    BRepSurfaceRadialSorts::~BRepSurfaceRadialSorts() = default;
+
+    bool BRepSurfaceRadialSorts::is_up_to_date() const
+    {
+        return impl_->is_up_to_date();
+    }
+
+    void BRepSurfaceRadialSorts::update( absl::Span< const uuid > surfaces,
+        absl::Span< const uuid > lines )
+    {
+        impl_->update( surfaces, lines );
+    }
+
+    index_t BRepSurfaceRadialSorts::nb_lines() const
+    {
+        return impl_->nb_lines();
+    }
+
+    absl::Span< const SidedSurface > BRepSurfaceRadialSorts::sorted_surfaces(
+        const uuid& line_id ) const
+    {
+        return impl_->sorted_surfaces( line_id );
+    }
+
+    SortedSurfaces BRepSurfaceRadialSorts::surface_radial_sort(
+        const Line3D& line ) const
+    {
+        const auto surfaces = impl_->sorted_surfaces( line.id() );
+        SortedSurfaces sorted( surfaces.size() / 2 );
+        absl::c_copy( surfaces, sorted.surfaces.begin() );
+        return sorted;
     }
 } // namespace geode
 
@@ -66,6 +66,12 @@ namespace geode
         relationships_.copy_relationships( mapping, relationships, {} );
     }
 
+    void RelationshipsBuilder::append_relationships(
+        const ModelCopyMapping& mapping, const Relationships& relationships )
+    {
+        relationships_.append_relationships( mapping, relationships, {} );
+    }
+
     void RelationshipsBuilder::load_relationships( std::string_view directory )
     {
         relationships_.load_relationships( directory, {} );
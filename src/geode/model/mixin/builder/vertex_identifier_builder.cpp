@@ -48,6 +48,12 @@ namespace geode
             component_vertex_id, unique_vertex_id, {} );
     }
 
+    void VertexIdentifierBuilder::set_unique_vertices(
+        absl::Span< const std::pair< ComponentMeshVertex, index_t > > vertices )
+    {
+        vertex_identifier_.set_unique_vertices( vertices, {} );
+    }
+
     void VertexIdentifierBuilder::unset_unique_vertex(
         const ComponentMeshVertex& component_vertex_id,
         index_t unique_vertex_id )
@@ -62,6 +68,23 @@ namespace geode
         vertex_identifier_.update_unique_vertices( component_id, old2new, {} );
     }
 
+    void VertexIdentifierBuilder::copy_unique_vertices(
+        const VertexIdentifier& other,
+        index_t first_unique_vertex,
+        const ModelCopyMapping& mapping )
+    {
+        std::vector< std::pair< uuid, ComponentID > > components_mapping;
+        for( const auto& [type, type_mapping] : mapping.components_mappings() )
+        {
+            for( const auto& [in, out] : type_mapping.in2out_map() )
+            {
+                components_mapping.emplace_back( in, ComponentID{ type, out } );
+            }
+        }
+        vertex_identifier_.copy_unique_vertices(
+            other, first_unique_vertex, components_mapping, {} );
+    }
+
     void VertexIdentifierBuilder::load_unique_vertices(
         std::string_view directory )
     {
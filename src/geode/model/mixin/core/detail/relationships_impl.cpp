@@ -56,7 +56,7 @@ namespace geode
         {
             if( const auto index = vertex_id( component_id ) )
             {
-                return static_cast< index_t >(
+                return checked_index(
                     graph_->edges_around_vertex( index.value() ).size() );
             }
             return 0;
@@ -231,6 +231,71 @@ namespace geode
             uuid2index_.update( old2new );
         }
 
+        std::vector< index_t > RelationshipsImpl::append(
+            const RelationshipsImpl& impl, const ModelCopyMapping& mapping )
+        {
+            const auto& other_graph = *impl.graph_;
+            std::vector< index_t > vertices( other_graph.nb_vertices(), NO_ID );
+            std::vector< bool > existing_vertices(
+                other_graph.nb_vertices(), false );
+            for( const auto v : Range{ other_graph.nb_vertices() } )
+            {
+                const auto& component_id = impl.component_from_index( v );
+                if( !mapping.has_mapping_type( component_id.type() ) )
+                {
+                    continue;
+                }
+                const auto& type_mapping = mapping.at( component_id.type() );
+                if( !type_mapping.has_mapping_input( component_id.id() ) )
+                {
+                    continue;
+                }
+                const ComponentID new_id{ component_id.type(),
+                    type_mapping.in2out( component_id.id() ) };
+                existing_vertices[v] = vertex_id( new_id.id() ).has_value();
+                vertices[v] = find_or_create_vertex_id( new_id );
+            }
+            std::vector< index_t > old2new( other_graph.nb_edges(), NO_ID );
+            index_t nb_new_edges{ 0 };
+            for( const auto e : Range{ other_graph.nb_edges() } )
+            {
+                const auto v0 = other_graph.edge_vertex( { e, 0 } );
+                const auto v1 = other_graph.edge_vertex( { e, 1 } );
+                if( vertices[v0] == NO_ID || vertices[v1] == NO_ID )
+                {
+                    continue;
+                }
+                if( existing_vertices[v0] && existing_vertices[v1]
+                    && graph_->edge_from_vertices(
+                        vertices[v0], vertices[v1] ) )
+                {
+                    continue;
+                }
+                old2new[e] = graph_->nb_edges() + nb_new_edges++;
+            }
+            if( nb_new_edges == 0 )
+            {
+                return old2new;
+            }
+            auto builder = GraphBuilder::create( *graph_ );
+            builder->create_edges( nb_new_edges );
+            for( const auto e : Indices{ old2new } )
+            {
+                if( old2new[e] == NO_ID )
+                {
+                    continue;
+                }
+                for( const auto v : LRange{ 2 } )
+                {
+                    builder->set_edge_vertex( { old2new[e], v },
+                        vertices[other_graph.edge_vertex( { e, v } )] );
+                }
+            }
+            graph_->edge_attribute_manager().import(
+                other_graph.edge_attribute_manager(), old2new );
+            return old2new;
+        }
+
         void RelationshipsImpl::initialize_attributes()
         {
             ids_ =
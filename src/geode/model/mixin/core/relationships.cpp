@@ -162,6 +162,20 @@ namespace geode
             initialize_relation_attribute();
         }
 
+        void append( const Impl& impl, const ModelCopyMapping& mapping )
+        {
+            const auto old2new =
+                detail::RelationshipsImpl::append( impl, mapping );
+            for( const auto e : Indices{ old2new } )
+            {
+                if( old2new[e] != NO_ID )
+                {
+                    relation_type_->set_value(
+                        old2new[e], impl.relation_type( e ) );
+                }
+            }
+        }
+
         void save( std::string_view directory ) const
         {
             const auto filename = absl::StrCat( directory, "/relationships" );
@@ -421,6 +435,13 @@ namespace geode
         impl_->copy( *relationships.impl_, mapping );
     }
 
+    void Relationships::append_relationships( const ModelCopyMapping& mapping,
+        const Relationships& relationships,
+        RelationshipsBuilderKey )
+    {
+        impl_->append( *relationships.impl_, mapping );
+    }
+
     void Relationships::load_relationships(
         std::string_view directory, RelationshipsBuilderKey )
     {
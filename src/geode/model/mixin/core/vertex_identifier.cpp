@@ -85,7 +85,8 @@ namespace geode
             Growable< Archive, ComponentMeshVertex >{
                 { []( Archive& a, ComponentMeshVertex& component_mesh_vertex ) {
                     a.object( component_mesh_vertex.component_id );
-                    a.value4b( component_mesh_vertex.vertex );
+                    a.template value< INDEX_BYTES >(
+                        component_mesh_vertex.vertex );
                 } } } );
     }
 
@@ -249,6 +250,49 @@ namespace geode
                 } );
         }
 
+        void set_unique_vertices(
+            absl::Span< const std::pair< ComponentMeshVertex, index_t > >
+                vertices )
+        {
+            absl::flat_hash_map< index_t, std::vector< ComponentMeshVertex > >
+                new_vertices;
+            for( const auto& [component_vertex_id, unique_vertex_id] :
+                vertices )
+            {
+                OPENGEODE_ASSERT( unique_vertex_id < nb_unique_vertices(),
+                    "[VertexIdentifier::set_unique_vertices] Unique vertex ",
+                    unique_vertex_id, " does not exist (nb=",
+                    nb_unique_vertices(), ")" );
+                auto& attribute = *vertex2unique_vertex_.at(
+                    component_vertex_id.component_id.id() );
+                const auto old_unique_id =
+                    attribute.value( component_vertex_id.vertex );
+                if( old_unique_id == unique_vertex_id )
+                {
+                    continue;
+                }
+                if( old_unique_id != NO_ID )
+                {
+                    unset_unique_vertex( component_vertex_id, old_unique_id );
+                }
+                attribute.set_value(
+                    component_vertex_id.vertex, unique_vertex_id );
+                new_vertices[unique_vertex_id].push_back( component_vertex_id );
+            }
+            for( auto& [unique_vertex_id, component_vertices] : new_vertices )
+            {
+                component_vertices_->modify_value( unique_vertex_id,
+                    [&component_vertices](
+                        std::vector< ComponentMeshVertex >& value ) {
+                        value.insert( value.end(),
+                            std::make_move_iterator(
+                                component_vertices.begin() ),
+                            std::make_move_iterator(
+                                component_vertices.end() ) );
+                    } );
+            }
+        }
+
         void unset_unique_vertex(
             const ComponentMeshVertex& component_vertex_id,
             const index_t unique_vertex_id )
@@ -270,6 +314,59 @@ namespace geode
                 } );
         }
 
+        void copy_unique_vertices( const Impl& other,
+            index_t first_unique_vertex,
+            absl::Span< const std::pair< uuid, ComponentID > >
+                components_mapping )
+        {
+            OPENGEODE_EXCEPTION(
+                first_unique_vertex + other.nb_unique_vertices()
+                    <= nb_unique_vertices(),
+                "[VertexIdentifier::copy_unique_vertices] Unique vertices "
+                "should be created before copy" );
+            absl::flat_hash_map< uuid,
+                std::pair< const ComponentID*, VariableAttribute< index_t >* > >
+                copies;
+            copies.reserve( components_mapping.size() );
+            for( const auto& [other_id, copy_id] : components_mapping )
+            {
+                const auto it = vertex2unique_vertex_.find( copy_id.id() );
+                if( it != vertex2unique_vertex_.end() )
+                {
+                    copies.emplace( other_id,
+                        std::make_pair( &copy_id, it->second.get() ) );
+                }
+            }
+            async::parallel_for(
+                async::irange( index_t{ 0 }, other.nb_unique_vertices() ),
+                [this, &other, &copies, first_unique_vertex]( index_t v ) {
+                    const auto unique_vertex = first_unique_vertex + v;
+                    const auto& other_vertices =
+                        other.component_mesh_vertices( v );
+                    std::vector< ComponentMeshVertex > vertices;
+                    vertices.reserve( other_vertices.size() );
+                    for( const auto& other_vertex : other_vertices )
+                    {
+                        const auto it =
+                            copies.find( other_vertex.component_id.id() );
+                        if( it == copies.end() )
+                        {
+                            continue;
+                        }
+                        const auto& [copy_id, attribute] = it->second;
+                        OPENGEODE_ASSERT(
+                            attribute->value( other_vertex.vertex ) == NO_ID,
+                            "[VertexIdentifier::copy_unique_vertices] Copied "
+                            "component vertex already has a unique vertex" );
+                        attribute->set_value(
+                            other_vertex.vertex, unique_vertex );
+                        vertices.emplace_back( *copy_id, other_vertex.vertex );
+                    }
+                    component_vertices_->set_value(
+                        unique_vertex, std::move( vertices ) );
+                } );
+        }
+
         void update_unique_vertices( const ComponentID& component_id,
             absl::Span< const index_t > old2new )
         {
@@ -534,6 +631,15 @@ namespace geode
         return impl_->create_unique_vertices( nb );
     }
 
+    void VertexIdentifier::copy_unique_vertices( const VertexIdentifier& other,
+        index_t first_unique_vertex,
+        absl::Span< const std::pair< uuid, ComponentID > > components_mapping,
+        BuilderKey )
+    {
+        impl_->copy_unique_vertices(
+            *other.impl_, first_unique_vertex, components_mapping );
+    }
+
     void VertexIdentifier::set_unique_vertex(
         ComponentMeshVertex component_vertex_id,
         index_t unique_vertex_id,
@@ -543,6 +649,13 @@ namespace geode
             std::move( component_vertex_id ), unique_vertex_id );
     }
 
+    void VertexIdentifier::set_unique_vertices(
+        absl::Span< const std::pair< ComponentMeshVertex, index_t > > vertices,
+        BuilderKey )
+    {
+        impl_->set_unique_vertices( vertices );
+    }
+
     void VertexIdentifier::unset_unique_vertex(
         const ComponentMeshVertex& component_vertex_id,
         index_t unique_vertex_id,
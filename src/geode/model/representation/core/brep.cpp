@@ -903,4 +903,15 @@ namespace geode
         }
         return internal::meshes_bounding_box< 3 >( corners() );
     }
+
+    MeshRevisions BRep::mesh_revisions() const
+    {
+        MeshRevisions revisions;
+        revisions.nb_meshes = 0;
+        internal::add_meshes_revisions( revisions, corners() );
+        internal::add_meshes_revisions( revisions, lines() );
+        internal::add_meshes_revisions( revisions, surfaces() );
+        internal::add_meshes_revisions( revisions, blocks() );
+        return revisions;
+    }
 } // namespace geode
@@ -599,4 +599,14 @@ namespace geode
         }
         return internal::meshes_bounding_box< 2 >( corners() );
     }
+
+    MeshRevisions Section::mesh_revisions() const
+    {
+        MeshRevisions revisions;
+        revisions.nb_meshes = 0;
+        internal::add_meshes_revisions( revisions, corners() );
+        internal::add_meshes_revisions( revisions, lines() );
+        internal::add_meshes_revisions( revisions, surfaces() );
+        return revisions;
+    }
 } // namespace geode
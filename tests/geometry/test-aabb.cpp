@@ -127,6 +127,7 @@ void test_nearest_neighbor_search()
     const geode::AABBTree< dimension > aabb{ box_vector };
 
     const BoxAABBEvalDistance< dimension > disteval{ box_vector };
+    std::vector< geode::index_t > buffer;
 
     for( const auto i : geode::Range{ nb_boxes } )
     {
@@ -157,6 +158,10 @@ void test_nearest_neighbor_search()
                 "[Test] Containing box AABB - Wrong number of boxes" );
             OPENGEODE_EXCEPTION( boxes[0] == box_id,
                 "[Test] Containing box AABB - Wrong box index" );
+
+            aabb.containing_boxes( box_center, buffer );
+            OPENGEODE_EXCEPTION( buffer.size() == 1 && buffer[0] == box_id,
+                "[Test] Containing box AABB - Wrong buffered boxes" );
         }
     }
 }
@@ -35,6 +35,7 @@
 #include <geode/geometry/basic_objects/sphere.hpp>
 #include <geode/geometry/basic_objects/tetrahedron.hpp>
 #include <geode/geometry/basic_objects/triangle.hpp>
+#include <geode/geometry/batch_distance.hpp>
 #include <geode/geometry/distance.hpp>
 #include <geode/geometry/projection.hpp>
 
@@ -1200,6 +1201,129 @@ void test_point_ellipse_distance()
     test_point_ellipse_distance_2d_not_aligned();
 }
 
+void test_batch_point_triangle_distance_2d()
+{
+    const geode::Point2D a{ { 0.0, 0.0 } };
+    const geode::Point2D b{ { 1.0, 0.0 } };
+    const geode::Point2D c{ { 1.0, 1.0 } };
+    const geode::Point2D d{ { 2.0, 0.0 } };
+    const std::array< geode::Triangle2D, 4 > triangles{
+        geode::Triangle2D{ a, b, c }, geode::Triangle2D{ a, c, b },
+        geode::Triangle2D{ b, d, c }, geode::Triangle2D{ a, b, d }
+    };
+    const std::array< geode::Point2D, 5 > queries{
+        geode::Point2D{ { 0.75, 0.25 } }, geode::Point2D{ { -1.0, -1.0 } },
+        geode::Point2D{ { 1.0, 0.0 } }, geode::Point2D{ { 0.5, 2.0 } },
+        geode::Point2D{ { 3.0, -0.5 } }
+    };
+    geode::TriangleBatch2D triangle_batch;
+    for( const auto& triangle : triangles )
+    {
+        triangle_batch.add_triangle( triangle );
+    }
+    geode::PointBatch2D point_batch;
+    for( const auto& query : queries )
+    {
+        point_batch.add_point( query );
+    }
+    std::array< double, 4 > triangle_distances;
+    std::array< double, 5 > point_distances;
+    for( const auto q : geode::Indices{ queries } )
+    {
+        geode::point_triangles_squared_distances(
+            queries[q], triangle_batch, absl::MakeSpan( triangle_distances ) );
+        for( const auto t : geode::Indices{ triangles } )
+        {
+            const auto distance = std::get< 0 >(
+                geode::point_triangle_distance( queries[q], triangles[t] ) );
+            OPENGEODE_EXCEPTION(
+                std::fabs( std::sqrt( triangle_distances[t] ) - distance )
+                    < geode::GLOBAL_EPSILON,
+                "[Test] Wrong 2D batch point triangles distance" );
+        }
+    }
+    for( const auto t : geode::Indices{ triangles } )
+    {
+        geode::points_triangle_squared_distances(
+            point_batch, triangles[t], absl::MakeSpan( point_distances ) );
+        for( const auto q : geode::Indices{ queries } )
+        {
+            const auto distance = std::get< 0 >(
+                geode::point_triangle_distance( queries[q], triangles[t] ) );
+            OPENGEODE_EXCEPTION(
+                std::fabs( std::sqrt( point_distances[q] ) - distance )
+                    < geode::GLOBAL_EPSILON,
+                "[Test] Wrong 2D batch points triangle distance" );
+        }
+    }
+}
+
+void test_batch_point_triangle_distance_3d()
+{
+    const geode::Point3D a{ { 0.0, 0.0, 0.0 } };
+    const geode::Point3D b{ { 1.0, 0.0, 0.0 } };
+    const geode::Point3D c{ { 1.0, 1.0, 0.0 } };
+    const geode::Point3D d{ { 0.0, 0.0, 1.0 } };
+    const geode::Point3D e{ { 2.0, 0.0, 0.0 } };
+    const std::array< geode::Triangle3D, 4 > triangles{
+        geode::Triangle3D{ a, b, c }, geode::Triangle3D{ a, b, d },
+        geode::Triangle3D{ b, c, d }, geode::Triangle3D{ a, b, e }
+    };
+    const std::array< geode::Point3D, 5 > queries{
+        geode::Point3D{ { 0.5, 0.25, 1.0 } },
+        geode::Point3D{ { -1.0, -1.0, -1.0 } },
+        geode::Point3D{ { 0.5, 0.5, 0.5 } },
+        geode::Point3D{ { 1.0, 0.0, 0.0 } },
+        geode::Point3D{ { 3.0, 2.0, 0.0 } }
+    };
+    geode::TriangleBatch3D triangle_batch;
+    for( const auto& triangle : triangles )
+    {
+        triangle_batch.add_triangle( triangle );
+    }
+    geode::PointBatch3D point_batch;
+    for( const auto& query : queries )
+    {
+        point_batch.add_point( query );
+    }
+    std::array< double, 4 > triangle_distances;
+    std::array< double, 5 > point_distances;
+    for( const auto q : geode::Indices{ queries } )
+    {
+        geode::point_triangles_squared_distances(
+            queries[q], triangle_batch, absl::MakeSpan( triangle_distances ) );
+        for( const auto t : geode::Indices{ triangles } )
+        {
+            const auto distance = std::get< 0 >(
+                geode::point_triangle_distance( queries[q], triangles[t] ) );
+            OPENGEODE_EXCEPTION(
+                std::fabs( std::sqrt( triangle_distances[t] ) - distance )
+                    < geode::GLOBAL_EPSILON,
+                "[Test] Wrong batch point triangles distance" );
+        }
+    }
+    for( const auto t : geode::Indices{ triangles } )
+    {
+        geode::points_triangle_squared_distances(
+            point_batch, triangles[t], absl::MakeSpan( point_distances ) );
+        for( const auto q : geode::Indices{ queries } )
+        {
+            const auto distance = std::get< 0 >(
+                geode::point_triangle_distance( queries[q], triangles[t] ) );
+            OPENGEODE_EXCEPTION(
+                std::fabs( std::sqrt( point_distances[q] ) - distance )
+                    < geode::GLOBAL_EPSILON,
+                "[Test] Wrong batch points triangle distance" );
+        }
+    }
+}
+
+void test_batch_point_triangle_distance()
+{
+    test_batch_point_triangle_distance_2d();
+    test_batch_point_triangle_distance_3d();
+}
+
 void test()
 {
     // test_point_segment_distance();
@@ -1214,6 +1338,7 @@ void test()
     // test_line_triangle_distance();
     // test_segment_triangle_distance();
     test_point_ellipse_distance();
+    test_batch_point_triangle_distance();
 }
 
 OPENGEODE_TEST( "distance" )
@@ -148,10 +148,72 @@ void second_test()
         "[Test 2] Should be 2 unique points" );
 }
 
+void bulk_test()
+{
+    std::vector< geode::Point3D > points;
+    for( const auto i : geode::Range{ 20 } )
+    {
+        for( const auto j : geode::Range{ 20 } )
+        {
+            for( const auto k : geode::Range{ 20 } )
+            {
+                points.emplace_back( geode::Point3D{ { i * 1., j * 1.1,
+                    k * 1.2 } } );
+            }
+        }
+    }
+    const auto search = geode::NNSearch3D::create_view( points );
+    std::vector< geode::Point3D > queries;
+    for( const auto q : geode::Range{ 3000 } )
+    {
+        queries.emplace_back( geode::Point3D{ { ( q % 23 ) * 0.83,
+            ( q % 17 ) * 1.21, ( q % 13 ) * 1.57 } } );
+    }
+
+    const auto closest = search.closest_neighbors( queries );
+    const auto knn = search.bulk_neighbors( queries, 4, true );
+    const auto radius = search.bulk_radius_neighbors( queries, 1.5, true );
+    OPENGEODE_EXCEPTION( knn.nb_queries() == queries.size()
+                             && radius.nb_queries() == queries.size(),
+        "[Test] Wrong number of bulk queries" );
+    for( const auto q : geode::Indices{ queries } )
+    {
+        OPENGEODE_EXCEPTION(
+            closest[q] == search.closest_neighbor( queries[q] ),
+            "[Test] Error in bulk closest neighbors" );
+        const auto neighbors = search.neighbors( queries[q], 4 );
+        const auto bulk_neighbors = knn.query_neighbors( q );
+        OPENGEODE_EXCEPTION(
+            std::vector< geode::index_t >(
+                bulk_neighbors.begin(), bulk_neighbors.end() )
+                == neighbors,
+            "[Test] Error in bulk neighbors" );
+        const auto radius_neighbors =
+            search.radius_neighbors( queries[q], 1.5 );
+        const auto bulk_radius_neighbors = radius.query_neighbors( q );
+        OPENGEODE_EXCEPTION(
+            std::vector< geode::index_t >( bulk_radius_neighbors.begin(),
+                bulk_radius_neighbors.end() )
+                == radius_neighbors,
+            "[Test] Error in bulk radius neighbors" );
+        const auto distances = radius.query_squared_distances( q );
+        for( const auto n : geode::Indices{ bulk_radius_neighbors } )
+        {
+            const auto distance = geode::point_point_distance(
+                queries[q], points[bulk_radius_neighbors[n]] );
+            OPENGEODE_EXCEPTION(
+                std::fabs( distances[n] - distance * distance )
+                    < geode::GLOBAL_EPSILON,
+                "[Test] Error in bulk radius squared distances" );
+        }
+    }
+}
+
 void test()
 {
     first_test();
     second_test();
+    bulk_test();
 }
 
 OPENGEODE_TEST( "nnsearch" )
\ No newline at end of file
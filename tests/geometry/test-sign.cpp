@@ -21,9 +21,12 @@
  *
  */
 
+#include <vector>
+
 #include <geode/basic/assert.hpp>
 #include <geode/basic/logger.hpp>
 
+#include <geode/geometry/basic_objects/tetrahedron.hpp>
 #include <geode/geometry/basic_objects/triangle.hpp>
 #include <geode/geometry/information.hpp>
 #include <geode/geometry/point.hpp>
@@ -69,9 +72,95 @@ void test_triangle_sign()
     test_triangle_sign_2d();
     test_triangle_sign_3d();
 }
+
+void test_batch_signs()
+{
+    geode::enable_predicates_statistics( true );
+    geode::reset_predicates_statistics();
+    const geode::Point2D a{ { 0.0, 0.0 } };
+    const geode::Point2D b{ { 1.0, 0.0 } };
+    const geode::Point2D c{ { 1.0, 1.0 } };
+    const geode::Point2D d{ { 2.0, 0.0 } };
+    const std::array< geode::Triangle2D, 3 > triangles{
+        geode::Triangle2D{ a, b, c }, geode::Triangle2D{ a, c, b },
+        geode::Triangle2D{ a, b, d }
+    };
+    const auto triangle_signs = geode::triangles_area_signs( triangles );
+    OPENGEODE_EXCEPTION( triangle_signs[0] == geode::SIDE::positive
+                             && triangle_signs[1] == geode::SIDE::negative
+                             && triangle_signs[2] == geode::SIDE::zero,
+        "[Test] Wrong result for triangles_area_signs" );
+
+    const geode::Point3D o{ { 0.0, 0.0, 0.0 } };
+    const geode::Point3D x{ { 1.0, 0.0, 0.0 } };
+    const geode::Point3D y{ { 0.0, 1.0, 0.0 } };
+    const geode::Point3D z{ { 0.0, 0.0, 1.0 } };
+    const geode::Point3D xy{ { 1.0, 1.0, 0.0 } };
+    const std::array< geode::Tetrahedron, 3 > tetrahedra{
+        geode::Tetrahedron{ o, x, y, z }, geode::Tetrahedron{ o, y, x, z },
+        geode::Tetrahedron{ o, x, y, xy }
+    };
+    const auto tetrahedron_signs = geode::tetrahedra_volume_signs( tetrahedra );
+    for( const auto t : geode::Indices{ tetrahedra } )
+    {
+        OPENGEODE_EXCEPTION(
+            tetrahedron_signs[t]
+                == geode::tetrahedron_volume_sign( tetrahedra[t] ),
+            "[Test] Wrong result for tetrahedra_volume_signs" );
+    }
+    OPENGEODE_EXCEPTION( tetrahedron_signs[2] == geode::SIDE::zero,
+        "[Test] Wrong result for flat tetrahedron" );
+
+    const auto statistics = geode::predicates_statistics();
+    geode::Logger::info( statistics.string() );
+    OPENGEODE_EXCEPTION( statistics.orient_2d.nb_evaluations == 3
+                             && statistics.orient_2d.nb_exact_evaluations == 1,
+        "[Test] Wrong orient_2d statistics" );
+    OPENGEODE_EXCEPTION( statistics.orient_3d.nb_evaluations == 6
+                             && statistics.orient_3d.nb_exact_evaluations == 2,
+        "[Test] Wrong orient_3d statistics" );
+    geode::enable_predicates_statistics( false );
+}
+
+void test_large_batch_signs()
+{
+    // More triangles than filtered together, some of them being flat
+    std::vector< geode::Point2D > points;
+    for( const auto i : geode::Range{ 100 } )
+    {
+        const auto value = static_cast< double >( i );
+        points.push_back( geode::Point2D{ { value, 0.0 } } );
+        points.push_back( geode::Point2D{ { value + 1, 1.0 } } );
+        if( i % 10 == 0 )
+        {
+            points.push_back( geode::Point2D{ { value + 2, 2.0 } } );
+        }
+        else
+        {
+            points.push_back(
+                geode::Point2D{ { value + i % 2, 1.0 - i % 2 } } );
+        }
+    }
+    std::vector< geode::Triangle2D > triangles;
+    for( const auto t : geode::Range{ 100 } )
+    {
+        triangles.emplace_back(
+            points[3 * t], points[3 * t + 1], points[3 * t + 2] );
+    }
+    const auto signs = geode::triangles_area_signs( triangles );
+    for( const auto t : geode::Indices{ triangles } )
+    {
+        OPENGEODE_EXCEPTION(
+            signs[t] == geode::triangle_area_sign( triangles[t] ),
+            "[Test] Wrong result for large triangles_area_signs" );
+    }
+}
+
 void test()
 {
     test_triangle_sign();
+    test_batch_signs();
+    test_large_batch_signs();
 
     geode::Logger::info( "TEST SUCCESS" );
 }
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <async++.h>
+
+#include <geode/basic/logger.hpp>
+#include <geode/basic/range.hpp>
+
+#include <geode/image/core/raster_image.hpp>
+#include <geode/image/core/rgb_color.hpp>
+#include <geode/image/core/tiled_raster_image.hpp>
+
+#include <geode/tests/common.hpp>
+
+geode::RGBColor expected_color( geode::index_t i, geode::index_t j )
+{
+    return { static_cast< geode::local_index_t >( i % 256 ),
+        static_cast< geode::local_index_t >( j % 256 ),
+        static_cast< geode::local_index_t >( ( i + j ) % 2 ? 255 : 0 ) };
+}
+
+geode::RasterImage2D create_raster()
+{
+    geode::RasterImage2D raster{ { 300, 200 } };
+    for( const auto j : geode::Range{ 200 } )
+    {
+        for( const auto i : geode::Range{ 300 } )
+        {
+            raster.set_color(
+                raster.cell_index( { i, j } ), expected_color( i, j ) );
+        }
+    }
+    return raster;
+}
+
+void test_full_resolution( const geode::TiledRasterImage2D& image )
+{
+    OPENGEODE_EXCEPTION(
+        image.nb_cached_tiles() == 0, "[Test] No tile should be loaded" );
+    OPENGEODE_EXCEPTION( image.nb_cells_in_direction( 0, 0 ) == 300
+                             && image.nb_cells_in_direction( 0, 1 ) == 200,
+        "[Test] Wrong number of cells" );
+    for( const auto j : geode::Range{ 64 } )
+    {
+        for( const auto i : geode::Range{ 64 } )
+        {
+            OPENGEODE_EXCEPTION(
+                image.color( 0, { i, j } ) == expected_color( i, j ),
+                "[Test] Wrong color in first tile" );
+        }
+    }
+    OPENGEODE_EXCEPTION(
+        image.nb_cached_tiles() == 1, "[Test] Only one tile should be loaded" );
+    for( const auto j : geode::Range{ 200 } )
+    {
+        for( const auto i : geode::Range{ 300 } )
+        {
+            OPENGEODE_EXCEPTION(
+                image.color( 0, { i, j } ) == expected_color( i, j ),
+                "[Test] Wrong color at ", i, " ", j );
+        }
+    }
+    OPENGEODE_EXCEPTION( image.nb_cached_tiles() == 4,
+        "[Test] Loaded tiles should be bounded by the cache size" );
+}
+
+void test_mipmaps( const geode::TiledRasterImage2D& image )
+{
+    OPENGEODE_EXCEPTION(
+        image.nb_levels() == 10, "[Test] Wrong number of levels" );
+    OPENGEODE_EXCEPTION( image.nb_cells_in_direction( 1, 0 ) == 150
+                             && image.nb_cells_in_direction( 1, 1 ) == 100,
+        "[Test] Wrong number of cells in level 1" );
+    OPENGEODE_EXCEPTION( image.nb_cells_in_direction( 9, 0 ) == 1
+                             && image.nb_cells_in_direction( 9, 1 ) == 1,
+        "[Test] Wrong number of cells in last level" );
+    const geode::RGBColor level1_color{ 21, 11, 128 };
+    OPENGEODE_EXCEPTION( image.color( 1, { 10, 5 } ) == level1_color,
+        "[Test] Wrong color in level 1: ",
+        image.color( 1, { 10, 5 } ).string() );
+
+    const std::vector< geode::TiledRasterImage2D::CellIndices > cells{
+        { 0, 0 }, { 1, 0 }, { 299, 199 }
+    };
+    std::vector< geode::RGBColor > colors( cells.size() );
+    image.colors( 0, cells, absl::MakeSpan( colors ) );
+    for( const auto c : geode::Indices{ cells } )
+    {
+        OPENGEODE_EXCEPTION(
+            colors[c] == expected_color( cells[c][0], cells[c][1] ),
+            "[Test] Wrong batched color" );
+    }
+}
+
+void test_concurrent_access( std::string_view filename )
+{
+    const geode::TiledRasterImage2D image{ filename, 4 };
+    async::parallel_for(
+        async::irange( geode::index_t{ 0 }, geode::index_t{ 200 } ),
+        [&image]( geode::index_t j ) {
+            std::vector< geode::TiledRasterImage2D::CellIndices > cells;
+            for( const auto i : geode::Range{ 300 } )
+            {
+                cells.push_back( { i, j } );
+            }
+            std::vector< geode::RGBColor > colors( cells.size() );
+            image.colors( 0, cells, absl::MakeSpan( colors ) );
+            for( const auto i : geode::Range{ 300 } )
+            {
+                OPENGEODE_EXCEPTION( colors[i] == expected_color( i, j ),
+                    "[Test] Wrong concurrent color at ", i, " ", j );
+            }
+        } );
+    OPENGEODE_EXCEPTION( image.nb_cached_tiles() <= 4,
+        "[Test] Loaded tiles should be bounded by the cache size" );
+}
+
+void test()
+{
+    geode::OpenGeodeImageLibrary::initialize();
+    const auto raster = create_raster();
+    const auto filename = absl::StrCat(
+        "test.", geode::TiledRasterImage2D::native_extension_static() );
+    geode::save_tiled_raster_image( raster, filename, 64 );
+    const geode::TiledRasterImage2D image{ filename, 4 };
+    OPENGEODE_EXCEPTION( image.tile_size() == 64, "[Test] Wrong tile size" );
+    test_full_resolution( image );
+    test_mipmaps( image );
+    test_concurrent_access( filename );
+}
+
+OPENGEODE_TEST( "tiled-raster-image" )
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/tests/common.hpp>
+
+#include <geode/basic/attribute_manager.hpp>
+#include <geode/basic/logger.hpp>
+#include <geode/basic/variable_attribute.hpp>
+
+#include <geode/geometry/basic_objects/triangle.hpp>
+#include <geode/geometry/distance.hpp>
+#include <geode/geometry/point.hpp>
+
+#include <geode/mesh/core/adaptive_grid.hpp>
+#include <geode/mesh/core/light_regular_grid.hpp>
+#include <geode/mesh/helpers/adaptive_grid_attribute.hpp>
+#include <geode/mesh/helpers/euclidean_distance_transform.hpp>
+#include <geode/mesh/helpers/rasterize.hpp>
+
+void test_refinement( geode::AdaptiveGrid2D& grid )
+{
+    OPENGEODE_EXCEPTION(
+        grid.nb_cells( 0 ) == 6, "[Test] Wrong number of coarsest cells" );
+    OPENGEODE_EXCEPTION( grid.nb_cells_in_direction( 1, 0 ) == 5
+                             && grid.nb_cells_in_direction( 1, 1 ) == 3,
+        "[Test] Wrong number of cells on level 1" );
+    OPENGEODE_EXCEPTION(
+        grid.nb_leaf_cells() == 6, "[Test] Wrong initial number of leaves" );
+    auto attribute =
+        grid.cell_attribute_manager( 0 )
+            .find_or_create_attribute< geode::VariableAttribute, double >(
+                "value", 0 );
+    const geode::AdaptiveGrid2D::Cell coarse{ 0, { 0, 0 } };
+    attribute->set_value( grid.cell_id( coarse ).value(), 42 );
+    grid.refine( coarse );
+    OPENGEODE_EXCEPTION( !grid.is_leaf( coarse ) && grid.nb_cells( 1 ) == 4
+                             && grid.nb_leaf_cells() == 9,
+        "[Test] Wrong refinement" );
+    const auto children = grid.children( coarse );
+    OPENGEODE_EXCEPTION(
+        children.size() == 4, "[Test] Wrong number of children" );
+    const auto child_attribute =
+        grid.cell_attribute_manager( 1 ).find_attribute< double >( "value" );
+    for( const auto& child : children )
+    {
+        OPENGEODE_EXCEPTION( grid.is_leaf( child )
+                                 && grid.parent( child ).value() == coarse,
+            "[Test] Wrong child" );
+        OPENGEODE_EXCEPTION(
+            child_attribute->value( grid.cell_id( child ).value() ) == 42,
+            "[Test] Wrong transferred attribute value" );
+    }
+
+    const std::array< geode::AdaptiveGrid2D::CellIndices, 1 > finest_cells{ {
+        { 9, 5 } } };
+    grid.refine_finest_cells( finest_cells );
+    OPENGEODE_EXCEPTION( grid.nb_cells( 1 ) == 5 && grid.nb_cells( 2 ) == 4
+                             && grid.nb_leaf_cells() == 12,
+        "[Test] Wrong finest cells refinement" );
+    const geode::AdaptiveGrid2D::Cell finest_leaf{ 2, { 9, 5 } };
+    OPENGEODE_EXCEPTION( grid.leaf_cell( { 9, 5 } ) == finest_leaf,
+        "[Test] Wrong finest leaf" );
+    const geode::AdaptiveGrid2D::Cell intermediate_leaf{ 1, { 0, 0 } };
+    OPENGEODE_EXCEPTION( grid.leaf_cell( { 1, 0 } ) == intermediate_leaf,
+        "[Test] Wrong intermediate leaf" );
+    const geode::AdaptiveGrid2D::Cell coarse_leaf{ 0, { 1, 1 } };
+    OPENGEODE_EXCEPTION( grid.leaf_cell( { 5, 5 } ) == coarse_leaf,
+        "[Test] Wrong coarse leaf" );
+    OPENGEODE_EXCEPTION(
+        grid.children( { 0, { 2, 1 } } ).size() == 1, "[Test] Wrong clipping" );
+}
+
+void test_queries( const geode::AdaptiveGrid2D& grid )
+{
+    OPENGEODE_EXCEPTION( grid.contains( geode::Point2D{ { 9.5, 5.5 } } )
+                             && !grid.contains( geode::Point2D{ { 11, 1 } } ),
+        "[Test] Wrong contains" );
+    const auto cells = grid.cells( geode::Point2D{ { 9.5, 5.5 } } );
+    const geode::AdaptiveGrid2D::Cell finest_leaf{ 2, { 9, 5 } };
+    OPENGEODE_EXCEPTION( cells.size() == 1 && cells[0] == finest_leaf,
+        "[Test] Wrong cells around point" );
+    const auto border_cells = grid.cells( geode::Point2D{ { 4, 3 } } );
+    OPENGEODE_EXCEPTION(
+        border_cells.size() == 2, "[Test] Wrong cells around border point" );
+    const geode::Point2D coarse_barycenter{ { 9, 5 } };
+    OPENGEODE_EXCEPTION(
+        grid.cell_barycenter( { 0, { 2, 1 } } ) == coarse_barycenter,
+        "[Test] Wrong coarse cell barycenter" );
+    const geode::Point2D intermediate_barycenter{ { 1, 1 } };
+    OPENGEODE_EXCEPTION(
+        grid.cell_barycenter( { 1, { 0, 0 } } ) == intermediate_barycenter,
+        "[Test] Wrong intermediate cell barycenter" );
+    const geode::AdaptiveGrid2D::VertexIndices closest{ 4, 6 };
+    OPENGEODE_EXCEPTION(
+        grid.closest_vertex( geode::Point2D{ { 5.2, 5.9 } } ) == closest,
+        "[Test] Wrong closest vertex" );
+    const geode::AdaptiveGrid2D::VertexIndices closest_end{ 8, 6 };
+    OPENGEODE_EXCEPTION(
+        grid.closest_vertex( geode::Point2D{ { 6.1, 5.2 } } ) == closest_end,
+        "[Test] Wrong closest vertex near cell end" );
+    const geode::AdaptiveGrid2D::CellIndices central{ 6, 5 };
+    OPENGEODE_EXCEPTION( grid.central_finest_cell( { 0, { 1, 1 } } ) == central,
+        "[Test] Wrong central finest cell" );
+}
+
+void test_adaptive_distance()
+{
+    const geode::LightRegularGrid3D finest_grid{ geode::Point3D{ { 0, 0, 0 } },
+        { 32, 32, 32 }, { 1, 1, 1 } };
+    geode::AdaptiveGrid3D grid{ finest_grid, 5 };
+    const geode::Point3D p0{ { 3.5, 4.2, 5.1 } };
+    const geode::Point3D p1{ { 28.3, 6.7, 10.2 } };
+    const geode::Point3D p2{ { 15.2, 27.1, 20.6 } };
+    const auto raster = geode::conservative_rasterize_triangle(
+        grid.finest_grid(), geode::Triangle3D{ p0, p1, p2 } );
+    grid.refine_finest_cells( raster );
+    for( const auto& cell : raster )
+    {
+        OPENGEODE_EXCEPTION(
+            grid.leaf_cell( cell ).level == grid.finest_level(),
+            "[Test] Rasterized cell is not a finest leaf" );
+    }
+    geode::Logger::info( "Adaptive grid: ", grid.nb_leaf_cells(),
+        " leaves for ", grid.finest_grid().nb_cells(), " finest cells" );
+    OPENGEODE_EXCEPTION(
+        grid.nb_leaf_cells() < grid.finest_grid().nb_cells() / 4,
+        "[Test] Too many leaves" );
+
+    const geode::Triangle3D triangle{ p0, p1, p2 };
+    const auto cell_distance =
+        [&grid, &triangle]( const geode::AdaptiveGrid3D::Cell& cell ) {
+            const auto center = grid.finest_grid().cell_barycenter(
+                grid.central_finest_cell( cell ) );
+            return std::get< 0 >(
+                geode::point_triangle_distance( center, triangle ) );
+        };
+    geode::sample_cell_attribute( grid, cell_distance, "distance",
+        std::numeric_limits< double >::max() );
+    OPENGEODE_EXCEPTION(
+        !grid.finest_grid().cell_attribute_manager().attribute_exists(
+            "distance" ),
+        "[Test] No attribute should be created on the finest grid" );
+    for( const auto level : geode::LRange{ grid.nb_levels() } )
+    {
+        const auto sampled =
+            grid.cell_attribute_manager( level ).find_attribute< double >(
+                "distance" );
+        for( const auto cell_id : geode::Range{ grid.nb_cells( level ) } )
+        {
+            OPENGEODE_EXCEPTION( sampled->value( cell_id )
+                                     == cell_distance(
+                                         grid.cell( level, cell_id ) ),
+                "[Test] Wrong sampled distance" );
+        }
+    }
+}
+
+void test_finest_attribute_sampling( const geode::AdaptiveGrid2D& grid )
+{
+    const auto distance = geode::euclidean_distance_transform< 2 >(
+        grid.finest_grid(),
+        std::array< geode::Grid2D::CellIndices, 1 >{ { { 9, 5 } } },
+        "distance" );
+    geode::sample_finest_cell_attribute(
+        grid, *distance, "distance", std::numeric_limits< double >::max() );
+    for( const auto level : geode::LRange{ grid.nb_levels() } )
+    {
+        const auto sampled =
+            grid.cell_attribute_manager( level ).find_attribute< double >(
+                "distance" );
+        for( const auto cell_id : geode::Range{ grid.nb_cells( level ) } )
+        {
+            const auto central = grid.central_finest_cell(
+                grid.cell( level, cell_id ) );
+            OPENGEODE_EXCEPTION(
+                sampled->value( cell_id )
+                    == distance->value(
+                        grid.finest_grid().cell_index( central ) ),
+                "[Test] Wrong sampled finest distance" );
+        }
+    }
+}
+
+void test()
+{
+    geode::OpenGeodeMeshLibrary::initialize();
+    geode::AdaptiveGrid2D grid{ geode::Point2D{ { 0, 0 } }, { 10, 6 },
+        { 1, 1 }, 3 };
+    test_refinement( grid );
+    test_queries( grid );
+    test_finest_attribute_sampling( grid );
+    test_adaptive_distance();
+}
+
+OPENGEODE_TEST( "adaptive-grid" )
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/basic/attribute_manager.hpp>
+#include <geode/basic/logger.hpp>
+#include <geode/basic/timer.hpp>
+
+#include <geode/geometry/point.hpp>
+#include <geode/geometry/vector.hpp>
+
+#include <geode/mesh/core/light_regular_grid.hpp>
+#include <geode/mesh/helpers/bricked_grid_values.hpp>
+#include <geode/mesh/helpers/euclidean_distance_transform.hpp>
+
+#include <geode/tests/common.hpp>
+
+void test_layout()
+{
+    const geode::GridBrickLayout3D layout{ { 10, 7, 5 }, 4 };
+    OPENGEODE_EXCEPTION(
+        layout.nb_bricks() == 3 * 2 * 2, "[Test] Wrong number of bricks" );
+    OPENGEODE_EXCEPTION( layout.nb_storage_values() == 12 * 64,
+        "[Test] Wrong number of storage values" );
+    OPENGEODE_EXCEPTION( layout.storage_index( { 0, 0, 0 } ) == 0,
+        "[Test] Wrong storage index" );
+    OPENGEODE_EXCEPTION( layout.storage_index( { 1, 1, 1 } ) == 21,
+        "[Test] Wrong storage index" );
+    OPENGEODE_EXCEPTION( layout.storage_index( { 4, 0, 0 } ) == 64,
+        "[Test] Wrong storage index" );
+    OPENGEODE_EXCEPTION( layout.storage_index( { 0, 4, 4 } ) == 9 * 64,
+        "[Test] Wrong storage index" );
+    std::vector< bool > visited( layout.nb_storage_values(), false );
+    geode::index_t nb_visited{ 0 };
+    for( const auto brick : geode::Range{ layout.nb_bricks() } )
+    {
+        layout.for_each_element_in_brick(
+            brick, [&]( const geode::GridBrickLayout3D::ElementIndices& indices,
+                       geode::index_t storage_index ) {
+                OPENGEODE_EXCEPTION(
+                    layout.storage_index( indices ) == storage_index,
+                    "[Test] Wrong storage index in brick iteration" );
+                OPENGEODE_EXCEPTION( !visited[storage_index],
+                    "[Test] Element visited twice" );
+                visited[storage_index] = true;
+                nb_visited++;
+            } );
+    }
+    OPENGEODE_EXCEPTION(
+        nb_visited == 10 * 7 * 5, "[Test] Wrong number of visited elements" );
+}
+
+void test_import_export()
+{
+    const geode::LightRegularGrid2D grid{ geode::Point2D{ { 0, 0 } },
+        { 13, 9 }, { 1, 1 } };
+    auto attribute =
+        grid.cell_attribute_manager()
+            .find_or_create_attribute< geode::VariableAttribute, double >(
+                "values", 0 );
+    for( const auto cell : geode::Range{ grid.nb_cells() } )
+    {
+        attribute->set_value( cell, cell );
+    }
+    geode::BrickedGridValues< double, 2 > values{
+        geode::grid_cell_brick_layout( grid, 4 ), -1
+    };
+    values.import_values( *attribute );
+    OPENGEODE_EXCEPTION(
+        values.value( { 5, 3 } ) == grid.cell_index( { 5, 3 } ),
+        "[Test] Wrong imported value" );
+    values.modify_value( { 12, 8 }, []( double& value ) {
+        value *= 2;
+    } );
+    auto output =
+        grid.cell_attribute_manager()
+            .find_or_create_attribute< geode::VariableAttribute, double >(
+                "output", -1 );
+    values.export_values( *output );
+    for( const auto cell : geode::Range{ grid.nb_cells() - 1 } )
+    {
+        OPENGEODE_EXCEPTION( output->value( cell ) == attribute->value( cell ),
+            "[Test] Wrong exported value" );
+    }
+    OPENGEODE_EXCEPTION(
+        output->value( grid.nb_cells() - 1 ) == 2 * ( grid.nb_cells() - 1 ),
+        "[Test] Wrong modified value" );
+}
+
+std::vector< geode::Grid3D::CellIndices > sources( geode::index_t size )
+{
+    return { { 0, 0, 0 }, { size / 2, size / 3, size - 1 },
+        { size - 1, size / 2, size / 4 } };
+}
+
+double gradient_norm_sum( const geode::LightRegularGrid3D& grid,
+    const geode::ReadOnlyAttribute< double >& distance )
+{
+    double sum{ 0 };
+    for( const auto k : geode::Range{ 1, grid.nb_cells_in_direction( 2 ) - 1 } )
+    {
+        for( const auto j :
+            geode::Range{ 1, grid.nb_cells_in_direction( 1 ) - 1 } )
+        {
+            for( const auto i :
+                geode::Range{ 1, grid.nb_cells_in_direction( 0 ) - 1 } )
+            {
+                double norm2{ 0 };
+                for( const auto d : geode::LRange{ 3 } )
+                {
+                    geode::Grid3D::CellIndices next{ i, j, k };
+                    geode::Grid3D::CellIndices previous{ i, j, k };
+                    next[d]++;
+                    previous[d]--;
+                    const auto diff =
+                        distance.value( grid.cell_index( next ) )
+                        - distance.value( grid.cell_index( previous ) );
+                    norm2 += diff * diff;
+                }
+                sum += std::sqrt( norm2 );
+            }
+        }
+    }
+    return sum;
+}
+
+double gradient_norm_sum( const geode::BrickedGridValues< double, 3 >& values )
+{
+    const auto& layout = values.layout();
+    double sum{ 0 };
+    for( const auto brick : geode::Range{ layout.nb_bricks() } )
+    {
+        layout.for_each_element_in_brick(
+            brick, [&]( const geode::GridBrickLayout3D::ElementIndices& cell,
+                       geode::index_t /*unused*/ ) {
+                for( const auto d : geode::LRange{ 3 } )
+                {
+                    if( cell[d] == 0
+                        || cell[d] + 1 == layout.nb_elements_in_direction( d ) )
+                    {
+                        return;
+                    }
+                }
+                double norm2{ 0 };
+                for( const auto d : geode::LRange{ 3 } )
+                {
+                    auto next = cell;
+                    auto previous = cell;
+                    next[d]++;
+                    previous[d]--;
+                    const auto diff =
+                        values.value( next ) - values.value( previous );
+                    norm2 += diff * diff;
+                }
+                sum += std::sqrt( norm2 );
+            } );
+    }
+    return sum;
+}
+
+void compare_edt( geode::index_t size )
+{
+    const geode::LightRegularGrid3D grid{ geode::Point3D{ { 0, 0, 0 } },
+        { size, size, size }, { 1, 1, 1 } };
+    const auto cells = sources( size );
+    geode::Timer timer;
+    const auto linear =
+        geode::euclidean_distance_transform< 3 >( grid, cells, "linear" );
+    const auto linear_duration = timer.duration();
+    timer.reset();
+    const auto bricked = geode::bricked_euclidean_distance_transform< 3 >(
+        grid, cells, "bricked", 8 );
+    const auto bricked_duration = timer.duration();
+    for( const auto cell : geode::Range{ grid.nb_cells() } )
+    {
+        OPENGEODE_EXCEPTION(
+            std::fabs( linear->value( cell ) - bricked->value( cell ) )
+                < geode::GLOBAL_EPSILON,
+            "[Test] Wrong bricked euclidean distance map" );
+    }
+    geode::Logger::info( "EDT on ", size, "^3 cells: linear ",
+        linear_duration, ", bricked ", bricked_duration );
+
+    timer.reset();
+    const auto linear_sum = gradient_norm_sum( grid, *linear );
+    const auto linear_gradient_duration = timer.duration();
+    geode::BrickedGridValues< double, 3 > values{
+        geode::grid_cell_brick_layout( grid ), 0
+    };
+    values.import_values( *linear );
+    timer.reset();
+    const auto bricked_sum = gradient_norm_sum( values );
+    const auto bricked_gradient_duration = timer.duration();
+    OPENGEODE_EXCEPTION(
+        std::fabs( linear_sum - bricked_sum ) < 1e-6 * linear_sum,
+        "[Test] Wrong bricked gradient" );
+    geode::Logger::info( "Gradient on ", size, "^3 cells: linear ",
+        linear_gradient_duration, ", bricked ", bricked_gradient_duration );
+}
+
+void test()
+{
+    geode::OpenGeodeMeshLibrary::initialize();
+    test_layout();
+    test_import_export();
+    compare_edt( 20 );
+    // Increase the size (e.g. 512) to benchmark the cache-blocked layout
+    compare_edt( 64 );
+}
+
+OPENGEODE_TEST( "bricked-grid-values" )
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/basic/assert.hpp>
+
+#include <geode/geometry/aabb.hpp>
+#include <geode/geometry/bounding_box.hpp>
+#include <geode/geometry/point.hpp>
+
+#include <geode/mesh/core/triangulated_surface.hpp>
+#include <geode/mesh/helpers/aabb_surface_helpers.hpp>
+#include <geode/mesh/helpers/closest_triangle_grid.hpp>
+#include <geode/mesh/io/triangulated_surface_input.hpp>
+
+#include <geode/tests/common.hpp>
+
+std::vector< geode::Point3D > queries(
+    const geode::TriangulatedSurface3D& surface, geode::index_t nb_queries )
+{
+    const auto box = surface.bounding_box();
+    std::vector< geode::Point3D > result;
+    result.reserve( nb_queries );
+    for( const auto q : geode::Range{ nb_queries } )
+    {
+        std::array< double, 3 > coordinates;
+        for( const auto d : geode::LRange{ 3 } )
+        {
+            // Deterministic pseudo-random sampling, some points are outside
+            // the surface bounding box
+            const auto ratio =
+                std::fmod( ( q + 1 ) * ( 0.6180339887 + 0.1 * d ), 1. );
+            const auto extent = box.max().value( d ) - box.min().value( d );
+            coordinates[d] =
+                box.min().value( d ) + ( 1.2 * ratio - 0.1 ) * extent;
+        }
+        result.emplace_back( coordinates );
+    }
+    return result;
+}
+
+void test_closest_triangle_grid()
+{
+    const auto surface = geode::load_triangulated_surface< 3 >(
+        absl::StrCat( geode::DATA_PATH, "modified_Armadillo.og_tsf3d" ) );
+    const auto points = queries( *surface, 100000 );
+
+    const geode::TriangulatedSurfaceAABB3D aabb{ *surface };
+    std::vector< double > aabb_distances( points.size() );
+    for( const auto q : geode::Indices{ points } )
+    {
+        aabb_distances[q] = std::get< 1 >( aabb.closest_element( points[q] ) );
+    }
+
+    const geode::ClosestTriangleGrid grid{ *surface };
+    std::vector< double > grid_distances( points.size() );
+    for( const auto q : geode::Indices{ points } )
+    {
+        grid_distances[q] =
+            std::get< 1 >( grid.closest_triangle( points[q] ) );
+    }
+    const auto parallel_results = grid.closest_triangles( points );
+
+    for( const auto q : geode::Indices{ points } )
+    {
+        OPENGEODE_EXCEPTION(
+            std::fabs( aabb_distances[q] - grid_distances[q] )
+                < geode::GLOBAL_EPSILON,
+            "[Test] Wrong closest triangle distance" );
+        OPENGEODE_EXCEPTION(
+            std::get< 1 >( parallel_results[q] ) == grid_distances[q],
+            "[Test] Wrong parallel closest triangle distance" );
+    }
+}
+
+void test()
+{
+    geode::OpenGeodeMeshLibrary::initialize();
+    test_closest_triangle_grid();
+}
+
+OPENGEODE_TEST( "closest-triangle-grid" )
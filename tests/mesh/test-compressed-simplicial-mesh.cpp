@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/basic/assert.hpp>
+#include <geode/basic/range.hpp>
+
+#include <geode/geometry/point.hpp>
+#include <geode/geometry/vector.hpp>
+
+#include <geode/mesh/core/light_regular_grid.hpp>
+#include <geode/mesh/core/tetrahedral_solid.hpp>
+#include <geode/mesh/core/triangulated_surface.hpp>
+#include <geode/mesh/helpers/compressed_simplicial_mesh.hpp>
+#include <geode/mesh/helpers/convert_solid_mesh.hpp>
+#include <geode/mesh/io/triangulated_surface_input.hpp>
+
+#include <geode/tests/common.hpp>
+
+template < typename Compressed >
+void check_surface( const geode::TriangulatedSurface3D& surface,
+    const Compressed& compressed )
+{
+    OPENGEODE_EXCEPTION( compressed.nb_vertices() == surface.nb_vertices(),
+        "[Test] Wrong number of vertices" );
+    OPENGEODE_EXCEPTION( compressed.nb_polygons() == surface.nb_polygons(),
+        "[Test] Wrong number of triangles" );
+    for( const auto v : geode::Range{ surface.nb_vertices() } )
+    {
+        OPENGEODE_EXCEPTION( compressed.point( v ) == surface.point( v ),
+            "[Test] Wrong point" );
+    }
+    for( const auto p : geode::Range{ surface.nb_polygons() } )
+    {
+        for( const auto e : geode::LRange{ 3 } )
+        {
+            OPENGEODE_EXCEPTION( compressed.polygon_vertex( { p, e } )
+                                     == surface.polygon_vertex( { p, e } ),
+                "[Test] Wrong triangle vertex" );
+            OPENGEODE_EXCEPTION( compressed.polygon_adjacent_edge( { p, e } )
+                                     == surface.polygon_adjacent_edge(
+                                         { p, e } ),
+                "[Test] Wrong triangle adjacency" );
+        }
+    }
+}
+
+template < typename Compressed >
+void check_solid(
+    const geode::TetrahedralSolid3D& solid, const Compressed& compressed )
+{
+    OPENGEODE_EXCEPTION( compressed.nb_vertices() == solid.nb_vertices(),
+        "[Test] Wrong number of vertices" );
+    OPENGEODE_EXCEPTION( compressed.nb_polyhedra() == solid.nb_polyhedra(),
+        "[Test] Wrong number of tetrahedra" );
+    for( const auto v : geode::Range{ solid.nb_vertices() } )
+    {
+        OPENGEODE_EXCEPTION( compressed.point( v ) == solid.point( v ),
+            "[Test] Wrong point" );
+    }
+    for( const auto p : geode::Range{ solid.nb_polyhedra() } )
+    {
+        for( const auto f : geode::LRange{ 4 } )
+        {
+            OPENGEODE_EXCEPTION( compressed.polyhedron_vertex( { p, f } )
+                                     == solid.polyhedron_vertex( { p, f } ),
+                "[Test] Wrong tetrahedron vertex" );
+            OPENGEODE_EXCEPTION(
+                compressed.polyhedron_adjacent_facet( { p, f } )
+                    == solid.polyhedron_adjacent_facet( { p, f } ),
+                "[Test] Wrong tetrahedron adjacency" );
+        }
+    }
+}
+
+void test_surface()
+{
+    auto surface = geode::load_triangulated_surface< 3 >(
+        absl::StrCat( geode::DATA_PATH, "modified_Armadillo.og_tsf3d" ) );
+    const geode::CompressedTriangulatedSurface3D unsorted{ *surface };
+    check_surface( *surface, unsorted );
+
+    const auto mappings =
+        geode::sort_triangulated_surface_spatially( *surface );
+    OPENGEODE_EXCEPTION( mappings.vertices.size() == surface->nb_vertices(),
+        "[Test] Wrong vertex mapping size" );
+    OPENGEODE_EXCEPTION( mappings.elements.size() == surface->nb_polygons(),
+        "[Test] Wrong triangle mapping size" );
+    const geode::CompressedTriangulatedSurface3D compressed{ *surface };
+    check_surface( *surface, compressed );
+    OPENGEODE_EXCEPTION(
+        compressed.connectivity_nb_bytes() < surface->nb_polygons() * 24,
+        "[Test] Compressed connectivity should be smaller" );
+
+    const auto decompressed = compressed.decompress();
+    check_surface( *decompressed, compressed );
+}
+
+void test_solid()
+{
+    const geode::LightRegularGrid3D grid{ geode::Point3D{ { 0, 0, 0 } },
+        { 20, 15, 10 }, { 1, 1, 1 } };
+    auto solid = geode::convert_grid_into_tetrahedral_solid( grid );
+    const geode::CompressedTetrahedralSolid3D unsorted{ *solid };
+    check_solid( *solid, unsorted );
+
+    const auto mappings = geode::sort_tetrahedral_solid_spatially( *solid );
+    OPENGEODE_EXCEPTION( mappings.elements.size() == solid->nb_polyhedra(),
+        "[Test] Wrong tetrahedron mapping size" );
+    const geode::CompressedTetrahedralSolid3D compressed{ *solid };
+    check_solid( *solid, compressed );
+    OPENGEODE_EXCEPTION(
+        compressed.connectivity_nb_bytes() < solid->nb_polyhedra() * 32,
+        "[Test] Compressed connectivity should be smaller" );
+
+    const auto decompressed = compressed.decompress();
+    check_solid( *decompressed, compressed );
+}
+
+void test()
+{
+    geode::OpenGeodeMeshLibrary::initialize();
+    test_surface();
+    test_solid();
+}
+
+OPENGEODE_TEST( "compressed-simplicial-mesh" )
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/basic/attribute_manager.hpp>
+#include <geode/basic/logger.hpp>
+
+#include <geode/geometry/basic_objects/tetrahedron.hpp>
+#include <geode/geometry/point.hpp>
+#include <geode/geometry/quality.hpp>
+
+#include <geode/mesh/builder/tetrahedral_solid_builder.hpp>
+#include <geode/mesh/builder/triangulated_surface_builder.hpp>
+#include <geode/mesh/core/tetrahedral_solid.hpp>
+#include <geode/mesh/core/triangulated_surface.hpp>
+#include <geode/mesh/helpers/mesh_quality.hpp>
+
+#include <geode/tests/common.hpp>
+
+void test_solid_quality()
+{
+    auto solid = geode::TetrahedralSolid3D::create();
+    auto builder = geode::TetrahedralSolidBuilder3D::create( *solid );
+    builder->create_point( geode::Point3D{ { 0, 0, 0 } } );
+    builder->create_point( geode::Point3D{ { 1, 0, 0 } } );
+    builder->create_point( geode::Point3D{ { 0, 1, 0 } } );
+    builder->create_point( geode::Point3D{ { 0, 0, 1 } } );
+    builder->create_point( geode::Point3D{ { 0.5, 0.5, 0.01 } } );
+    builder->create_point( geode::Point3D{ { 0, 0, -2 } } );
+    builder->create_tetrahedron( { 0, 1, 2, 3 } );
+    builder->create_tetrahedron( { 1, 2, 3, 4 } );
+    builder->create_tetrahedron( { 0, 2, 1, 5 } );
+
+    geode::QualityReportParameters parameters;
+    parameters.nb_worst_elements = 2;
+    parameters.nb_histogram_bins = 4;
+    parameters.percentiles = { 0, 0.5, 1 };
+    parameters.attribute_name = "volume";
+    const auto report = geode::solid_quality_report(
+        *solid, geode::QUALITY_METRIC::size, parameters );
+    geode::Logger::info( report.string() );
+    OPENGEODE_EXCEPTION(
+        report.nb_elements == 3, "[Test] Wrong number of elements" );
+    OPENGEODE_EXCEPTION( std::fabs( report.min - solid->polyhedron_volume( 1 ) )
+                             < geode::GLOBAL_EPSILON,
+        "[Test] Wrong minimum volume" );
+    OPENGEODE_EXCEPTION(
+        std::fabs( report.max - 1. / 3. ) < geode::GLOBAL_EPSILON,
+        "[Test] Wrong maximum volume" );
+    OPENGEODE_EXCEPTION( report.worst_elements.size() == 2
+                             && report.worst_elements[0].first == 1
+                             && report.worst_elements[1].first == 0,
+        "[Test] Wrong worst elements" );
+    OPENGEODE_EXCEPTION( report.percentiles.size() == 3
+                             && report.percentiles[0].second == report.min
+                             && report.percentiles[2].second == report.max,
+        "[Test] Wrong percentiles" );
+    geode::index_t nb_histogram_elements{ 0 };
+    for( const auto count : report.histogram )
+    {
+        nb_histogram_elements += count;
+    }
+    OPENGEODE_EXCEPTION( report.histogram.size() == 4
+                             && nb_histogram_elements == 3
+                             && report.histogram.back() == 1,
+        "[Test] Wrong histogram" );
+    const auto attribute =
+        solid->polyhedron_attribute_manager()
+            .find_attribute< double >( "volume" );
+    OPENGEODE_EXCEPTION( attribute->value( 2 ) == report.max,
+        "[Test] Wrong stored volume" );
+
+    const auto aspect_ratio_report = geode::solid_quality_report(
+        *solid, geode::QUALITY_METRIC::aspect_ratio, parameters );
+    OPENGEODE_EXCEPTION( aspect_ratio_report.worst_elements.front().first == 1,
+        "[Test] Wrong worst aspect ratio" );
+}
+
+void test_degenerate_quality()
+{
+    auto solid = geode::TetrahedralSolid3D::create();
+    auto builder = geode::TetrahedralSolidBuilder3D::create( *solid );
+    builder->create_point( geode::Point3D{ { 0, 0, 0 } } );
+    builder->create_point( geode::Point3D{ { 1, 0, 0 } } );
+    builder->create_point( geode::Point3D{ { 0, 1, 0 } } );
+    builder->create_point( geode::Point3D{ { 0, 0, 1 } } );
+    builder->create_point( geode::Point3D{ { 1, 1, 0 } } );
+    builder->create_tetrahedron( { 0, 1, 2, 3 } );
+    builder->create_tetrahedron( { 0, 1, 2, 4 } );
+
+    geode::QualityReportParameters parameters;
+    parameters.nb_histogram_bins = 4;
+    parameters.percentiles = { 0, 1 };
+    const auto report = geode::solid_quality_report(
+        *solid, geode::QUALITY_METRIC::aspect_ratio, parameters );
+    geode::Logger::info( report.string() );
+    OPENGEODE_EXCEPTION( report.nb_elements == 1
+                             && report.nb_degenerate_elements == 1,
+        "[Test] Wrong number of degenerate elements" );
+    const auto regular_ratio = geode::tetrahedron_aspect_ratio(
+        geode::Tetrahedron{ solid->point( 0 ), solid->point( 1 ),
+            solid->point( 2 ), solid->point( 3 ) } );
+    OPENGEODE_EXCEPTION( report.min == regular_ratio
+                             && report.max == regular_ratio
+                             && report.mean == regular_ratio,
+        "[Test] Degenerate element should not be in the statistics" );
+    OPENGEODE_EXCEPTION( report.percentiles[0].second == regular_ratio
+                             && report.percentiles[1].second == regular_ratio,
+        "[Test] Degenerate element should not be in the percentiles" );
+    geode::index_t nb_histogram_elements{ 0 };
+    for( const auto count : report.histogram )
+    {
+        nb_histogram_elements += count;
+    }
+    OPENGEODE_EXCEPTION( nb_histogram_elements == 1,
+        "[Test] Degenerate element should not be in the histogram" );
+    OPENGEODE_EXCEPTION( report.worst_elements.front().first == 1,
+        "[Test] Degenerate element should be the worst" );
+}
+
+void test_surface_quality()
+{
+    auto surface = geode::TriangulatedSurface2D::create();
+    auto builder = geode::TriangulatedSurfaceBuilder2D::create( *surface );
+    builder->create_point( geode::Point2D{ { 0, 0 } } );
+    builder->create_point( geode::Point2D{ { 1, 0 } } );
+    builder->create_point( geode::Point2D{ { 0, 1 } } );
+    builder->create_point( geode::Point2D{ { 2, 2 } } );
+    builder->create_triangle( { 0, 1, 2 } );
+    builder->create_triangle( { 1, 3, 2 } );
+    const auto report =
+        geode::surface_quality_report( *surface, geode::QUALITY_METRIC::size );
+    OPENGEODE_EXCEPTION(
+        std::fabs( report.mean - 1. ) < geode::GLOBAL_EPSILON,
+        "[Test] Wrong mean area" );
+    OPENGEODE_EXCEPTION( report.worst_elements.front().first == 0,
+        "[Test] Wrong smallest triangle" );
+}
+
+void test()
+{
+    geode::OpenGeodeMeshLibrary::initialize();
+    test_solid_quality();
+    test_degenerate_quality();
+    test_surface_quality();
+}
+
+OPENGEODE_TEST( "mesh-quality" )
@@ -88,6 +88,15 @@ void test_nn_search3d()
         "[Test] Wrong computation of PointSet3D points" );
 
     check_nnsearch( geode::create_nn_search( *pointset ) );
+
+    const auto view = geode::create_nn_search_view( *pointset );
+    OPENGEODE_EXCEPTION( &view.point( 0 ) == &pointset->point( 0 ),
+        "[Test] NNSearch view should not copy PointSet3D points" );
+    check_nnsearch( view );
+
+    view.save_index( "nnsearch_point_set.og_nns" );
+    check_nnsearch(
+        geode::load_nn_search_view( *pointset, "nnsearch_point_set.og_nns" ) );
 }
 
 void test()
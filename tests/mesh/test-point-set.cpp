@@ -101,6 +101,46 @@ void test_delete_vertex(
         "[Test] PointSet vertex coordinates are not correct" );
 }
 
+void check_bounding_box( const geode::PointSet3D& point_set )
+{
+    geode::BoundingBox3D answer;
+    for( const auto vertex_id : geode::Range{ point_set.nb_vertices() } )
+    {
+        answer.add_point( point_set.point( vertex_id ) );
+    }
+    const auto bbox = point_set.bounding_box();
+    OPENGEODE_EXCEPTION(
+        bbox.min() == answer.min() && bbox.max() == answer.max(),
+        "[Test] Wrong cached bounding box" );
+}
+
+void test_cached_bounding_box(
+    const geode::PointSet3D& point_set, geode::PointSetBuilder3D& builder )
+{
+    check_bounding_box( point_set );
+    builder.set_point( 0, geode::Point3D{ { -3, 12, 1 } } );
+    check_bounding_box( point_set );
+    builder.set_point( 0, geode::Point3D{ { 1, 1, 1 } } );
+    check_bounding_box( point_set );
+    builder.create_point( geode::Point3D{ { 4, -2, 8 } } );
+    check_bounding_box( point_set );
+    std::vector< bool > to_delete( point_set.nb_vertices(), false );
+    to_delete.back() = true;
+    builder.delete_vertices( to_delete );
+    builder.create_point( geode::Point3D{ { 1, 2, 3 } } );
+    check_bounding_box( point_set );
+    const auto revision = point_set.revisions().geometry;
+    auto points = point_set.vertex_attribute_manager()
+                      .find_or_create_attribute< geode::VariableAttribute,
+                          geode::Point3D >( "points", geode::Point3D{} );
+    points->set_value( 1, geode::Point3D{ { 20, -5, 0 } } );
+    OPENGEODE_EXCEPTION( point_set.revisions().geometry != revision,
+        "[Test] Geometry revision should follow the points attribute" );
+    check_bounding_box( point_set );
+    points->set_value( 1, geode::Point3D{ { 1, 1, 1 } } );
+    check_bounding_box( point_set );
+}
+
 void test_io( const geode::PointSet3D& point_set, std::string_view filename )
 {
     geode::save_point_set( point_set, filename );
@@ -148,6 +188,7 @@ void test()
     test_permutation( *point_set, *builder );
     test_delete_vertex( *point_set, *builder );
     test_clone( *point_set );
+    test_cached_bounding_box( *point_set, *builder );
 }
 
 OPENGEODE_TEST( "point-set" )
\ No newline at end of file
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include <geode/basic/assert.hpp>
+#include <geode/basic/logger.hpp>
+#include <geode/basic/range.hpp>
+#include <geode/basic/timer.hpp>
+
+#include <geode/geometry/aabb.hpp>
+#include <geode/geometry/point.hpp>
+
+#include <geode/mesh/builder/solid_mesh_builder.hpp>
+#include <geode/mesh/core/polyhedral_solid.hpp>
+#include <geode/mesh/core/triangulated_surface.hpp>
+#include <geode/mesh/helpers/aabb_surface_helpers.hpp>
+#include <geode/mesh/io/polyhedral_solid_input.hpp>
+#include <geode/mesh/io/triangulated_surface_input.hpp>
+
+#include <geode/tests/common.hpp>
+
+namespace
+{
+    std::atomic< std::size_t > nb_allocations{ 0 };
+} // namespace
+
+void* operator new( std::size_t size )
+{
+    nb_allocations++;
+    if( auto* pointer = std::malloc( size == 0 ? 1 : size ) )
+    {
+        return pointer;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete( void* pointer ) noexcept
+{
+    std::free( pointer );
+}
+
+void operator delete( void* pointer, std::size_t ) noexcept
+{
+    std::free( pointer );
+}
+
+template < typename Query >
+double allocations_per_query(
+    std::string_view name, geode::index_t nb_queries, const Query& query )
+{
+    geode::index_t nb_results{ 0 };
+#ifdef OPENGEODE_BENCHMARK
+    geode::Timer timer;
+#endif
+    const auto start = nb_allocations.load();
+    for( const auto q : geode::Range{ nb_queries } )
+    {
+        nb_results += query( q );
+    }
+    const auto nb_query_allocations = nb_allocations.load() - start;
+    const auto per_query = static_cast< double >( nb_query_allocations )
+                           / static_cast< double >( nb_queries );
+#ifdef OPENGEODE_BENCHMARK
+    geode::Logger::info( name, ": ", per_query, " allocations per query (",
+        nb_queries, " queries, ", nb_results, " results) in ",
+        timer.duration() );
+#else
+    geode_unused( name );
+    geode_unused( nb_results );
+#endif
+    return per_query;
+}
+
+void check_no_allocation( double allocations, std::string_view query )
+{
+#ifdef OPENGEODE_UNTRACKED_ALLOCATIONS
+    // Allocations made inside shared libraries are not counted
+    geode_unused( allocations );
+    geode_unused( query );
+#else
+    OPENGEODE_EXCEPTION(
+        allocations == 0, "[Test] ", query, " should not allocate" );
+#endif
+}
+
+void test_surface_queries()
+{
+    const auto surface = geode::load_triangulated_surface< 3 >(
+        absl::StrCat( geode::DATA_PATH, "modified_Armadillo.og_tsf3d" ) );
+    const auto nb_vertices = surface->nb_vertices();
+    for( const auto v : geode::Range{ nb_vertices } )
+    {
+        geode_unused( surface->polygons_around_vertex( v ) );
+    }
+    const auto cached_allocations = allocations_per_query(
+        "polygons_around_vertex", nb_vertices, [&surface]( geode::index_t v ) {
+            return surface->polygons_around_vertex( v ).size();
+        } );
+    check_no_allocation( cached_allocations, "Cached polygons_around_vertex" );
+    allocations_per_query( "SurfaceMesh::vertices_around_vertex", nb_vertices,
+        [&surface]( geode::index_t v ) {
+            return surface->vertices_around_vertex( v ).size();
+        } );
+
+    const auto tree = geode::create_aabb_tree( *surface );
+    const auto nb_polygons = surface->nb_polygons();
+    std::vector< geode::Point3D > barycenters;
+    barycenters.reserve( nb_polygons );
+    for( const auto p : geode::Range{ nb_polygons } )
+    {
+        barycenters.push_back( surface->polygon_barycenter( p ) );
+    }
+    allocations_per_query( "AABBTree::containing_boxes", nb_polygons,
+        [&tree, &barycenters]( geode::index_t p ) {
+            return tree.containing_boxes( barycenters[p] ).size();
+        } );
+    std::vector< geode::index_t > buffer;
+    for( const auto& barycenter : barycenters )
+    {
+        tree.containing_boxes( barycenter, buffer );
+    }
+    const auto buffered_allocations = allocations_per_query(
+        "AABBTree::containing_boxes with buffer", nb_polygons,
+        [&tree, &barycenters, &buffer]( geode::index_t p ) {
+            tree.containing_boxes( barycenters[p], buffer );
+            return buffer.size();
+        } );
+    check_no_allocation( buffered_allocations, "Buffered containing_boxes" );
+}
+
+void test_solid_queries()
+{
+    auto solid = geode::load_polyhedral_solid< 3 >(
+        absl::StrCat( geode::DATA_PATH, "test_v12.og_pso3d" ) );
+    geode::SolidMeshBuilder3D::create( *solid )
+        ->compute_polyhedron_adjacencies();
+    const auto nb_vertices = solid->nb_vertices();
+    for( const auto v : geode::Range{ nb_vertices } )
+    {
+        geode_unused( solid->polyhedra_around_vertex( v ) );
+    }
+    const auto cached_allocations = allocations_per_query(
+        "polyhedra_around_vertex", nb_vertices, [&solid]( geode::index_t v ) {
+            return solid->polyhedra_around_vertex( v ).size();
+        } );
+    check_no_allocation( cached_allocations, "Cached polyhedra_around_vertex" );
+    allocations_per_query( "SolidMesh::vertices_around_vertex", nb_vertices,
+        [&solid]( geode::index_t v ) {
+            return solid->vertices_around_vertex( v ).size();
+        } );
+    const auto nb_polyhedra = solid->nb_polyhedra();
+    allocations_per_query(
+        "polyhedra_around_edge", nb_polyhedra, [&solid]( geode::index_t p ) {
+            return solid->polyhedra_around_edge( { { p, 0 }, 0 } ).size();
+        } );
+    allocations_per_query( "polyhedron_vertex_facets", nb_polyhedra,
+        [&solid]( geode::index_t p ) {
+            return solid->polyhedron_vertex_facets( { p, 0 } ).size();
+        } );
+}
+
+void test()
+{
+    geode::OpenGeodeMeshLibrary::initialize();
+    test_surface_queries();
+    test_solid_queries();
+}
+
+OPENGEODE_TEST( "query-allocations" )
@@ -23,19 +23,25 @@
 
 #include <geode/tests/common.hpp>
 
+#include <absl/container/flat_hash_map.h>
 #include <absl/container/flat_hash_set.h>
 
 #include <geode/basic/assert.hpp>
 #include <geode/basic/logger.hpp>
+#include <geode/basic/variable_attribute.hpp>
 
 #include <geode/geometry/basic_objects/segment.hpp>
+#include <geode/geometry/basic_objects/tetrahedron.hpp>
 #include <geode/geometry/basic_objects/triangle.hpp>
 #include <geode/geometry/point.hpp>
 
 #include <geode/mesh/builder/regular_grid_solid_builder.hpp>
 #include <geode/mesh/builder/regular_grid_surface_builder.hpp>
+#include <geode/mesh/builder/tetrahedral_solid_builder.hpp>
+#include <geode/mesh/builder/triangulated_surface_builder.hpp>
 #include <geode/mesh/core/regular_grid_solid.hpp>
 #include <geode/mesh/core/regular_grid_surface.hpp>
+#include <geode/mesh/core/tetrahedral_solid.hpp>
 #include <geode/mesh/core/triangulated_surface.hpp>
 #include <geode/mesh/helpers/rasterize.hpp>
 #include <geode/mesh/io/regular_grid_input.hpp>
@@ -216,6 +222,78 @@ void test_limit()
         all_cells.size(), " instead of 27" );
 }
 
+void test_rasterize_surface( const geode::RegularGrid3D& grid )
+{
+    auto surface = geode::TriangulatedSurface3D::create();
+    auto builder = geode::TriangulatedSurfaceBuilder3D::create( *surface );
+    builder->create_point( geode::Point3D{ { 0.5, 0.5, 0.5 } } );
+    builder->create_point( geode::Point3D{ { 8.2, 1.3, 2.7 } } );
+    builder->create_point( geode::Point3D{ { 3.1, 9.4, 4.6 } } );
+    builder->create_point( geode::Point3D{ { 5.6, 4.4, 9.3 } } );
+    builder->create_triangle( { 0, 1, 2 } );
+    builder->create_triangle( { 1, 2, 3 } );
+    builder->create_triangle( { 0, 3, 1 } );
+    absl::flat_hash_map< geode::index_t, geode::index_t > expected;
+    for( const auto t : geode::Range{ surface->nb_polygons() } )
+    {
+        for( const auto& cell : geode::conservative_rasterize_triangle(
+                 grid, surface->triangle( t ) ) )
+        {
+            expected.emplace( grid.cell_index( cell ), t );
+        }
+    }
+    const auto cells = geode::conservative_rasterize_surface( grid, *surface );
+    OPENGEODE_EXCEPTION( cells.size() == expected.size(),
+        "[Test] Wrong number of result cells (rasterize_surface): ",
+        cells.size(), " instead of ", expected.size() );
+    for( const auto& cell : cells )
+    {
+        OPENGEODE_EXCEPTION(
+            expected.find( grid.cell_index( cell ) ) != expected.end(),
+            "[Test] Wrong result cells (rasterize_surface)" );
+    }
+    const auto owners = geode::conservative_rasterize_surface_owners(
+        grid, *surface, "owners" );
+    for( const auto cell_id : geode::Range{ grid.nb_cells() } )
+    {
+        const auto it = expected.find( cell_id );
+        const auto owner = it == expected.end() ? geode::NO_ID : it->second;
+        OPENGEODE_EXCEPTION( owners->value( cell_id ) == owner,
+            "[Test] Wrong cell owner (rasterize_surface_owners)" );
+    }
+}
+
+void test_rasterize_solid( const geode::RegularGrid3D& grid )
+{
+    auto solid = geode::TetrahedralSolid3D::create();
+    auto builder = geode::TetrahedralSolidBuilder3D::create( *solid );
+    builder->create_point( geode::Point3D{ { 0.5, 0.5, 0.5 } } );
+    builder->create_point( geode::Point3D{ { 8.2, 1.3, 2.7 } } );
+    builder->create_point( geode::Point3D{ { 3.1, 9.4, 4.6 } } );
+    builder->create_point( geode::Point3D{ { 5.6, 4.4, 9.3 } } );
+    builder->create_point( geode::Point3D{ { 9.1, 8.8, 9.5 } } );
+    builder->create_tetrahedron( { 0, 1, 2, 3 } );
+    builder->create_tetrahedron( { 1, 2, 3, 4 } );
+    absl::flat_hash_set< geode::Grid3D::CellIndices > expected;
+    for( const auto t : geode::Range{ solid->nb_polyhedra() } )
+    {
+        for( const auto& cell :
+            geode::rasterize_tetrahedron( grid, solid->tetrahedron( t ) ) )
+        {
+            expected.insert( cell );
+        }
+    }
+    const auto cells = geode::rasterize_solid( grid, *solid );
+    OPENGEODE_EXCEPTION( cells.size() == expected.size(),
+        "[Test] Wrong number of result cells (rasterize_solid): ",
+        cells.size(), " instead of ", expected.size() );
+    for( const auto& cell : cells )
+    {
+        OPENGEODE_EXCEPTION( expected.find( cell ) != expected.end(),
+            "[Test] Wrong result cells (rasterize_solid)" );
+    }
+}
+
 void test()
 {
     geode::OpenGeodeMeshLibrary::initialize();
@@ -237,6 +315,8 @@ void test()
         *grid, geode::Triangle3D{ pt0, pt3, pt4 } );
 
     test_limit();
+    test_rasterize_surface( *grid );
+    test_rasterize_solid( *grid );
 }
 
 OPENGEODE_TEST( "rasterize" )
\ No newline at end of file
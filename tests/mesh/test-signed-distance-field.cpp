@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/tests/common.hpp>
+
+#include <geode/geometry/point.hpp>
+#include <geode/geometry/vector.hpp>
+
+#include <geode/mesh/builder/triangulated_surface_builder.hpp>
+#include <geode/mesh/core/light_regular_grid.hpp>
+#include <geode/mesh/core/triangulated_surface.hpp>
+#include <geode/mesh/helpers/signed_distance_field.hpp>
+
+std::unique_ptr< geode::TriangulatedSurface3D > create_box()
+{
+    auto surface = geode::TriangulatedSurface3D::create();
+    auto builder = geode::TriangulatedSurfaceBuilder3D::create( *surface );
+    for( const auto v : geode::LRange{ 8 } )
+    {
+        builder->create_point( geode::Point3D{ { v % 2 == 0 ? 2. : 8.,
+            ( v / 2 ) % 2 == 0 ? 2. : 8., v / 4 == 0 ? 2. : 8. } } );
+    }
+    builder->create_triangle( { 0, 2, 3 } );
+    builder->create_triangle( { 0, 3, 1 } );
+    builder->create_triangle( { 4, 5, 7 } );
+    builder->create_triangle( { 4, 7, 6 } );
+    builder->create_triangle( { 0, 1, 5 } );
+    builder->create_triangle( { 0, 5, 4 } );
+    builder->create_triangle( { 2, 6, 7 } );
+    builder->create_triangle( { 2, 7, 3 } );
+    builder->create_triangle( { 0, 4, 6 } );
+    builder->create_triangle( { 0, 6, 2 } );
+    builder->create_triangle( { 1, 3, 7 } );
+    builder->create_triangle( { 1, 7, 5 } );
+    return surface;
+}
+
+double box_signed_distance( const geode::Point3D& point )
+{
+    double outside{ 0 };
+    double inside{ -std::numeric_limits< double >::max() };
+    for( const auto d : geode::LRange{ 3 } )
+    {
+        const auto gap = std::fabs( point.value( d ) - 5. ) - 3.;
+        outside += std::max( gap, 0. ) * std::max( gap, 0. );
+        inside = std::max( inside, gap );
+    }
+    return inside > 0 ? std::sqrt( outside ) : inside;
+}
+
+void test_signed_distance_field( geode::index_t narrow_band_width )
+{
+    const geode::LightRegularGrid3D grid{ geode::Point3D{ { 0, 0, 0 } },
+        { 12, 11, 10 }, { 1, 1, 1 } };
+    const auto box = create_box();
+    const auto distance_map = geode::signed_distance_field(
+        grid, *box, "sdf", narrow_band_width );
+    for( const auto cell : geode::Range{ grid.nb_cells() } )
+    {
+        const auto center =
+            grid.cell_barycenter( grid.cell_indices( cell ) );
+        const auto expected = box_signed_distance( center );
+        OPENGEODE_EXCEPTION(
+            std::fabs( distance_map->value( cell ) - expected )
+                < geode::GLOBAL_EPSILON,
+            "[Test] Wrong signed distance at ", center.string(), ": ",
+            distance_map->value( cell ), " instead of ", expected );
+    }
+}
+
+void test()
+{
+    geode::OpenGeodeMeshLibrary::initialize();
+    test_signed_distance_field( 2 );
+    test_signed_distance_field( 0 );
+}
+
+OPENGEODE_TEST( "signed-distance-field" )
@@ -23,6 +23,7 @@
 
 #include <geode/basic/attribute_manager.hpp>
 #include <geode/basic/logger.hpp>
+#include <geode/basic/timer.hpp>
 #include <geode/basic/variable_attribute.hpp>
 
 #include <geode/geometry/basic_objects/tetrahedron.hpp>
@@ -34,8 +35,10 @@
 #include <geode/mesh/builder/solid_edges_builder.hpp>
 #include <geode/mesh/builder/solid_facets_builder.hpp>
 #include <geode/mesh/core/geode/geode_tetrahedral_solid.hpp>
+#include <geode/mesh/core/light_regular_grid.hpp>
 #include <geode/mesh/core/solid_edges.hpp>
 #include <geode/mesh/core/solid_facets.hpp>
+#include <geode/mesh/helpers/convert_solid_mesh.hpp>
 #include <geode/mesh/io/tetrahedral_solid_input.hpp>
 #include <geode/mesh/io/tetrahedral_solid_output.hpp>
 
@@ -161,6 +164,136 @@ void test_is_on_border( const geode::TetrahedralSolid3D& solid )
     }
 }
 
+void test_compact_facets_and_edges( const geode::TetrahedralSolid3D& solid )
+{
+    geode::index_t nb_facets{ 0 };
+    for( const auto p : geode::Range{ solid.nb_polyhedra() } )
+    {
+        for( const auto& facet : solid.polyhedron_facets_vertices( p ) )
+        {
+            const auto facet_id =
+                solid.facets().facet_from_vertices( facet ).value();
+            OPENGEODE_EXCEPTION( facet_id <= nb_facets,
+                "[Test] Facets should be indexed by first occurrence" );
+            if( facet_id == nb_facets )
+            {
+                nb_facets++;
+            }
+        }
+    }
+    std::vector< geode::PolyhedronFacetVertices > facets;
+    for( const auto f : geode::Range{ solid.facets().nb_facets() } )
+    {
+        facets.push_back( solid.facets().facet_vertices( f ) );
+    }
+    std::vector< std::array< geode::index_t, 2 > > edges;
+    for( const auto e : geode::Range{ solid.edges().nb_edges() } )
+    {
+        edges.push_back( solid.edges().edge_vertices( e ) );
+    }
+
+    solid.disable_facets();
+    solid.disable_edges();
+    solid.enable_facets();
+    solid.enable_edges();
+    OPENGEODE_EXCEPTION( solid.facets().nb_facets() == facets.size(),
+        "[Test] Wrong number of compact facets" );
+    OPENGEODE_EXCEPTION( solid.edges().nb_edges() == edges.size(),
+        "[Test] Wrong number of compact edges" );
+    for( const auto f : geode::Indices{ facets } )
+    {
+        OPENGEODE_EXCEPTION(
+            solid.facets().facet_from_vertices( facets[f] ) == f,
+            "[Test] Wrong compact facet from vertices" );
+    }
+    for( const auto e : geode::Indices{ edges } )
+    {
+        OPENGEODE_EXCEPTION( solid.edges().edge_from_vertices( edges[e] ) == e,
+            "[Test] Wrong compact edge from vertices" );
+    }
+    OPENGEODE_EXCEPTION(
+        !solid.facets().facet_from_vertices(
+            geode::PolyhedronFacetVertices{ 0, 4, 5 } ),
+        "[Test] Facet should not exist in compact facets" );
+    OPENGEODE_EXCEPTION( !solid.edges().edge_from_vertices( { 0, 4 } ),
+        "[Test] Edge should not exist in compact edges" );
+}
+
+void test_modified_compact_facets_io( const geode::TetrahedralSolid3D& solid )
+{
+    auto modified = solid.clone();
+    modified->disable_facets();
+    modified->enable_facets();
+    const auto filename =
+        absl::StrCat( "compact_facets.", modified->native_extension() );
+    geode::save_tetrahedral_solid( *modified, filename );
+    for( const auto f : geode::Range{ modified->facets().nb_facets() } )
+    {
+        OPENGEODE_EXCEPTION( modified->facets().facet_from_vertices(
+                                 modified->facets().facet_vertices( f ) )
+                                 == f,
+            "[Test] Wrong facet from vertices after saving compact facets" );
+    }
+
+    auto builder = geode::TetrahedralSolidBuilder3D::create( *modified );
+    const auto nb_facets = modified->facets().nb_facets();
+    const auto vertex =
+        builder->create_point( geode::Point3D{ { 5.1, 5.2, 5.3 } } );
+    builder->create_tetrahedron( { 1, 2, 3, vertex } );
+    OPENGEODE_EXCEPTION( modified->facets().nb_facets() == nb_facets + 3,
+        "[Test] Wrong number of facets after modifying compact facets" );
+    geode::save_tetrahedral_solid( *modified, filename );
+    const auto reloaded = geode::load_tetrahedral_solid< 3 >(
+        geode::OpenGeodeTetrahedralSolid3D::impl_name_static(), filename );
+    OPENGEODE_EXCEPTION(
+        reloaded->facets().nb_facets() == modified->facets().nb_facets(),
+        "[Test] Wrong number of reloaded facets" );
+    for( const auto f : geode::Range{ modified->facets().nb_facets() } )
+    {
+        OPENGEODE_EXCEPTION( reloaded->facets().facet_from_vertices(
+                                 modified->facets().facet_vertices( f ) )
+                                 == f,
+            "[Test] Wrong reloaded facet from vertices" );
+    }
+}
+
+#ifdef OPENGEODE_BENCHMARK
+void benchmark_facets()
+{
+    const geode::LightRegularGrid3D grid{ geode::Point3D{ { 0, 0, 0 } },
+        { 60, 60, 60 }, { 1, 1, 1 } };
+    auto solid = geode::convert_grid_into_tetrahedral_solid( grid );
+    geode::Timer timer;
+    solid->enable_facets();
+    solid->enable_edges();
+    const auto build_duration = timer.duration();
+    timer.reset();
+    geode::index_t nb_queries{ 0 };
+    for( const auto p : geode::Range{ solid->nb_polyhedra() } )
+    {
+        for( const auto& facet : solid->polyhedron_facets_vertices( p ) )
+        {
+            if( solid->facets().facet_from_vertices( facet ) )
+            {
+                nb_queries++;
+            }
+        }
+    }
+    const auto query_duration = timer.duration();
+    timer.reset();
+    auto builder = geode::TetrahedralSolidBuilder3D::create( *solid );
+    const auto vertex =
+        builder->create_point( geode::Point3D{ { -1, -1, -1 } } );
+    builder->create_tetrahedron( { 0, 1, grid.nb_vertices_in_direction( 0 ),
+        vertex } );
+    const auto expand_duration = timer.duration();
+    geode::Logger::info( solid->facets().nb_facets(), " facets and ",
+        solid->edges().nb_edges(), " edges built in ", build_duration, ", ",
+        nb_queries, " facet queries in ", query_duration,
+        ", hash maps built on first modification in ", expand_duration );
+}
+#endif
+
 void test_permutation( const geode::TetrahedralSolid3D& solid,
     geode::TetrahedralSolidBuilder3D& builder )
 {
@@ -390,12 +523,17 @@ void test()
     test_polyhedron_facet_area( *solid );
     test_polyhedron_adjacencies( *solid, *builder );
     test_is_on_border( *solid );
+    test_compact_facets_and_edges( *solid );
     test_io( *solid, absl::StrCat( "test.", solid->native_extension() ) );
+    test_modified_compact_facets_io( *solid );
 
     test_permutation( *solid, *builder );
     test_delete_polyhedron( *solid, *builder );
     test_clone( *solid );
     test_delete_all( *solid, *builder );
+#ifdef OPENGEODE_BENCHMARK
+    benchmark_facets();
+#endif
 }
 
 OPENGEODE_TEST( "tetrahedral-solid" )
\ No newline at end of file
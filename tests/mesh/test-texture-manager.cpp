@@ -21,9 +21,11 @@
  *
  */
 
+#include <filesystem>
 #include <fstream>
 
 #include <geode/basic/attribute_manager.hpp>
+#include <geode/basic/filename.hpp>
 #include <geode/basic/logger.hpp>
 
 #include <geode/geometry/bitsery_archive.hpp>
@@ -32,6 +34,7 @@
 #include <geode/image/core/bitsery_archive.hpp>
 #include <geode/image/core/raster_image.hpp>
 #include <geode/image/core/rgb_color.hpp>
+#include <geode/image/core/tiled_raster_image.hpp>
 
 #include <geode/mesh/core/bitsery_archive.hpp>
 #include <geode/mesh/core/texture2d.hpp>
@@ -91,6 +94,8 @@ void save( const geode::TextureStorage2D& storage, std::string_view filename )
     geode::register_geometry_serialize_pcontext( std::get< 0 >( context ) );
     geode::register_image_serialize_pcontext( std::get< 0 >( context ) );
     geode::register_mesh_serialize_pcontext( std::get< 0 >( context ) );
+    std::get< geode::ArchiveDirectory >( context ).directory =
+        geode::filepath_without_filename( filename );
     geode::Serializer archive{ context, file };
     archive.object( storage );
     archive.adapter().flush();
@@ -106,6 +111,8 @@ geode::TextureStorage2D load( std::string_view filename )
     geode::register_geometry_deserialize_pcontext( std::get< 0 >( context ) );
     geode::register_image_deserialize_pcontext( std::get< 0 >( context ) );
     geode::register_mesh_deserialize_pcontext( std::get< 0 >( context ) );
+    std::get< geode::ArchiveDirectory >( context ).directory =
+        geode::filepath_without_filename( filename );
     geode::Deserializer archive{ context, file };
     geode::TextureStorage2D storage;
     archive.object( storage );
@@ -117,6 +124,43 @@ geode::TextureStorage2D load( std::string_view filename )
     return storage;
 }
 
+void test_tiled_texture( geode::AttributeManager& attributes )
+{
+    std::filesystem::remove_all( "tiled" );
+    std::filesystem::remove_all( "tiled_moved" );
+    std::filesystem::create_directory( "tiled" );
+    geode::save_tiled_raster_image(
+        create_raster(), "tiled/texture.og_timg2d", 4 );
+    geode::TextureStorage2D storage;
+    {
+        geode::TextureManager2D manager{ attributes, storage };
+        auto& texture = manager.find_or_create_texture( "tiled" );
+        texture.set_tiled_image( "tiled/texture.og_timg2d" );
+    }
+    save( storage, "tiled/storage" );
+    std::filesystem::rename( "tiled", "tiled_moved" );
+    auto reload = load( "tiled_moved/storage" );
+    const geode::TextureManager2D manager{ attributes, reload };
+    const auto& texture = manager.find_texture( "tiled" );
+    OPENGEODE_EXCEPTION(
+        texture.is_image_tiled(), "[Test] Texture image should be tiled" );
+    const auto& tiled_image = texture.tiled_image();
+    OPENGEODE_EXCEPTION( tiled_image.nb_cached_tiles() == 0,
+        "[Test] No tile should be read when loading the texture" );
+    const geode::RGBColor color{ 23, 23, 23 };
+    OPENGEODE_EXCEPTION( tiled_image.color( 0, { 3, 2 } ) == color,
+        "[Test] Wrong tiled image color" );
+    OPENGEODE_EXCEPTION( tiled_image.nb_cached_tiles() == 1,
+        "[Test] Only one tile should be read" );
+    const auto& image = texture.image();
+    for( const auto i : geode::LRange{ 100 } )
+    {
+        const geode::RGBColor expected{ i, i, i };
+        OPENGEODE_EXCEPTION(
+            image.color( i ) == expected, "[Test] Wrong tiled color image" );
+    }
+}
+
 void test()
 {
     geode::OpenGeodeMeshLibrary::initialize();
@@ -127,6 +171,7 @@ void test()
     save( storage, "storage" );
     auto reload = load( "storage" );
     check_texture( attributes, reload );
+    test_tiled_texture( attributes );
 }
 
 OPENGEODE_TEST( "texture-manager" )
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/basic/assert.hpp>
+#include <geode/basic/attribute_manager.hpp>
+#include <geode/basic/range.hpp>
+
+#include <geode/geometry/point.hpp>
+
+#include <geode/image/core/raster_image.hpp>
+#include <geode/image/core/rgb_color.hpp>
+#include <geode/image/core/tiled_raster_image.hpp>
+
+#include <geode/mesh/core/solid_mesh.hpp>
+#include <geode/mesh/core/surface_mesh.hpp>
+#include <geode/mesh/core/texture2d.hpp>
+#include <geode/mesh/core/texture3d.hpp>
+#include <geode/mesh/helpers/texture_sampler.hpp>
+
+#include <geode/tests/common.hpp>
+
+geode::RasterImage2D create_raster2d()
+{
+    geode::RasterImage2D raster{ { 2, 2 } };
+    raster.set_color( 0, { 0, 0, 0 } );
+    raster.set_color( 1, { 100, 0, 0 } );
+    raster.set_color( 2, { 0, 100, 0 } );
+    raster.set_color( 3, { 100, 100, 200 } );
+    return raster;
+}
+
+void check_color( const geode::RGBColor& color,
+    const geode::RGBColor& expected,
+    std::string_view message )
+{
+    OPENGEODE_EXCEPTION( color == expected, "[Test] ", message, ": got ",
+        color.string(), " instead of ", expected.string() );
+}
+
+void test_sampler2d( geode::TEXTURE_CHANNEL_LAYOUT layout )
+{
+    const auto raster = create_raster2d();
+    const geode::TextureSampler2D sampler{ raster, layout };
+    OPENGEODE_EXCEPTION(
+        sampler.channel_layout() == layout, "[Test] Wrong channel layout" );
+    check_color( sampler.sample( geode::Point2D{ { 0.75, 0.25 } },
+                     geode::TEXTURE_FILTER::nearest ),
+        { 100, 0, 0 }, "Wrong nearest color" );
+    check_color( sampler.sample( geode::Point2D{ { 0.25, 0.75 } },
+                     geode::TEXTURE_FILTER::linear ),
+        { 0, 100, 0 }, "Wrong linear color at cell center" );
+    check_color( sampler.sample( geode::Point2D{ { 0.5, 0.5 } },
+                     geode::TEXTURE_FILTER::linear ),
+        { 50, 50, 50 }, "Wrong bilinear color" );
+    check_color( sampler.sample( geode::Point2D{ { 2., -1. } },
+                     geode::TEXTURE_FILTER::linear ),
+        { 100, 0, 0 }, "Wrong clamped color" );
+
+    std::vector< geode::Point2D > points;
+    for( const auto i : geode::Range{ 1000 } )
+    {
+        points.emplace_back( geode::Point2D{ { i / 1000., 0.5 } } );
+    }
+    const auto colors = sampler.sample( points, geode::TEXTURE_FILTER::linear );
+    for( const auto i : geode::Indices{ points } )
+    {
+        check_color( colors[i],
+            sampler.sample( points[i], geode::TEXTURE_FILTER::linear ),
+            "Wrong batched color" );
+    }
+}
+
+void test_texture2d()
+{
+    geode::AttributeManager attributes;
+    attributes.resize( 1 );
+    geode::Texture2D texture{ attributes, "texture" };
+    texture.set_texture_coordinates(
+        { 0, 0 }, geode::Point2D{ { 0.25, 0.25 } } );
+    texture.set_texture_coordinates(
+        { 0, 1 }, geode::Point2D{ { 0.75, 0.25 } } );
+    texture.set_texture_coordinates(
+        { 0, 2 }, geode::Point2D{ { 0.25, 0.75 } } );
+    texture.set_image( create_raster2d() );
+    const geode::TextureSampler2D sampler{ texture.image() };
+
+    const std::vector< geode::PolygonVertex > vertices{ { 0, 0 }, { 0, 1 },
+        { 0, 2 } };
+    const auto vertex_colors = geode::sample_texture(
+        texture, sampler, vertices, geode::TEXTURE_FILTER::nearest );
+    check_color( vertex_colors[1], { 100, 0, 0 }, "Wrong vertex color" );
+
+    const std::vector< geode::TexturePolygonPosition > positions{
+        { 0, { 0.5, 0.5, 0. } }, { 0, { 0., 0., 1. } }
+    };
+    const auto position_colors = geode::sample_texture(
+        texture, sampler, positions, geode::TEXTURE_FILTER::linear );
+    check_color( position_colors[0], { 50, 0, 0 }, "Wrong interpolated color" );
+    check_color( position_colors[1], { 0, 100, 0 }, "Wrong corner color" );
+}
+
+void test_sampler3d()
+{
+    geode::RasterImage3D raster{ { 2, 2, 2 } };
+    for( const auto i : geode::Range{ raster.nb_cells() } )
+    {
+        raster.set_color( i, { 0, 0, 0 } );
+    }
+    raster.set_color( 7, { 200, 80, 40 } );
+    const geode::TextureSampler3D sampler{ raster,
+        geode::TEXTURE_CHANNEL_LAYOUT::interleaved };
+    check_color( sampler.sample( geode::Point3D{ { 0.5, 0.5, 0.5 } },
+                     geode::TEXTURE_FILTER::linear ),
+        { 25, 10, 5 }, "Wrong trilinear color" );
+    check_color( sampler.sample( geode::Point3D{ { 0.9, 0.9, 0.9 } },
+                     geode::TEXTURE_FILTER::nearest ),
+        { 200, 80, 40 }, "Wrong nearest 3D color" );
+}
+
+void test_tiled_sampler2d()
+{
+    const auto raster = create_raster2d();
+    geode::save_tiled_raster_image( raster, "sampler.og_timg2d", 1 );
+    const geode::TiledRasterImage2D image{ "sampler.og_timg2d" };
+    const geode::TiledTextureSampler2D tiled_sampler{ image };
+    const geode::TextureSampler2D sampler{ raster };
+    std::vector< geode::Point2D > points;
+    for( const auto i : geode::Range{ 100 } )
+    {
+        points.emplace_back( geode::Point2D{ { i / 100., 1. - i / 150. } } );
+    }
+    for( const auto filter :
+        { geode::TEXTURE_FILTER::nearest, geode::TEXTURE_FILTER::linear } )
+    {
+        const auto colors = sampler.sample( points, filter );
+        const auto tiled_colors = tiled_sampler.sample( points, filter );
+        for( const auto i : geode::Indices{ points } )
+        {
+            check_color(
+                tiled_colors[i], colors[i], "Wrong tiled sampler color" );
+        }
+    }
+    const geode::TiledTextureSampler2D coarse_sampler{ image, 1 };
+    check_color( coarse_sampler.sample( geode::Point2D{ { 0.2, 0.7 } },
+                     geode::TEXTURE_FILTER::linear ),
+        { 50, 50, 50 }, "Wrong mip level color" );
+}
+
+void test()
+{
+    geode::OpenGeodeMeshLibrary::initialize();
+    test_sampler2d( geode::TEXTURE_CHANNEL_LAYOUT::planar );
+    test_sampler2d( geode::TEXTURE_CHANNEL_LAYOUT::interleaved );
+    test_texture2d();
+    test_tiled_sampler2d();
+    test_sampler3d();
+}
+
+OPENGEODE_TEST( "texture-sampler" )
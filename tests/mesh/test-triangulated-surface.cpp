@@ -95,6 +95,38 @@ void test_polygon_adjacencies( const geode::TriangulatedSurface3D& surface,
     }
 }
 
+void test_revisions( const geode::TriangulatedSurface3D& surface,
+    geode::TriangulatedSurfaceBuilder3D& builder )
+{
+    const auto initial = surface.revisions();
+    OPENGEODE_EXCEPTION( surface.revisions() == initial,
+        "[Test] Revisions should not change without modification" );
+
+    builder.set_point( 0, surface.point( 0 ) );
+    const auto moved = surface.revisions();
+    OPENGEODE_EXCEPTION( moved.geometry > initial.geometry,
+        "[Test] Geometry revision should be updated by set_point" );
+    OPENGEODE_EXCEPTION( moved.connectivity == initial.connectivity
+                             && moved.attribute == initial.attribute,
+        "[Test] Only geometry revision should be updated by set_point" );
+
+    builder.set_polygon_adjacent( { 2, 2 }, 1 );
+    const auto connected = surface.revisions();
+    OPENGEODE_EXCEPTION( connected.connectivity > moved.connectivity,
+        "[Test] Connectivity revision should be updated by "
+        "set_polygon_adjacent" );
+    OPENGEODE_EXCEPTION( connected.geometry == moved.geometry,
+        "[Test] Geometry revision should not be updated by "
+        "set_polygon_adjacent" );
+
+    builder.update_attribute_revision();
+    const auto attribute = surface.revisions();
+    OPENGEODE_EXCEPTION( attribute.attribute > connected.attribute,
+        "[Test] Attribute revision should be updated" );
+    OPENGEODE_EXCEPTION( attribute.attribute > attribute.connectivity,
+        "[Test] Revisions should be taken from a global counter" );
+}
+
 void test_permutation( const geode::TriangulatedSurface3D& surface,
     geode::TriangulatedSurfaceBuilder3D& builder )
 {
@@ -278,6 +310,7 @@ void test()
     test_create_vertices( *surface, *builder );
     test_create_polygons( *surface, *builder );
     test_polygon_adjacencies( *surface, *builder );
+    test_revisions( *surface, *builder );
     test_io( *surface, absl::StrCat( "test.", surface->native_extension() ) );
 
     test_permutation( *surface, *builder );
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/basic/assert.hpp>
+#include <geode/basic/range.hpp>
+
+#include <geode/mesh/builder/surface_mesh_builder.hpp>
+#include <geode/mesh/core/edged_curve.hpp>
+#include <geode/mesh/core/solid_mesh.hpp>
+#include <geode/mesh/core/surface_mesh.hpp>
+
+#include <geode/model/helpers/brep_incidence_index.hpp>
+#include <geode/model/helpers/component_mesh_polygons.hpp>
+#include <geode/model/mixin/core/block.hpp>
+#include <geode/model/mixin/core/line.hpp>
+#include <geode/model/mixin/core/surface.hpp>
+#include <geode/model/representation/builder/brep_builder.hpp>
+#include <geode/model/representation/core/brep.hpp>
+#include <geode/model/representation/io/brep_input.hpp>
+
+#include <geode/tests/common.hpp>
+
+void test_block_facets(
+    const geode::BRep& model, const geode::BRepIncidenceIndex& index )
+{
+    for( const auto& block : model.blocks() )
+    {
+        for( const auto& surface : model.boundaries( block ) )
+        {
+            for( const auto polygon_id :
+                geode::Range{ surface.mesh().nb_polygons() } )
+            {
+                const auto expected =
+                    geode::block_vertices_from_surface_polygon(
+                        model, block, surface, polygon_id );
+                const auto& result = index.block_vertices_from_surface_polygon(
+                    block, surface, polygon_id );
+                OPENGEODE_EXCEPTION( result.size() == expected.size(),
+                    "[Test] Wrong number of block facets" );
+                for( const auto f : geode::Indices{ result } )
+                {
+                    OPENGEODE_EXCEPTION(
+                        result[f].facet == expected[f].facet
+                            && result[f].vertices == expected[f].vertices,
+                        "[Test] Wrong block facet" );
+                }
+                OPENGEODE_EXCEPTION(
+                    index.block_mesh_polyhedra_from_surface_polygon(
+                        block, surface, polygon_id )
+                        == geode::block_mesh_polyhedra_from_surface_polygon(
+                            model, block, surface, polygon_id ),
+                    "[Test] Wrong block polyhedra" );
+            }
+        }
+    }
+}
+
+void test_surface_edges(
+    const geode::BRep& model, const geode::BRepIncidenceIndex& index )
+{
+    for( const auto& surface : model.surfaces() )
+    {
+        for( const auto& line : model.boundaries( surface ) )
+        {
+            for( const auto edge_id : geode::Range{ line.mesh().nb_edges() } )
+            {
+                const auto expected = geode::surface_vertices_from_line_edge(
+                    model, surface, line, edge_id );
+                const auto& result = index.surface_vertices_from_line_edge(
+                    surface, line, edge_id );
+                OPENGEODE_EXCEPTION( result.size() == expected.size(),
+                    "[Test] Wrong number of surface edges" );
+                for( const auto e : geode::Indices{ result } )
+                {
+                    OPENGEODE_EXCEPTION(
+                        result[e].edge == expected[e].edge
+                            && result[e].vertices == expected[e].vertices,
+                        "[Test] Wrong surface edge" );
+                }
+            }
+        }
+    }
+}
+
+void test_outdated_index(
+    geode::BRep& model, const geode::BRepIncidenceIndex& index )
+{
+    geode::BRepBuilder builder{ model };
+    const auto& surface = *model.surfaces().begin();
+    builder.surface_mesh_builder( surface.id() )
+        ->update_connectivity_revision();
+    OPENGEODE_EXCEPTION( !index.is_up_to_date(),
+        "[Test] Index should be outdated after a mesh modification" );
+}
+
+void test()
+{
+    geode::OpenGeodeModelLibrary::initialize();
+    auto model = geode::load_brep(
+        absl::StrCat( geode::DATA_PATH, "test_mesh3.og_brep" ) );
+    const geode::BRepIncidenceIndex index{ model };
+    OPENGEODE_EXCEPTION(
+        index.is_up_to_date(), "[Test] Index should be up to date" );
+    test_block_facets( model, index );
+    test_surface_edges( model, index );
+    test_outdated_index( model, index );
+}
+
+OPENGEODE_TEST( "brep-incidence-index" )
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/basic/assert.hpp>
+
+#include <geode/model/helpers/detail/build_model_boundaries.hpp>
+#include <geode/model/mixin/core/block.hpp>
+#include <geode/model/mixin/core/line.hpp>
+#include <geode/model/mixin/core/surface.hpp>
+#include <geode/model/representation/builder/brep_builder.hpp>
+#include <geode/model/representation/builder/section_builder.hpp>
+#include <geode/model/representation/core/brep.hpp>
+#include <geode/model/representation/core/section.hpp>
+
+#include <geode/tests/common.hpp>
+
+template < typename Model >
+void check_model_boundaries( const Model& model,
+    geode::index_t nb_boundaries,
+    absl::Span< const geode::uuid > components,
+    absl::Span< const geode::index_t > nb_collections )
+{
+    OPENGEODE_EXCEPTION( model.nb_model_boundaries() == nb_boundaries,
+        "[Test] Model has ", model.nb_model_boundaries(),
+        " ModelBoundaries, should have ", nb_boundaries );
+    for( const auto c : geode::Indices{ components } )
+    {
+        OPENGEODE_EXCEPTION(
+            model.nb_collections( components[c] ) == nb_collections[c],
+            "[Test] Component ", c, " is in ",
+            model.nb_collections( components[c] ),
+            " ModelBoundaries, should be in ", nb_collections[c] );
+    }
+}
+
+void test_brep_model_boundaries()
+{
+    geode::BRep brep;
+    geode::BRepBuilder builder{ brep };
+    const auto& block = brep.block( builder.add_block() );
+    std::array< geode::uuid, 3 > surfaces;
+    for( const auto s : geode::LRange{ 3 } )
+    {
+        surfaces[s] = builder.add_surface();
+        builder.set_surface_name( surfaces[s], absl::StrCat( "surface", s ) );
+    }
+    builder.add_surface_block_boundary_relationship(
+        brep.surface( surfaces[0] ), block );
+    builder.add_surface_block_boundary_relationship(
+        brep.surface( surfaces[1] ), block );
+
+    const std::array< geode::uuid, 2 > first{ surfaces[0], surfaces[2] };
+    geode::detail::build_model_boundaries( brep, builder, first );
+    check_model_boundaries( brep, 1, surfaces, { 1, 0, 0 } );
+
+    const std::array< geode::uuid, 2 > second{ surfaces[0], surfaces[1] };
+    geode::detail::build_model_boundaries( brep, builder, second );
+    check_model_boundaries( brep, 2, surfaces, { 1, 1, 0 } );
+
+    geode::detail::build_model_boundaries( brep, builder );
+    check_model_boundaries( brep, 2, surfaces, { 1, 1, 0 } );
+}
+
+void test_section_model_boundaries()
+{
+    geode::Section section;
+    geode::SectionBuilder builder{ section };
+    const auto& surface = section.surface( builder.add_surface() );
+    std::array< geode::uuid, 3 > lines;
+    for( const auto l : geode::LRange{ 3 } )
+    {
+        lines[l] = builder.add_line();
+        builder.set_line_name( lines[l], absl::StrCat( "line", l ) );
+    }
+    builder.add_line_surface_boundary_relationship(
+        section.line( lines[0] ), surface );
+    builder.add_line_surface_boundary_relationship(
+        section.line( lines[1] ), surface );
+
+    const std::array< geode::uuid, 2 > first{ lines[0], lines[2] };
+    geode::detail::build_model_boundaries( section, builder, first );
+    check_model_boundaries( section, 1, lines, { 1, 0, 0 } );
+
+    const std::array< geode::uuid, 2 > second{ lines[0], lines[1] };
+    geode::detail::build_model_boundaries( section, builder, second );
+    check_model_boundaries( section, 2, lines, { 1, 1, 0 } );
+
+    geode::detail::build_model_boundaries( section, builder );
+    check_model_boundaries( section, 2, lines, { 1, 1, 0 } );
+}
+
+void test()
+{
+    geode::OpenGeodeModelLibrary::initialize();
+    test_brep_model_boundaries();
+    test_section_model_boundaries();
+}
+
+OPENGEODE_TEST( "build-model-boundaries" )
@@ -26,11 +26,14 @@
 #include <geode/basic/range.hpp>
 #include <geode/basic/uuid.hpp>
 
+#include <geode/geometry/point.hpp>
+
 #include <geode/mesh/core/edged_curve.hpp>
 #include <geode/mesh/core/solid_mesh.hpp>
 #include <geode/mesh/core/surface_mesh.hpp>
 
 #include <geode/model/helpers/convert_to_mesh.hpp>
+#include <geode/model/mixin/core/block.hpp>
 #include <geode/model/representation/core/brep.hpp>
 #include <geode/model/representation/core/section.hpp>
 #include <geode/model/representation/io/brep_input.hpp>
@@ -38,6 +41,43 @@
 
 #include <geode/tests/common.hpp>
 
+void check_solid_mappings( const geode::BRep& model,
+    const geode::SolidMesh3D& solid,
+    const geode::ModelToMeshMappings& mappings )
+{
+    for( const auto& block : model.blocks() )
+    {
+        const auto& block_mesh = block.mesh();
+        for( const auto polyhedron : geode::Range{ block_mesh.nb_polyhedra() } )
+        {
+            const auto& solid_polyhedra =
+                mappings.solid_polyhedra_mapping.in2out(
+                    { block.id(), polyhedron } );
+            OPENGEODE_EXCEPTION( solid_polyhedra.size() == 1,
+                "[Test] BRep - Wrong number of mapped polyhedra" );
+            const auto solid_polyhedron = solid_polyhedra.front();
+            for( const auto v : geode::LRange{
+                     block_mesh.nb_polyhedron_vertices( polyhedron ) } )
+            {
+                const auto block_vertex =
+                    block_mesh.polyhedron_vertex( { polyhedron, v } );
+                const auto solid_vertex =
+                    solid.polyhedron_vertex( { solid_polyhedron, v } );
+                OPENGEODE_EXCEPTION(
+                    mappings.unique_vertices_mapping.in2out(
+                        model.unique_vertex(
+                            { block.component_id(), block_vertex } ) )
+                        == solid_vertex,
+                    "[Test] BRep - Wrong mapped solid vertex" );
+                OPENGEODE_EXCEPTION( solid.point( solid_vertex )
+                                         .inexact_equal(
+                                             block_mesh.point( block_vertex ) ),
+                    "[Test] BRep - Wrong solid vertex coordinates" );
+            }
+        }
+    }
+}
+
 void run_test_brep()
 {
     auto model = geode::load_brep(
@@ -53,11 +93,12 @@ void run_test_brep()
         "[Test] BRep - Wrong number of surface vertices" );
     OPENGEODE_EXCEPTION( surface->nb_polygons() == 1716,
         "[Test] BRep - Wrong number of surface polygons" );
-    const auto solid = std::get< 0 >( geode::convert_brep_into_solid( model ) );
+    const auto [solid, mappings] = geode::convert_brep_into_solid( model );
     OPENGEODE_EXCEPTION( solid->nb_vertices() == 1317,
         "[Test] BRep - Wrong number of solid vertices" );
     OPENGEODE_EXCEPTION( solid->nb_polyhedra() == 5709,
         "[Test] BRep - Wrong number of solid polyhedra" );
+    check_solid_mappings( model, *solid, mappings );
 }
 
 void run_test_section()
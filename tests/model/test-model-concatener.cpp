@@ -21,10 +21,17 @@
  *
  */
 
+#include <array>
+#include <functional>
+
 #include <geode/basic/assert.hpp>
 #include <geode/basic/logger.hpp>
+#include <geode/basic/range.hpp>
+
+#include <geode/mesh/core/solid_mesh.hpp>
 
 #include <geode/model/helpers/model_concatener.hpp>
+#include <geode/model/mixin/core/block.hpp>
 #include <geode/model/representation/core/brep.hpp>
 #include <geode/model/representation/io/brep_input.hpp>
 #include <geode/model/representation/io/brep_output.hpp>
@@ -52,6 +59,62 @@ void check_concatenation(
         " ModelBoundaries" );
 }
 
+void test_multiple_concatenation()
+{
+    auto brep = geode::load_brep(
+        absl::StrCat( geode::DATA_PATH, "prism_curve.og_brep" ) );
+    const auto brep2 = geode::load_brep(
+        absl::StrCat( geode::DATA_PATH, "dangling.og_brep" ) );
+    const auto brep3 = geode::load_brep(
+        absl::StrCat( geode::DATA_PATH, "prism_curve.og_brep" ) );
+    std::array< geode::index_t, 5 > nb_components{ brep.nb_corners()
+                                                       + brep2.nb_corners()
+                                                       + brep3.nb_corners(),
+        brep.nb_lines() + brep2.nb_lines() + brep3.nb_lines(),
+        brep.nb_surfaces() + brep2.nb_surfaces() + brep3.nb_surfaces(),
+        brep.nb_blocks() + brep2.nb_blocks() + brep3.nb_blocks(),
+        brep.nb_model_boundaries() + brep2.nb_model_boundaries()
+            + brep3.nb_model_boundaries() };
+    const auto nb_unique_vertices = brep.nb_unique_vertices()
+                                    + brep2.nb_unique_vertices()
+                                    + brep3.nb_unique_vertices();
+    geode::BRepConcatener concatener{ brep };
+    const std::array< std::reference_wrapper< const geode::BRep >, 2 > others{
+        { std::cref( brep2 ), std::cref( brep3 ) }
+    };
+    const auto mappings = concatener.concatenate( others );
+    OPENGEODE_EXCEPTION( mappings.size() == 2,
+        "[Test] Concatenation should return one mapping per model" );
+    check_concatenation( brep, nb_components );
+    OPENGEODE_EXCEPTION( brep.nb_unique_vertices() == nb_unique_vertices,
+        "[Test] Concatenated model has ", brep.nb_unique_vertices(),
+        " unique vertices, should have ", nb_unique_vertices );
+    const auto& block_mapping =
+        mappings[1].at( geode::Block3D::component_type_static() );
+    for( const auto& block : brep3.blocks() )
+    {
+        const auto& block_copy =
+            brep.block( block_mapping.in2out( block.id() ) );
+        OPENGEODE_EXCEPTION( brep.nb_boundaries( block_copy.id() )
+                                 == brep3.nb_boundaries( block.id() ),
+            "[Test] Wrong number of copied Block boundaries" );
+        for( const auto v : geode::Range{ block.mesh().nb_vertices() } )
+        {
+            const auto unique_vertex =
+                brep.unique_vertex( { block_copy.component_id(), v } );
+            OPENGEODE_EXCEPTION( unique_vertex != geode::NO_ID,
+                "[Test] Copied Block vertex has no unique vertex" );
+            OPENGEODE_EXCEPTION(
+                brep.component_mesh_vertices( unique_vertex ).size()
+                    == brep3
+                           .component_mesh_vertices( brep3.unique_vertex(
+                               { block.component_id(), v } ) )
+                           .size(),
+                "[Test] Wrong unique vertex copy" );
+        }
+    }
+}
+
 void test()
 {
     geode::OpenGeodeModelLibrary::initialize();
@@ -69,6 +132,7 @@ void test()
     concatener.concatenate( brep2 );
     check_concatenation( brep, nb_components );
     geode::save_brep( brep, "concatenated_brep.og_brep" );
+    test_multiple_concatenation();
 }
 
 OPENGEODE_TEST( "model-concatener" )
\ No newline at end of file
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/basic/assert.hpp>
+#include <geode/basic/attribute_manager.hpp>
+#include <geode/basic/logger.hpp>
+
+#include <geode/mesh/core/solid_mesh.hpp>
+#include <geode/mesh/core/surface_mesh.hpp>
+
+#include <geode/model/helpers/model_quality.hpp>
+#include <geode/model/mixin/core/block.hpp>
+#include <geode/model/mixin/core/surface.hpp>
+#include <geode/model/representation/core/brep.hpp>
+#include <geode/model/representation/io/brep_input.hpp>
+
+#include <geode/tests/common.hpp>
+
+void test_blocks_quality( const geode::BRep& brep )
+{
+    geode::index_t nb_polyhedra{ 0 };
+    for( const auto& block : brep.blocks() )
+    {
+        nb_polyhedra += block.mesh().nb_polyhedra();
+    }
+    geode::QualityReportParameters parameters;
+    parameters.attribute_name = "quality";
+    const auto report = geode::blocks_quality_report(
+        brep, geode::QUALITY_METRIC::size, parameters );
+    geode::Logger::info( report.string() );
+    OPENGEODE_EXCEPTION( report.nb_elements == nb_polyhedra,
+        "[Test] Wrong number of evaluated polyhedra" );
+    OPENGEODE_EXCEPTION( report.min <= report.mean && report.mean <= report.max,
+        "[Test] Wrong quality statistics" );
+    for( const auto& [element, value] : report.worst_elements )
+    {
+        const auto& block = brep.block( element.component_id.id() );
+        OPENGEODE_EXCEPTION(
+            element.element_id < block.mesh().nb_polyhedra(),
+            "[Test] Wrong worst element" );
+        const auto attribute = block.mesh()
+                                   .polyhedron_attribute_manager()
+                                   .find_attribute< double >( "quality" );
+        OPENGEODE_EXCEPTION( attribute->value( element.element_id ) == value,
+            "[Test] Wrong stored quality" );
+        OPENGEODE_EXCEPTION( value == report.min,
+            "[Test] Worst elements should start with the minimum" );
+        break;
+    }
+}
+
+void test_surfaces_quality( const geode::BRep& brep )
+{
+    geode::index_t nb_polygons{ 0 };
+    for( const auto& surface : brep.surfaces() )
+    {
+        nb_polygons += surface.mesh().nb_polygons();
+    }
+    const auto report = geode::surfaces_quality_report(
+        brep, geode::QUALITY_METRIC::size );
+    geode::Logger::info( report.string() );
+    OPENGEODE_EXCEPTION( report.nb_elements == nb_polygons,
+        "[Test] Wrong number of evaluated polygons" );
+    OPENGEODE_EXCEPTION( report.min > 0, "[Test] Wrong minimum area" );
+}
+
+void test()
+{
+    geode::OpenGeodeModelLibrary::initialize();
+    const auto brep = geode::load_brep(
+        absl::StrCat( geode::DATA_PATH, "prism_curve.og_brep" ) );
+    test_blocks_quality( brep );
+    test_surfaces_quality( brep );
+}
+
+OPENGEODE_TEST( "model-quality" )
@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <absl/algorithm/container.h>
+
+#include <geode/basic/assert.hpp>
+#include <geode/basic/logger.hpp>
+#include <geode/basic/range.hpp>
+
+#include <geode/mesh/builder/surface_mesh_builder.hpp>
+#include <geode/mesh/core/solid_mesh.hpp>
+#include <geode/mesh/core/surface_mesh.hpp>
+
+#include <geode/model/helpers/component_mesh_polygons.hpp>
+#include <geode/model/helpers/model_validity.hpp>
+#include <geode/model/mixin/core/block.hpp>
+#include <geode/model/mixin/core/corner.hpp>
+#include <geode/model/mixin/core/surface.hpp>
+#include <geode/model/representation/builder/brep_builder.hpp>
+#include <geode/model/representation/core/brep.hpp>
+#include <geode/model/representation/core/section.hpp>
+#include <geode/model/representation/io/brep_input.hpp>
+#include <geode/model/representation/io/section_input.hpp>
+
+#include <geode/tests/common.hpp>
+
+geode::index_t serial_non_conformal_surface_polygons( const geode::BRep& brep )
+{
+    geode::index_t nb_issues{ 0 };
+    for( const auto& block : brep.blocks() )
+    {
+        for( const auto& surface : brep.boundaries( block ) )
+        {
+            for( const auto p : geode::Range{ surface.mesh().nb_polygons() } )
+            {
+                if( geode::block_vertices_from_surface_polygon(
+                        brep, block, surface, p )
+                        .size()
+                    != 1 )
+                {
+                    nb_issues++;
+                }
+            }
+        }
+        for( const auto& surface : brep.internal_surfaces( block ) )
+        {
+            for( const auto p : geode::Range{ surface.mesh().nb_polygons() } )
+            {
+                if( geode::block_vertices_from_surface_polygon(
+                        brep, block, surface, p )
+                        .size()
+                    != 2 )
+                {
+                    nb_issues++;
+                }
+            }
+        }
+    }
+    return nb_issues;
+}
+
+void check_consistency( const geode::ModelValidityReport& report )
+{
+    OPENGEODE_EXCEPTION( report.inconsistent_component_vertices.empty()
+                             && report.inconsistent_unique_vertices.empty(),
+        "[Test] Unique vertices should be consistent" );
+    OPENGEODE_EXCEPTION( report.invalid_relations.empty(),
+        "[Test] Relations should be valid" );
+    OPENGEODE_EXCEPTION( report.non_reciprocal_adjacencies.empty(),
+        "[Test] Mesh adjacencies should be reciprocal" );
+}
+
+void test_brep()
+{
+    const auto brep = geode::load_brep(
+        absl::StrCat( geode::DATA_PATH, "structural_model.og_brep" ) );
+    const auto report = geode::brep_validity_report( brep );
+    geode::Logger::info( report.string() );
+    check_consistency( report );
+
+    const auto nb_serial_issues = serial_non_conformal_surface_polygons( brep );
+    OPENGEODE_EXCEPTION(
+        report.non_conformal_surface_polygons.size() == nb_serial_issues,
+        "[Test] Wrong number of non conformal surface polygons" );
+}
+
+geode::BRep load_test_brep()
+{
+    return geode::load_brep(
+        absl::StrCat( geode::DATA_PATH, "test_mesh3.og_brep" ) );
+}
+
+void test_broken_unique_vertex()
+{
+    auto brep = load_test_brep();
+    geode::BRepBuilder builder{ brep };
+    const auto& surface = *brep.surfaces().begin();
+    const geode::ComponentMeshVertex cmv{ surface.component_id(), 0 };
+    const auto unique_vertex = brep.unique_vertex( cmv );
+    const auto other_unique_vertex =
+        ( unique_vertex + 1 ) % brep.nb_unique_vertices();
+    // The vertex loses its unique vertex but is still listed by it
+    builder.unset_unique_vertex( cmv, other_unique_vertex );
+    const auto report = geode::brep_validity_report( brep );
+    OPENGEODE_EXCEPTION( !report.is_valid(),
+        "[Test] Model with broken unique vertex should be invalid" );
+    OPENGEODE_EXCEPTION(
+        absl::c_find( report.inconsistent_component_vertices, cmv )
+            != report.inconsistent_component_vertices.end(),
+        "[Test] Component vertex without unique vertex not found" );
+    OPENGEODE_EXCEPTION(
+        absl::c_find( report.inconsistent_unique_vertices, unique_vertex )
+            != report.inconsistent_unique_vertices.end(),
+        "[Test] Unique vertex listing an unlinked vertex not found" );
+}
+
+void test_invalid_relation()
+{
+    auto brep = load_test_brep();
+    geode::BRepBuilder builder{ brep };
+    const auto& block = *brep.blocks().begin();
+    const auto& corner = *brep.corners().begin();
+    // A Block cannot be a boundary of a Corner
+    builder.add_boundary_relation(
+        block.component_id(), corner.component_id() );
+    const auto report = geode::brep_validity_report( brep );
+    OPENGEODE_EXCEPTION( !report.is_valid(),
+        "[Test] Model with invalid relation should be invalid" );
+    OPENGEODE_EXCEPTION(
+        absl::c_find( report.invalid_relations,
+            std::make_pair( block.component_id(), corner.component_id() ) )
+            != report.invalid_relations.end(),
+        "[Test] Invalid relation not found" );
+}
+
+std::optional< geode::PolygonEdge > first_adjacent_edge(
+    const geode::SurfaceMesh3D& mesh )
+{
+    for( const auto p : geode::Range{ mesh.nb_polygons() } )
+    {
+        const geode::PolygonEdge edge{ p, 0 };
+        if( mesh.polygon_adjacent_edge( edge ) )
+        {
+            return edge;
+        }
+    }
+    return std::nullopt;
+}
+
+void test_non_reciprocal_adjacency()
+{
+    auto brep = load_test_brep();
+    geode::BRepBuilder builder{ brep };
+    const auto& surface = *brep.surfaces().begin();
+    const auto& mesh = surface.mesh();
+    const auto edge = first_adjacent_edge( mesh );
+    OPENGEODE_EXCEPTION( edge, "[Test] Surface should have adjacencies" );
+    const auto adjacent = mesh.polygon_adjacent( edge.value() ).value();
+    // Only one side of the adjacency is removed
+    builder.surface_mesh_builder( surface.id() )
+        ->unset_polygon_adjacent( edge.value() );
+    const auto report = geode::brep_validity_report( brep );
+    OPENGEODE_EXCEPTION( !report.is_valid(),
+        "[Test] Model with non reciprocal adjacency should be invalid" );
+    OPENGEODE_EXCEPTION(
+        absl::c_find( report.non_reciprocal_adjacencies,
+            geode::ComponentMeshElement{ surface.component_id(), adjacent } )
+            != report.non_reciprocal_adjacencies.end(),
+        "[Test] Non reciprocal adjacency not found" );
+}
+
+void test_non_manifold_vertex()
+{
+    auto brep = load_test_brep();
+    geode::BRepBuilder builder{ brep };
+    const auto& surface = *brep.surfaces().begin();
+    const auto& mesh = surface.mesh();
+    const auto edge = first_adjacent_edge( mesh );
+    OPENGEODE_EXCEPTION( edge, "[Test] Surface should have adjacencies" );
+    const auto vertex = mesh.polygon_vertex( geode::PolygonVertex{ *edge } );
+    // Disconnect the polygon from its neighbors around the vertex
+    auto mesh_builder = builder.surface_mesh_builder( surface.id() );
+    for( const auto& polygon_edge :
+        { edge.value(), mesh.previous_polygon_edge( edge.value() ) } )
+    {
+        if( const auto adjacent = mesh.polygon_adjacent_edge( polygon_edge ) )
+        {
+            mesh_builder->unset_polygon_adjacent( adjacent.value() );
+            mesh_builder->unset_polygon_adjacent( polygon_edge );
+        }
+    }
+    const auto report = geode::brep_validity_report( brep );
+    OPENGEODE_EXCEPTION( report.non_reciprocal_adjacencies.empty(),
+        "[Test] Adjacencies should still be reciprocal" );
+    OPENGEODE_EXCEPTION(
+        absl::c_find( report.non_manifold_vertices,
+            geode::ComponentMeshVertex{ surface.component_id(), vertex } )
+            != report.non_manifold_vertices.end(),
+        "[Test] Non manifold vertex not found" );
+}
+
+void test_non_conformal_surface_polygon()
+{
+    auto brep = load_test_brep();
+    geode::BRepBuilder builder{ brep };
+    const auto& block = *brep.blocks().begin();
+    const auto& surface = *brep.boundaries( block ).begin();
+    // Move one polygon vertex to a new unique vertex, unknown to the Block
+    const auto vertex = surface.mesh().polygon_vertex( { 0, 0 } );
+    builder.set_unique_vertex( { surface.component_id(), vertex },
+        builder.create_unique_vertex() );
+    const auto report = geode::brep_validity_report( brep );
+    OPENGEODE_EXCEPTION( report.inconsistent_component_vertices.empty()
+                             && report.inconsistent_unique_vertices.empty(),
+        "[Test] Unique vertices should be consistent" );
+    const geode::ModelValidityReport& model_report = report;
+    OPENGEODE_EXCEPTION( !model_report.is_valid(),
+        "[Test] Model with non conformal surface should be invalid" );
+    OPENGEODE_EXCEPTION(
+        absl::c_find( report.non_conformal_surface_polygons,
+            std::make_pair(
+                geode::ComponentMeshElement{ surface.component_id(), 0 },
+                block.component_id() ) )
+            != report.non_conformal_surface_polygons.end(),
+        "[Test] Non conformal surface polygon not found" );
+}
+
+void test_section()
+{
+    const auto section = geode::load_section(
+        absl::StrCat( geode::DATA_PATH, "quad.og_sctn" ) );
+    const auto report = geode::section_validity_report( section );
+    geode::Logger::info( report.string() );
+    check_consistency( report );
+}
+
+void test()
+{
+    geode::OpenGeodeModelLibrary::initialize();
+    test_brep();
+    test_broken_unique_vertex();
+    test_invalid_relation();
+    test_non_reciprocal_adjacency();
+    test_non_manifold_vertex();
+    test_non_conformal_surface_polygon();
+    test_section();
+}
+
+OPENGEODE_TEST( "model-validity" )
@@ -34,14 +34,70 @@
 #include <geode/model/mixin/core/surface.hpp>
 #include <geode/model/representation/builder/brep_builder.hpp>
 #include <geode/model/representation/core/brep.hpp>
+#include <geode/model/representation/io/brep_input.hpp>
 
 #include <geode/model/helpers/surface_radial_sort.hpp>
 
 #include <geode/tests/common.hpp>
 
-void test()
+void check_sorts(
+    const geode::BRep& brep, const geode::BRepSurfaceRadialSorts& sorts )
+{
+    OPENGEODE_EXCEPTION(
+        sorts.is_up_to_date(), "[Test] Table should be up to date" );
+    OPENGEODE_EXCEPTION( sorts.nb_lines() == brep.nb_lines(),
+        "[Test] Wrong number of lines in table" );
+    for( const auto& line : brep.lines() )
+    {
+        const auto expected = geode::surface_radial_sort( brep, line );
+        const auto result = sorts.sorted_surfaces( line.id() );
+        OPENGEODE_EXCEPTION( result.size() == expected.surfaces.size(),
+            "[Test] Wrong number of updated sorted surfaces around a line" );
+        for( const auto s : geode::Indices{ result } )
+        {
+            OPENGEODE_EXCEPTION( result[s] == expected.surfaces[s],
+                "[Test] Wrong updated sorted surface around a line" );
+        }
+    }
+}
+
+geode::uuid add_segment_line( const geode::BRep& brep,
+    geode::BRepBuilder& builder,
+    absl::Span< const geode::Point3D > points,
+    const std::array< geode::index_t, 2 >& vertices )
+{
+    const auto line_id = builder.add_line();
+    const auto& line = brep.line( line_id );
+    auto line_builder = builder.line_mesh_builder( line_id );
+    for( const auto v : geode::LRange{ 2 } )
+    {
+        line_builder->create_point( points[vertices[v]] );
+        builder.set_unique_vertex( { line.component_id(), v }, vertices[v] );
+    }
+    line_builder->create_edge( 0, 1 );
+    return line_id;
+}
+
+geode::uuid add_triangle_surface( const geode::BRep& brep,
+    geode::BRepBuilder& builder,
+    absl::Span< const geode::Point3D > points,
+    const std::array< geode::index_t, 3 >& vertices )
+{
+    const auto surface_id = builder.add_surface();
+    const auto& surface = brep.surface( surface_id );
+    auto surface_builder = builder.surface_mesh_builder( surface_id );
+    for( const auto v : geode::LRange{ 3 } )
+    {
+        surface_builder->create_point( points[vertices[v]] );
+        builder.set_unique_vertex(
+            { surface.component_id(), v }, vertices[v] );
+    }
+    surface_builder->create_polygon( { 0, 1, 2 } );
+    return surface_id;
+}
+
+void test_line_radial_sort()
 {
-    geode::OpenGeodeModelLibrary::initialize();
     std::vector< geode::Point3D > points{ geode::Point3D{ { 0, 0, 0 } },
         geode::Point3D{ { 0, 1, 0 } }, geode::Point3D{ { 0, 0, 1 } },
         geode::Point3D{ { -1, 0, -1 } }, geode::Point3D{ { 1, 0, -1 } } };
@@ -139,6 +195,129 @@ void test()
         sorted.surfaces[test2].side == geode::SidedSurface::POSITIVE,
         "[Test] Wrong side" );
 
+    const geode::BRepSurfaceRadialSorts sorts{ brep };
+    OPENGEODE_EXCEPTION(
+        sorts.nb_lines() == 1, "[Test] Wrong number of lines" );
+    const auto table_sorted = sorts.sorted_surfaces( line_id );
+    OPENGEODE_EXCEPTION( table_sorted.size() == sorted.surfaces.size(),
+        "[Test] Wrong number of sorted surfaces in table" );
+    for( const auto s : geode::Indices{ table_sorted } )
+    {
+        OPENGEODE_EXCEPTION( table_sorted[s] == sorted.surfaces[s],
+            "[Test] Wrong surface in table" );
+    }
+}
+
+void test_model_radial_sorts()
+{
+    const auto model = geode::load_brep(
+        absl::StrCat( geode::DATA_PATH, "structural_model.og_brep" ) );
+    const geode::BRepSurfaceRadialSorts sorts{ model };
+    OPENGEODE_EXCEPTION( sorts.is_up_to_date(), "[Test] Table not up to date" );
+    OPENGEODE_EXCEPTION( sorts.nb_lines() == model.nb_lines(),
+        "[Test] Wrong number of lines in table" );
+    for( const auto& line : model.lines() )
+    {
+        const auto expected = geode::surface_radial_sort( model, line );
+        const auto result = sorts.surface_radial_sort( line );
+        OPENGEODE_EXCEPTION(
+            result.surfaces.size() == expected.surfaces.size(),
+            "[Test] Wrong number of sorted surfaces around a line" );
+        for( const auto s : geode::Indices{ result.surfaces } )
+        {
+            OPENGEODE_EXCEPTION(
+                result.surfaces[s] == expected.surfaces[s]
+                    && result.surfaces[s].edge == expected.surfaces[s].edge,
+                "[Test] Wrong sorted surface around a line" );
+        }
+    }
+}
+
+void test_update_radial_sorts()
+{
+    auto model = geode::load_brep(
+        absl::StrCat( geode::DATA_PATH, "structural_model.og_brep" ) );
+    geode::BRepSurfaceRadialSorts sorts{ model };
+    const auto& removed_surface = *model.surfaces().begin();
+    const std::vector< geode::uuid > removed_ids{ removed_surface.id() };
+    geode::BRepBuilder builder{ model };
+    builder.remove_surface( removed_surface );
+    OPENGEODE_EXCEPTION(
+        !sorts.is_up_to_date(), "[Test] Table should not be up to date" );
+    sorts.update( removed_ids, {} );
+    check_sorts( model, sorts );
+}
+
+void test_update_radial_sorts_lines()
+{
+    const std::array< geode::Point3D, 5 > points{ geode::Point3D{ { 0, 0, 0 } },
+        geode::Point3D{ { 0, 1, 0 } }, geode::Point3D{ { 0, 0, 1 } },
+        geode::Point3D{ { -1, 0, -1 } }, geode::Point3D{ { 1, 0, -1 } } };
+    geode::BRep brep;
+    geode::BRepBuilder builder{ brep };
+    builder.create_unique_vertices( points.size() );
+    add_triangle_surface( brep, builder, points, { 0, 1, 2 } );
+    add_triangle_surface( brep, builder, points, { 0, 1, 3 } );
+    add_triangle_surface( brep, builder, points, { 1, 0, 4 } );
+    const auto line_id = add_segment_line( brep, builder, points, { 0, 2 } );
+    geode::BRepSurfaceRadialSorts sorts{ brep };
+    check_sorts( brep, sorts );
+
+    // Re-attach the Line on the edge shared by the three unmodified Surfaces
+    const auto& line = brep.line( line_id );
+    builder.line_mesh_builder( line_id )->set_point( 1, points[1] );
+    builder.set_unique_vertex( { line.component_id(), 1 }, 1 );
+    OPENGEODE_EXCEPTION(
+        !sorts.is_up_to_date(), "[Test] Table should not be up to date" );
+    const std::vector< geode::uuid > line_ids{ line_id };
+    sorts.update( {}, line_ids );
+    check_sorts( brep, sorts );
+    OPENGEODE_EXCEPTION( sorts.sorted_surfaces( line_id ).size() == 6,
+        "[Test] Re-attached line should have 6 sorted surfaces" );
+
+    // Added Lines are detected without being given
+    add_segment_line( brep, builder, points, { 1, 2 } );
+    sorts.update( {}, {} );
+    check_sorts( brep, sorts );
+}
+
+void test_update_radial_sorts_moved_surface()
+{
+    const std::array< geode::Point3D, 5 > points{ geode::Point3D{ { 0, 0, 0 } },
+        geode::Point3D{ { 0, 1, 0 } }, geode::Point3D{ { 0, 0, 1 } },
+        geode::Point3D{ { -1, 0, -1 } }, geode::Point3D{ { 1, 0, -1 } } };
+    geode::BRep brep;
+    geode::BRepBuilder builder{ brep };
+    builder.create_unique_vertices( points.size() );
+    add_triangle_surface( brep, builder, points, { 0, 1, 2 } );
+    add_triangle_surface( brep, builder, points, { 0, 1, 3 } );
+    const auto surface_id =
+        add_triangle_surface( brep, builder, points, { 1, 0, 4 } );
+    const auto line_id = add_segment_line( brep, builder, points, { 0, 1 } );
+    add_segment_line( brep, builder, points, { 0, 2 } );
+    geode::BRepSurfaceRadialSorts sorts{ brep };
+    check_sorts( brep, sorts );
+
+    // Move the third Surface from the first Line to the second one
+    const auto& surface = brep.surface( surface_id );
+    builder.surface_mesh_builder( surface_id )->set_point( 0, points[2] );
+    builder.set_unique_vertex( { surface.component_id(), 0 }, 2 );
+    const std::vector< geode::uuid > surface_ids{ surface_id };
+    sorts.update( surface_ids, {} );
+    check_sorts( brep, sorts );
+    OPENGEODE_EXCEPTION( sorts.sorted_surfaces( line_id ).size() == 4,
+        "[Test] Line should have 4 sorted surfaces after the move" );
+}
+
+void test()
+{
+    geode::OpenGeodeModelLibrary::initialize();
+    test_line_radial_sort();
+    test_model_radial_sorts();
+    test_update_radial_sorts();
+    test_update_radial_sorts_lines();
+    test_update_radial_sorts_moved_surface();
+
     geode::Logger::info( "TEST SUCCESS" );
 }
 
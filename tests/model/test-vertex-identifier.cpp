@@ -231,6 +231,49 @@ void test_update_unique_vertices()
     }
 }
 
+void test_batch_set_unique_vertices()
+{
+    SurfaceProvider provider;
+    SurfaceProviderBuilder builder( provider );
+
+    const auto& surface_id = builder.add_surface();
+    auto surf_builder = builder.surface_mesh_builder( surface_id );
+    const auto surface_cid = provider.surface( surface_id ).component_id();
+    builder.create_unique_vertices( 3 );
+    surf_builder->create_vertices( 5 );
+    std::vector< std::pair< geode::ComponentMeshVertex, geode::index_t > >
+        vertices;
+    vertices.emplace_back( geode::ComponentMeshVertex{ surface_cid, 0 }, 0 );
+    vertices.emplace_back( geode::ComponentMeshVertex{ surface_cid, 1 }, 0 );
+    vertices.emplace_back( geode::ComponentMeshVertex{ surface_cid, 2 }, 1 );
+    vertices.emplace_back( geode::ComponentMeshVertex{ surface_cid, 3 }, 2 );
+    builder.set_unique_vertices( vertices );
+    OPENGEODE_EXCEPTION( provider.component_mesh_vertices( 0 ).size() == 2,
+        "[Test] Batched set of unique vertices is not correct (size 0)" );
+    OPENGEODE_EXCEPTION( provider.component_mesh_vertices( 1 ).size() == 1,
+        "[Test] Batched set of unique vertices is not correct (size 1)" );
+    OPENGEODE_EXCEPTION( provider.component_mesh_vertices( 2 ).size() == 1,
+        "[Test] Batched set of unique vertices is not correct (size 2)" );
+    OPENGEODE_EXCEPTION(
+        provider.unique_vertex( { surface_cid, 3 } ) == 2
+            && provider.unique_vertex( { surface_cid, 4 } ) == geode::NO_ID,
+        "[Test] Batched set of unique vertices is not correct (values)" );
+
+    vertices.clear();
+    vertices.emplace_back( geode::ComponentMeshVertex{ surface_cid, 0 }, 2 );
+    vertices.emplace_back( geode::ComponentMeshVertex{ surface_cid, 1 }, 0 );
+    vertices.emplace_back( geode::ComponentMeshVertex{ surface_cid, 4 }, 1 );
+    builder.set_unique_vertices( vertices );
+    OPENGEODE_EXCEPTION( provider.component_mesh_vertices( 0 ).size() == 1,
+        "[Test] Batched reset of unique vertices is not correct (size 0)" );
+    OPENGEODE_EXCEPTION( provider.component_mesh_vertices( 1 ).size() == 2,
+        "[Test] Batched reset of unique vertices is not correct (size 1)" );
+    OPENGEODE_EXCEPTION( provider.component_mesh_vertices( 2 ).size() == 2,
+        "[Test] Batched reset of unique vertices is not correct (size 2)" );
+    OPENGEODE_EXCEPTION( provider.unique_vertex( { surface_cid, 0 } ) == 2,
+        "[Test] Batched reset of unique vertices is not correct (values)" );
+}
+
 void test()
 {
     geode::OpenGeodeModelLibrary::initialize();
@@ -266,6 +309,7 @@ void test()
     test_save_and_load_unique_vertices( vertex_identifier );
 
     test_update_unique_vertices();
+    test_batch_set_unique_vertices();
 
     builder.unregister_mesh_component( provider.corner( corner2_id ) );
     builder.register_mesh_component( provider.corner( corner2_id ) );